@@ -227,6 +227,15 @@ namespace ttk {
       return 0;
     }
 
+    /**
+     * Set the precomputed global vertex order of the input scalar field
+     * (optional, avoids sorting the vertices again).
+     */
+    inline int setInputVertexOrder(const SimplexId *const order) {
+      discreteGradient_.setInputVertexOrder(order);
+      return 0;
+    }
+
     /**
      * Set the output critical points data pointers.
      */
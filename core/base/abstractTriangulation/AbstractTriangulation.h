@@ -52,11 +52,11 @@ namespace ttk {
 
     /// Reset the triangulation data-structures.
     /// \return Returns 0 upon success, negative values otherwise.
-    int clear();
+    virtual int clear();
 
     /// Computes and displays the memory footprint of the data-structure.
     /// \return Returns 0 upon success, negative values otherwise.
-    size_t footprint() const;
+    virtual size_t footprint() const;
 
     /// Get the \p localEdgeId-th edge of the \p cellId-th cell.
     ///
@@ -3149,6 +3149,9 @@ namespace ttk {
       return 0;
     };
 
+    // Triangulation does not trace the pre-processing steps already done
+    friend class Triangulation;
+
     bool hasPeriodicBoundaries_, hasPreconditionedBoundaryEdges_,
       hasPreconditionedBoundaryTriangles_, hasPreconditionedBoundaryVertices_,
       hasPreconditionedCellEdges_, hasPreconditionedCellNeighbors_,
@@ -24,14 +24,16 @@
 
 #include <AuctionActor.h>
 #include <Debug.h>
-#include <KDTree.h>
+#include <FlatKDTree.h>
 #include <PersistenceDiagram.h>
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <limits>
 #include <queue>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace ttk {
   template <typename dataType>
@@ -51,11 +53,8 @@ namespace ttk {
       return bidders_.size();
     }
 
-    KDTree<dataType> default_kdt_{};
-    KDTree<dataType> &kdt_{default_kdt_};
-    std::vector<KDTree<dataType> *> default_correspondance_kdt_map_{};
-    std::vector<KDTree<dataType> *> &correspondance_kdt_map_{
-      default_correspondance_kdt_map_};
+    FlatKDTree<dataType> default_kdt_{};
+    FlatKDTree<dataType> &kdt_{default_kdt_};
 
     Auction(int wasserstein,
             double geometricalFactor,
@@ -72,13 +71,11 @@ namespace ttk {
             double geometricalFactor,
             double lambda,
             double delta_lim,
-            KDTree<dataType> &kdt,
-            std::vector<KDTree<dataType> *> &correspondance_kdt_map,
+            FlatKDTree<dataType> &kdt,
             dataType epsilon = {},
             dataType initial_diag_price = {},
             bool use_kdTree = true)
-      : kdt_{kdt}, correspondance_kdt_map_{correspondance_kdt_map},
-        bidders_{bidders}, goods_{goods} {
+      : kdt_{kdt}, bidders_{bidders}, goods_{goods} {
 
       n_bidders_ = bidders.size();
       n_goods_ = goods.size();
@@ -116,6 +113,7 @@ namespace ttk {
     };
 
     void runAuctionRound(int &n_biddings, const int kdt_index = 0);
+    void runParallelAuctionRound(int &n_biddings, const int kdt_index = 0);
     dataType getMatchingsAndDistance(std::vector<matchingTuple> *matchings,
                                      bool get_diagonal_matches = false);
     dataType run(std::vector<matchingTuple> *matchings);
@@ -125,8 +123,17 @@ namespace ttk {
     }
     dataType getMaximalPrice();
 
+    /**
+     * @brief Copy the bidder and good diagrams of the auction
+     *
+     * @param[in] BD Bidder diagram
+     * @param[in] GD Good diagram
+     * @param[in] kdt Optional KD-tree of GD (see buildGoodsKDTree), built
+     * once and copied by every auction on GD instead of being rebuilt
+     */
     void BuildAuctionDiagrams(const BidderDiagram<dataType> *BD,
-                              const GoodDiagram<dataType> *GD) {
+                              const GoodDiagram<dataType> *GD,
+                              const FlatKDTree<dataType> *kdt = nullptr) {
       n_bidders_ = BD->size();
       n_goods_ = GD->size();
       // delete_kdTree_ = false;
@@ -152,7 +159,12 @@ namespace ttk {
       }
       if(goods_.size() > 0) {
         // use_kdt_ = use_kdt_;
-        this->buildKDTree();
+        if(kdt != nullptr) {
+          // the good prices are the tree weights: each auction has its copy
+          kdt_ = *kdt;
+        } else {
+          this->buildKDTree();
+        }
       } else {
         use_kdt_ = false;
       }
@@ -214,24 +226,36 @@ namespace ttk {
 
     void buildKDTree() {
       Timer t;
-      default_kdt_ = KDTree<dataType>(true, wasserstein_);
+      default_kdt_ = FlatKDTree<dataType>(wasserstein_);
+      buildGoodsKDTree(kdt_, goods_, geometricalFactor_);
+    }
+
+    /**
+     * @brief Build the KD-tree of a good diagram, as used by the auction
+     *
+     * @param[out] kdt KD-tree (constructed with the Wasserstein power)
+     * @param[in] goods Good diagram
+     * @param[in] geometricalFactor Weight of the birth/death coordinates
+     */
+    static void buildGoodsKDTree(FlatKDTree<dataType> &kdt,
+                                 const GoodDiagram<dataType> &goods,
+                                 const double geometricalFactor) {
       const int dimension
-        = geometricalFactor_ >= 1 ? (geometricalFactor_ <= 0 ? 3 : 2) : 5;
+        = geometricalFactor >= 1 ? (geometricalFactor <= 0 ? 3 : 2) : 5;
       std::vector<dataType> coordinates;
-      for(int i = 0; i < goods_.size(); i++) {
-        Good<dataType> &g = goods_.get(i);
-        if(geometricalFactor_ > 0) {
-          coordinates.push_back(geometricalFactor_ * g.x_);
-          coordinates.push_back(geometricalFactor_ * g.y_);
+      for(int i = 0; i < goods.size(); i++) {
+        const Good<dataType> &g = goods.get(i);
+        if(geometricalFactor > 0) {
+          coordinates.push_back(geometricalFactor * g.x_);
+          coordinates.push_back(geometricalFactor * g.y_);
         }
-        if(geometricalFactor_ < 1) {
-          coordinates.push_back((1 - geometricalFactor_) * g.coords_x_);
-          coordinates.push_back((1 - geometricalFactor_) * g.coords_y_);
-          coordinates.push_back((1 - geometricalFactor_) * g.coords_z_);
+        if(geometricalFactor < 1) {
+          coordinates.push_back((1 - geometricalFactor) * g.coords_x_);
+          coordinates.push_back((1 - geometricalFactor) * g.coords_y_);
+          coordinates.push_back((1 - geometricalFactor) * g.coords_z_);
         }
       }
-      correspondance_kdt_map_
-        = kdt_.build(coordinates.data(), goods_.size(), dimension);
+      kdt.build(coordinates.data(), goods.size(), dimension);
     }
 
     void setEpsilon(dataType epsilon) {
@@ -292,6 +316,8 @@ namespace ttk {
         return 0;
       }
       dataType denominator = d - bidders_.size() * epsilon_;
+      // an external lower bound of the optimal matching cost may be tighter
+      denominator = std::max(denominator, lowerBound_);
       if(denominator <= 0) {
         return 1;
       } else {
@@ -324,6 +350,29 @@ namespace ttk {
       epsilon_ = epsilon;
     }
 
+    /**
+     * @brief Set a lower bound of the optimal matching cost, used to stop
+     * the epsilon-scaling iterations as soon as the current matching is
+     * within the relative precision of this bound
+     */
+    inline void setLowerBound(const dataType lowerBound) {
+      lowerBound_ = lowerBound;
+    }
+
+    /**
+     * @brief Run the auction rounds in parallel (Jacobi-style): all the
+     * unassigned off-diagonal bidders bid concurrently with the same prices,
+     * the highest bid wins each good and the other bidders bid again in the
+     * next round. Diagonal bidders keep bidding one after the other.
+     *
+     * The Jacobi rounds need more bids than the sequential ones, so they
+     * are only used with more than one thread, and not when run() is
+     * called from within an OpenMP parallel region.
+     */
+    inline void setUseParallelRounds(const bool useParallelRounds) {
+      useParallelRounds_ = useParallelRounds;
+    }
+
     template <typename type>
     static type abs(const type var) {
       return (var >= 0) ? var : -var;
@@ -355,6 +404,8 @@ namespace ttk {
     // of the 2 critical points of the pair
     double delta_lim_{};
     bool use_kdt_{true};
+    bool useParallelRounds_{false};
+    dataType lowerBound_{0};
 
     // KDTree<dataType>* kdt_;
   }; // namespace ttk
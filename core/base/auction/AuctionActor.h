@@ -2,7 +2,7 @@
 #define _AUCTIONACTOR_H
 
 #include <Debug.h>
-#include <KDTree.h>
+#include <FlatKDTree.h>
 #include <PersistenceDiagram.h>
 #include <array>
 #include <cmath>
@@ -411,6 +411,30 @@ namespace ttk {
     ~Bidder() {
     }
 
+    // Off-diagonal bid computation (with or without the use of a KD-Tree),
+    // the goods are left untouched: returns the chosen good, its index in
+    // goods (-1 for the twin good) and its new price
+    Good<dataType> *getBid(GoodDiagram<dataType> *goods,
+                           Good<dataType> &twinGood,
+                           int wasserstein,
+                           dataType epsilon,
+                           double geometricalFactor,
+                           int &best_id,
+                           dataType &new_price);
+    Good<dataType> *getKDTBid(GoodDiagram<dataType> *goods,
+                              Good<dataType> &twinGood,
+                              int wasserstein,
+                              dataType epsilon,
+                              double geometricalFactor,
+                              const FlatKDTree<dataType> *kdt,
+                              std::vector<int> &neighbours,
+                              std::vector<dataType> &costs,
+                              int &closest_id,
+                              dataType &new_price,
+                              const int kdt_index = 0);
+    // Assign a good to the bidder, returns the previous owner of the good
+    int acquireGood(Good<dataType> &good, const dataType price);
+
     // Off-diagonal Bidding (with or without the use of a KD-Tree
     int runBidding(GoodDiagram<dataType> *goods,
                    Good<dataType> &diagonalGood,
@@ -422,7 +446,7 @@ namespace ttk {
                       int wasserstein,
                       dataType epsilon,
                       double geometricalFactor,
-                      KDTree<dataType> *kdt,
+                      FlatKDTree<dataType> *kdt,
                       const int kdt_index = 0);
 
     // Diagonal Bidding (with or without the use of a KD-Tree
@@ -441,7 +465,7 @@ namespace ttk {
       int wasserstein,
       dataType epsilon,
       double geometricalFactor,
-      std::vector<KDTree<dataType> *> &correspondance_kdt_map,
+      FlatKDTree<dataType> &kdt,
       std::priority_queue<std::pair<int, dataType>,
                           std::vector<std::pair<int, dataType>>,
                           Compare<dataType>> &diagonal_queue,
@@ -476,14 +500,17 @@ namespace ttk {
   }
 
   template <typename dataType>
-  int Bidder<dataType>::runBidding(GoodDiagram<dataType> *goods,
-                                   Good<dataType> &twinGood,
-                                   int wasserstein,
-                                   dataType epsilon,
-                                   double geometricalFactor) {
+  Good<dataType> *Bidder<dataType>::getBid(GoodDiagram<dataType> *goods,
+                                            Good<dataType> &twinGood,
+                                            int wasserstein,
+                                            dataType epsilon,
+                                            double geometricalFactor,
+                                            int &best_id,
+                                            dataType &new_price) {
     dataType best_val = std::numeric_limits<dataType>::lowest();
     dataType second_val = std::numeric_limits<dataType>::lowest();
     Good<dataType> *best_good = nullptr;
+    best_id = -1;
     for(int i = 0; i < goods->size(); i++) {
       Good<dataType> &g = goods->get(i);
       dataType val = -this->cost(g, wasserstein, geometricalFactor);
@@ -492,6 +519,7 @@ namespace ttk {
         second_val = best_val;
         best_val = val;
         best_good = &g;
+        best_id = i;
       } else if(val > second_val) {
         second_val = val;
       }
@@ -504,6 +532,7 @@ namespace ttk {
       second_val = best_val;
       best_val = val;
       best_good = &g;
+      best_id = -1;
     } else if(val > second_val) {
       second_val = val;
     }
@@ -513,22 +542,41 @@ namespace ttk {
       second_val = best_val;
     }
     dataType old_price = best_good->getPrice();
-    dataType new_price = old_price + best_val - second_val + epsilon;
+    new_price = old_price + best_val - second_val + epsilon;
     if(new_price > std::numeric_limits<dataType>::max() / 2) {
       new_price = old_price + epsilon;
       std::cout << "Huho 376" << std::endl;
     }
-    // Assign bidder to best_good
-    this->setProperty(*best_good);
-    this->setPricePaid(new_price);
+    return best_good;
+  }
 
-    // Assign best_good to bidder and unassign the previous owner of best_good
-    // if need be
-    int idx_reassigned = best_good->getOwner();
-    best_good->assign(this->position_in_auction_, new_price);
+  template <typename dataType>
+  int Bidder<dataType>::acquireGood(Good<dataType> &good,
+                                    const dataType price) {
+    // Assign bidder to good
+    this->setProperty(good);
+    this->setPricePaid(price);
+
+    // Assign good to bidder and unassign the previous owner of good if need be
+    int idx_reassigned = good.getOwner();
+    good.assign(this->position_in_auction_, price);
     return idx_reassigned;
   }
 
+  template <typename dataType>
+  int Bidder<dataType>::runBidding(GoodDiagram<dataType> *goods,
+                                   Good<dataType> &twinGood,
+                                   int wasserstein,
+                                   dataType epsilon,
+                                   double geometricalFactor) {
+    dataType new_price;
+    int best_id;
+    Good<dataType> *best_good
+      = this->getBid(goods, twinGood, wasserstein, epsilon, geometricalFactor,
+                     best_id, new_price);
+    return this->acquireGood(*best_good, new_price);
+  }
+
   template <typename dataType>
   int Bidder<dataType>::runDiagonalBidding(
     GoodDiagram<dataType> *goods,
@@ -653,7 +701,7 @@ namespace ttk {
     int wasserstein,
     dataType epsilon,
     double geometricalFactor,
-    std::vector<KDTree<dataType> *> &correspondance_kdt_map,
+    FlatKDTree<dataType> &kdt,
     std::priority_queue<std::pair<int, dataType>,
                         std::vector<std::pair<int, dataType>>,
                         Compare<dataType>> &diagonal_queue,
@@ -764,8 +812,7 @@ namespace ttk {
     if(is_twin) {
       // std::cout << "got here 5" << std::endl;
       // Update weight in KDTree if the closest good is in it
-      correspondance_kdt_map[best_good->id_]->updateWeight(
-        new_price, kdt_index);
+      kdt.updateWeight(best_good->id_, new_price, kdt_index);
       if(non_empty_goods) {
         diagonal_queue.push(best_pair);
       }
@@ -781,31 +828,33 @@ namespace ttk {
   }
 
   template <typename dataType>
-  int Bidder<dataType>::runKDTBidding(GoodDiagram<dataType> *goods,
-                                      Good<dataType> &twinGood,
-                                      int wasserstein,
-                                      dataType epsilon,
-                                      double geometricalFactor,
-                                      KDTree<dataType> *kdt,
-                                      const int kdt_index) {
-    /// Runs bidding of a non-diagonal bidder
-    std::vector<KDTree<dataType> *> neighbours;
-    std::vector<dataType> costs;
-
-    std::vector<dataType> coordinates;
-    coordinates.push_back(geometricalFactor * this->x_);
-    coordinates.push_back(geometricalFactor * this->y_);
-    if(geometricalFactor < 1) {
-      coordinates.push_back((1 - geometricalFactor) * this->coords_x_);
-      coordinates.push_back((1 - geometricalFactor) * this->coords_y_);
-      coordinates.push_back((1 - geometricalFactor) * this->coords_z_);
-    }
+  Good<dataType> *
+    Bidder<dataType>::getKDTBid(GoodDiagram<dataType> *goods,
+                                Good<dataType> &twinGood,
+                                int wasserstein,
+                                dataType epsilon,
+                                double geometricalFactor,
+                                const FlatKDTree<dataType> *kdt,
+                                std::vector<int> &neighbours,
+                                std::vector<dataType> &costs,
+                                int &closest_id,
+                                dataType &new_price,
+                                const int kdt_index) {
+    /// Computes the bid of a non-diagonal bidder
+    neighbours.clear();
+    costs.clear();
+
+    const std::array<dataType, 5> coordinates{
+      static_cast<dataType>(geometricalFactor * this->x_),
+      static_cast<dataType>(geometricalFactor * this->y_),
+      static_cast<dataType>((1 - geometricalFactor) * this->coords_x_),
+      static_cast<dataType>((1 - geometricalFactor) * this->coords_y_),
+      static_cast<dataType>((1 - geometricalFactor) * this->coords_z_)};
 
     // std::cout<<"got to 1"<<std::endl;
-    kdt->getKClosest(2, coordinates, neighbours, costs, kdt_index);
+    kdt->getKClosest(2, coordinates.data(), neighbours, costs, kdt_index);
     // std::cout<<"got to 2"<<std::endl;
     dataType best_val, second_val;
-    KDTree<dataType> *closest_kdt;
     Good<dataType> *best_good;
     if(costs.size() == 2) {
       // std::cout<<"got to 735"<<std::endl;
@@ -815,8 +864,8 @@ namespace ttk {
       sort(idx.begin(), idx.end(),
            [&costs](int &a, int &b) { return costs[a] < costs[b]; });
 
-      closest_kdt = neighbours[idx[0]];
-      best_good = &(goods->get(closest_kdt->id_));
+      closest_id = neighbours[idx[0]];
+      best_good = &(goods->get(closest_id));
       // Value is defined as the opposite of cost (each bidder aims at
       // maximizing it)
       best_val = -costs[idx[0]];
@@ -824,14 +873,13 @@ namespace ttk {
     } else {
       // std::cout<<"got to 748"<<std::endl;
       // If the kdtree contains only one point
-      closest_kdt = neighbours[0];
-      best_good = &(goods->get(closest_kdt->id_));
+      closest_id = neighbours[0];
+      best_good = &(goods->get(closest_id));
       best_val = -costs[0];
       second_val = best_val;
     }
     // std::cout<<"got to 755"<<std::endl;
     // And now check for the corresponding twin bidder
-    bool twin_chosen = false;
     Good<dataType> &g = twinGood;
     dataType val = -this->cost(g, wasserstein, geometricalFactor);
     val -= g.getPrice();
@@ -839,7 +887,7 @@ namespace ttk {
       second_val = best_val;
       best_val = val;
       best_good = &g;
-      twin_chosen = true;
+      closest_id = -1;
     } else if(val > second_val) {
       second_val = val;
     }
@@ -850,23 +898,38 @@ namespace ttk {
       second_val = best_val;
     }
     dataType old_price = best_good->getPrice();
-    dataType new_price = old_price + best_val - second_val + epsilon;
+    new_price = old_price + best_val - second_val + epsilon;
     if(new_price > std::numeric_limits<dataType>::max() / 2) {
       new_price = old_price + epsilon;
       std::cout << "Huho 681" << std::endl;
     }
-    // Assign bidder to best_good
-    this->setProperty(*best_good);
-    this->setPricePaid(new_price);
-    // Assign best_good to bidder and unassign the previous owner of best_good
-    // if need be
-    int idx_reassigned = best_good->getOwner();
+    return best_good;
+  }
 
-    // std::cout << "got here 3" << std::endl;
-    best_good->assign(this->position_in_auction_, new_price);
+  template <typename dataType>
+  int Bidder<dataType>::runKDTBidding(GoodDiagram<dataType> *goods,
+                                      Good<dataType> &twinGood,
+                                      int wasserstein,
+                                      dataType epsilon,
+                                      double geometricalFactor,
+                                      FlatKDTree<dataType> *kdt,
+                                      const int kdt_index) {
+    /// Runs bidding of a non-diagonal bidder
+    std::vector<int> neighbours;
+    std::vector<dataType> costs;
+    neighbours.reserve(2);
+    costs.reserve(2);
+
+    int closest_id;
+    dataType new_price;
+    Good<dataType> *best_good
+      = this->getKDTBid(goods, twinGood, wasserstein, epsilon,
+                        geometricalFactor, kdt, neighbours, costs, closest_id,
+                        new_price, kdt_index);
+    const int idx_reassigned = this->acquireGood(*best_good, new_price);
     // Update the price in the KDTree
-    if(!twin_chosen) {
-      closest_kdt->updateWeight(new_price, kdt_index);
+    if(closest_id != -1) {
+      kdt->updateWeight(closest_id, new_price, kdt_index);
     }
     return idx_reassigned;
   }
@@ -30,7 +30,7 @@ void ttk::Auction<dataType>::runAuctionRound(int &n_biddings,
       if(use_kdt_) {
         idx_reassigned = b.runDiagonalKDTBidding(
           &all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_,
-          correspondance_kdt_map_, diagonal_queue_, kdt_index);
+          kdt_, diagonal_queue_, kdt_index);
       } else {
         idx_reassigned
           = b.runDiagonalBidding(&all_goods, twin_good, wasserstein_, epsilon,
@@ -63,6 +63,134 @@ void ttk::Auction<dataType>::runAuctionRound(int &n_biddings,
   }
 }
 
+template <typename dataType>
+void ttk::Auction<dataType>::runParallelAuctionRound(int &n_biddings,
+                                                     const int kdt_index) {
+  dataType max_price = getMaximalPrice();
+  dataType epsilon = epsilon_;
+  if(epsilon_ < 1e-6 * max_price) {
+    // Risks of floating point limits reached...
+    epsilon = 1e-6 * max_price;
+  }
+
+  // off-diagonal bidders of the current Jacobi round, with their bids
+  std::vector<int> bidders{};
+  std::vector<Good<dataType> *> bestGoods{};
+  std::vector<int> closestIds{};
+  std::vector<dataType> bids{};
+  // per off-diagonal good, position in bidders of the highest bid
+  std::vector<int> winners(goods_.size(), -1);
+
+  while(unassignedBidders_.size() > 0) {
+
+    // 1. diagonal bidders bid sequentially (they all compete for the
+    // cheapest diagonal goods), off-diagonal ones are delayed
+    bidders.clear();
+    size_t queueSize = unassignedBidders_.size();
+    for(size_t i = 0; i < queueSize; i++) {
+      int pos = unassignedBidders_.front();
+      unassignedBidders_.pop();
+      Bidder<dataType> &b = bidders_.get(pos);
+      if(!b.isDiagonal()) {
+        bidders.emplace_back(pos);
+        continue;
+      }
+      n_biddings++;
+      Good<dataType> &twin_good = goods_.get(-b.id_ - 1);
+      int idx_reassigned;
+      if(use_kdt_) {
+        idx_reassigned = b.runDiagonalKDTBidding(
+          &diagonal_goods_, twin_good, wasserstein_, epsilon,
+          geometricalFactor_, kdt_, diagonal_queue_, kdt_index);
+      } else {
+        idx_reassigned
+          = b.runDiagonalBidding(&diagonal_goods_, twin_good, wasserstein_,
+                                 epsilon, geometricalFactor_, diagonal_queue_);
+      }
+      if(idx_reassigned >= 0) {
+        Bidder<dataType> &reassigned = bidders_.get(idx_reassigned);
+        reassigned.resetProperty();
+        unassignedBidders_.push(idx_reassigned);
+      }
+    }
+
+    if(bidders.empty()) {
+      continue;
+    }
+
+    // 2. off-diagonal bidders compute their bids in parallel, against the
+    // same prices
+    const int nBidders = bidders.size();
+    n_biddings += nBidders;
+    bestGoods.resize(nBidders);
+    closestIds.resize(nBidders);
+    bids.resize(nBidders);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    {
+      std::vector<int> neighbours;
+      std::vector<dataType> costs;
+      neighbours.reserve(2);
+      costs.reserve(2);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif // TTK_ENABLE_OPENMP
+      for(int i = 0; i < nBidders; i++) {
+        Bidder<dataType> &b = bidders_.get(bidders[i]);
+        Good<dataType> &twin_good = diagonal_goods_.get(b.id_);
+        if(use_kdt_) {
+          bestGoods[i] = b.getKDTBid(
+            &goods_, twin_good, wasserstein_, epsilon, geometricalFactor_,
+            &kdt_, neighbours, costs, closestIds[i], bids[i], kdt_index);
+        } else {
+          bestGoods[i]
+            = b.getBid(&goods_, twin_good, wasserstein_, epsilon,
+                       geometricalFactor_, closestIds[i], bids[i]);
+        }
+      }
+    }
+
+    // 3. conflict resolution: the highest bid wins each good (closestIds
+    // holds the index of the wanted good in goods_, or -1 for the twin
+    // diagonal good that no other off-diagonal bidder can want)
+    for(int i = 0; i < nBidders; i++) {
+      if(closestIds[i] == -1) {
+        continue;
+      }
+      const int g = closestIds[i];
+      if(winners[g] == -1 || bids[i] > bids[winners[g]]) {
+        winners[g] = i;
+      }
+    }
+
+    // 4. the winners get their goods, the displaced owners and the losers
+    // will bid again
+    for(int i = 0; i < nBidders; i++) {
+      Bidder<dataType> &b = bidders_.get(bidders[i]);
+      if(closestIds[i] != -1) {
+        const int g = closestIds[i];
+        if(winners[g] != i) {
+          unassignedBidders_.push(bidders[i]);
+          continue;
+        }
+        winners[g] = -1;
+        if(use_kdt_) {
+          kdt_.updateWeight(closestIds[i], bids[i], kdt_index);
+        }
+      }
+      int idx_reassigned = b.acquireGood(*bestGoods[i], bids[i]);
+      if(idx_reassigned >= 0) {
+        Bidder<dataType> &reassigned = bidders_.get(idx_reassigned);
+        reassigned.resetProperty();
+        unassignedBidders_.push(idx_reassigned);
+      }
+    }
+  }
+}
+
 template <typename dataType>
 dataType ttk::Auction<dataType>::getMaximalPrice() {
   dataType max_price = 0;
@@ -134,11 +262,20 @@ dataType ttk::Auction<dataType>::run(std::vector<matchingTuple> *matchings) {
   initializeEpsilon();
   int n_biddings = 0;
   dataType delta = 5;
+  bool parallelRounds = useParallelRounds_ && threadNumber_ > 1;
+#ifdef TTK_ENABLE_OPENMP
+  // already inside a parallel loop over diagram pairs: stay sequential
+  parallelRounds = parallelRounds && !omp_in_parallel();
+#endif // TTK_ENABLE_OPENMP
   while(delta > delta_lim_) {
     epsilon_ /= 5;
     this->buildUnassignedBidders();
     this->reinitializeGoods();
-    this->runAuctionRound(n_biddings);
+    if(parallelRounds) {
+      this->runParallelAuctionRound(n_biddings);
+    } else {
+      this->runAuctionRound(n_biddings);
+    }
     delta = this->getRelativePrecision();
   }
   dataType wassersteinDistance = this->getMatchingsAndDistance(matchings, true);
@@ -0,0 +1,304 @@
+/// \ingroup base
+/// \class ttk::BoundingVolumeHierarchy
+/// \date October 2026.
+///
+/// \brief TTK bounding volume hierarchy of triangles, for ray casting.
+///
+/// The hierarchy is a binary tree of axis-aligned bounding boxes, built by
+/// splitting the triangles at the median of their centroids along the
+/// longest axis of the centroid bounds. Nodes are stored in a single array
+/// in pre-order: the left child of an inner node immediately follows it,
+/// the index of its right child is stored in the node. The vertex
+/// coordinates of the triangles are copied in leaf order, so that the
+/// triangles of a leaf are contiguous in memory.
+///
+/// intersect() returns the closest triangle hit by a ray (ties are broken
+/// by the smallest triangle identifier), so that the result does not depend
+/// on the traversal order.
+///
+/// \sa ttk::CinemaImaging
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace ttk {
+
+  class BoundingVolumeHierarchy {
+
+  public:
+    struct Node {
+      double lower[3];
+      double upper[3];
+      // leaf: first triangle (in leaf order) / inner: right child
+      int offset;
+      // number of triangles (0 for inner nodes)
+      int count;
+    };
+
+    /// Builds the hierarchy of the triangles (3 vertex indices each, in
+    /// connectivity) of the vertices of coordinates coords (3 per vertex).
+    inline int build(const double *coords,
+                     const int *connectivity,
+                     const size_t nTriangles,
+                     const int leafSize = 4) {
+
+      this->nodes_.clear();
+      this->triangleIds_.resize(nTriangles);
+      std::iota(this->triangleIds_.begin(), this->triangleIds_.end(), 0);
+
+      if(nTriangles == 0) {
+        this->vertices_.clear();
+        return 0;
+      }
+
+      std::vector<std::array<double, 3>> centroids(nTriangles);
+      for(size_t i = 0; i < nTriangles; i++) {
+        for(int j = 0; j < 3; j++) {
+          centroids[i][j] = (coords[3 * connectivity[3 * i] + j]
+                             + coords[3 * connectivity[3 * i + 1] + j]
+                             + coords[3 * connectivity[3 * i + 2] + j])
+                            / 3.0;
+        }
+      }
+
+      this->nodes_.reserve(2 * (nTriangles / std::max(leafSize, 1)) + 1);
+      this->buildNode(coords, connectivity, centroids, 0, nTriangles,
+                      std::max(leafSize, 1));
+
+      // triangle coordinates in leaf order
+      this->vertices_.resize(9 * nTriangles);
+      for(size_t i = 0; i < nTriangles; i++) {
+        const int t = this->triangleIds_[i];
+        for(int k = 0; k < 3; k++)
+          for(int j = 0; j < 3; j++)
+            this->vertices_[9 * i + 3 * k + j]
+              = coords[3 * connectivity[3 * t + k] + j];
+      }
+
+      return 0;
+    }
+
+    /// Closest intersection of the ray origin + t * direction with
+    /// tMin <= t <= tMax. Returns false if no triangle is hit, otherwise
+    /// sets the triangle identifier, the ray parameter and the barycentric
+    /// coordinates (u, v) of the hit point, relative to the second and
+    /// third vertex of the triangle.
+    inline bool intersect(const double origin[3],
+                          const double direction[3],
+                          const double tMin,
+                          double tMax,
+                          int &triangle,
+                          double &t,
+                          double &u,
+                          double &v) const {
+
+      if(this->nodes_.empty())
+        return false;
+
+      double inverse[3];
+      for(int j = 0; j < 3; j++)
+        inverse[j] = 1.0 / direction[j];
+
+      triangle = -1;
+      int stack[64];
+      int stackSize = 0;
+      int current = 0;
+
+      while(true) {
+        const auto &node = this->nodes_[current];
+
+        if(node.count > 0) {
+          for(int i = node.offset; i < node.offset + node.count; i++) {
+            double ti, ui, vi;
+            if(this->intersectTriangle(i, origin, direction, ti, ui, vi)
+               && ti >= tMin && ti <= tMax) {
+              const int id = this->triangleIds_[i];
+              if(triangle == -1 || ti < tMax || id < triangle) {
+                triangle = id;
+                t = ti;
+                u = ui;
+                v = vi;
+                tMax = ti;
+              }
+            }
+          }
+        } else {
+          const int left = current + 1;
+          const int right = node.offset;
+          double tLeft, tRight;
+          const bool hitLeft
+            = this->intersectBox(left, origin, inverse, tMin, tMax, tLeft);
+          const bool hitRight
+            = this->intersectBox(right, origin, inverse, tMin, tMax, tRight);
+
+          if(hitLeft && hitRight) {
+            // visit the closest child first
+            const bool leftFirst = tLeft <= tRight;
+            current = leftFirst ? left : right;
+            stack[stackSize++] = leftFirst ? right : left;
+            continue;
+          } else if(hitLeft) {
+            current = left;
+            continue;
+          } else if(hitRight) {
+            current = right;
+            continue;
+          }
+        }
+
+        if(stackSize == 0)
+          break;
+        current = stack[--stackSize];
+      }
+
+      return triangle != -1;
+    }
+
+    inline size_t getNumberOfNodes() const {
+      return this->nodes_.size();
+    }
+
+  protected:
+    inline int
+      buildNode(const double *coords,
+                const int *connectivity,
+                const std::vector<std::array<double, 3>> &centroids,
+                const size_t begin,
+                const size_t end,
+                const int leafSize) {
+
+      const int nodeId = this->nodes_.size();
+      this->nodes_.emplace_back();
+
+      Node node;
+      for(int j = 0; j < 3; j++) {
+        node.lower[j] = std::numeric_limits<double>::max();
+        node.upper[j] = std::numeric_limits<double>::lowest();
+      }
+      double cLower[3] = {node.lower[0], node.lower[1], node.lower[2]};
+      double cUpper[3] = {node.upper[0], node.upper[1], node.upper[2]};
+
+      for(size_t i = begin; i < end; i++) {
+        const int t = this->triangleIds_[i];
+        for(int k = 0; k < 3; k++) {
+          const double *p = &coords[3 * connectivity[3 * t + k]];
+          for(int j = 0; j < 3; j++) {
+            node.lower[j] = std::min(node.lower[j], p[j]);
+            node.upper[j] = std::max(node.upper[j], p[j]);
+          }
+        }
+        for(int j = 0; j < 3; j++) {
+          cLower[j] = std::min(cLower[j], centroids[t][j]);
+          cUpper[j] = std::max(cUpper[j], centroids[t][j]);
+        }
+      }
+
+      int axis = 0;
+      for(int j = 1; j < 3; j++)
+        if(cUpper[j] - cLower[j] > cUpper[axis] - cLower[axis])
+          axis = j;
+
+      if(end - begin <= (size_t)leafSize || cUpper[axis] == cLower[axis]) {
+        node.offset = begin;
+        node.count = end - begin;
+        this->nodes_[nodeId] = node;
+        return nodeId;
+      }
+
+      // median split (ties broken by triangle identifier)
+      const size_t middle = begin + (end - begin) / 2;
+      std::nth_element(this->triangleIds_.begin() + begin,
+                       this->triangleIds_.begin() + middle,
+                       this->triangleIds_.begin() + end,
+                       [&centroids, axis](const int a, const int b) {
+                         return centroids[a][axis] < centroids[b][axis]
+                                || (centroids[a][axis] == centroids[b][axis]
+                                    && a < b);
+                       });
+
+      this->buildNode(coords, connectivity, centroids, begin, middle, leafSize);
+      node.offset = this->buildNode(
+        coords, connectivity, centroids, middle, end, leafSize);
+      node.count = 0;
+      this->nodes_[nodeId] = node;
+
+      return nodeId;
+    }
+
+    inline bool intersectBox(const int nodeId,
+                             const double origin[3],
+                             const double inverse[3],
+                             const double tMin,
+                             const double tMax,
+                             double &tEntry) const {
+      const auto &node = this->nodes_[nodeId];
+      double t0 = tMin, t1 = tMax;
+      for(int j = 0; j < 3; j++) {
+        double tNear = (node.lower[j] - origin[j]) * inverse[j];
+        double tFar = (node.upper[j] - origin[j]) * inverse[j];
+        if(tNear > tFar)
+          std::swap(tNear, tFar);
+        // NaN (ray in the slab plane) does not shrink the interval
+        t0 = tNear > t0 ? tNear : t0;
+        t1 = tFar < t1 ? tFar : t1;
+        if(t0 > t1)
+          return false;
+      }
+      tEntry = t0;
+      return true;
+    }
+
+    // Moller-Trumbore ray/triangle intersection (both faces)
+    inline bool intersectTriangle(const int i,
+                                  const double origin[3],
+                                  const double direction[3],
+                                  double &t,
+                                  double &u,
+                                  double &v) const {
+      const double *p0 = &this->vertices_[9 * i];
+      const double *p1 = p0 + 3;
+      const double *p2 = p0 + 6;
+
+      const double e1[3] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+      const double e2[3] = {p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+
+      const double p[3] = {direction[1] * e2[2] - direction[2] * e2[1],
+                           direction[2] * e2[0] - direction[0] * e2[2],
+                           direction[0] * e2[1] - direction[1] * e2[0]};
+      const double det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+      if(det == 0)
+        return false;
+      const double invDet = 1.0 / det;
+
+      const double s[3] = {origin[0] - p0[0], origin[1] - p0[1],
+                           origin[2] - p0[2]};
+      u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * invDet;
+      if(u < 0 || u > 1)
+        return false;
+
+      const double q[3] = {s[1] * e1[2] - s[2] * e1[1],
+                           s[2] * e1[0] - s[0] * e1[2],
+                           s[0] * e1[1] - s[1] * e1[0]};
+      v = (direction[0] * q[0] + direction[1] * q[1] + direction[2] * q[2])
+          * invDet;
+      if(v < 0 || u + v > 1)
+        return false;
+
+      t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * invDet;
+      return true;
+    }
+
+    std::vector<Node> nodes_{};
+    // triangle identifiers in leaf order
+    std::vector<int> triangleIds_{};
+    // triangle vertex coordinates in leaf order (9 per triangle)
+    std::vector<double> vertices_{};
+  };
+
+} // namespace ttk
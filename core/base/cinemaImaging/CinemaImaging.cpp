@@ -0,0 +1,113 @@
+#include <CinemaImaging.h>
+
+#include <cmath>
+
+ttk::CinemaImaging::CinemaImaging() {
+  this->setDebugMsgPrefix("CinemaImaging");
+}
+
+int ttk::CinemaImaging::renderImages(float *depthBuffer,
+                                     int *triangleIds,
+                                     float *barycentrics,
+                                     const BoundingVolumeHierarchy &bvh,
+                                     const int resolution[2],
+                                     const size_t nCameras,
+                                     const double *camPositions,
+                                     const double *camDirections,
+                                     const double *camUps,
+                                     const int projectionMode,
+                                     const double camHeight,
+                                     const double camAngle,
+                                     const double camNearFar[2]) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!depthBuffer || !triangleIds || !barycentrics || !camPositions
+     || !camDirections || !camUps)
+    return -1;
+  if(resolution[0] < 1 || resolution[1] < 1)
+    return -2;
+  if(!(camNearFar[0] < camNearFar[1]))
+    return -3;
+#endif
+
+  const size_t width = resolution[0];
+  const size_t height = resolution[1];
+  const size_t nPixels = width * height;
+  const double aspect = (double)width / (double)height;
+  const double near = camNearFar[0];
+  const double far = camNearFar[1];
+
+  // half size of the image plane at distance 1 (perspective) or of the
+  // viewport (orthographic)
+  const double halfHeight = projectionMode == 0
+                              ? camHeight * 0.5
+                              : std::tan(camAngle * M_PI / 360.0);
+  const double halfWidth = halfHeight * aspect;
+
+  // one task per image row
+  const size_t nRows = nCameras * height;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t r = 0; r < nRows; r++) {
+    const size_t c = r / height;
+    const size_t y = r % height;
+
+    // camera frame (direction, right, up)
+    double d[3] = {camDirections[3 * c], camDirections[3 * c + 1],
+                   camDirections[3 * c + 2]};
+    const double dNorm = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    if(dNorm > 0)
+      for(int j = 0; j < 3; j++)
+        d[j] /= dNorm;
+    const double *up = &camUps[3 * c];
+    double right[3] = {d[1] * up[2] - d[2] * up[1], d[2] * up[0] - d[0] * up[2],
+                       d[0] * up[1] - d[1] * up[0]};
+    const double rightNorm = std::sqrt(
+      right[0] * right[0] + right[1] * right[1] + right[2] * right[2]);
+    if(rightNorm > 0)
+      for(int j = 0; j < 3; j++)
+        right[j] /= rightNorm;
+    const double trueUp[3] = {right[1] * d[2] - right[2] * d[1],
+                              right[2] * d[0] - right[0] * d[2],
+                              right[0] * d[1] - right[1] * d[0]};
+
+    const double *position = &camPositions[3 * c];
+    const double v = (2.0 * (y + 0.5) / height - 1.0) * halfHeight;
+
+    for(size_t x = 0; x < width; x++) {
+      const double u = (2.0 * (x + 0.5) / width - 1.0) * halfWidth;
+      const size_t pixel = c * nPixels + y * width + x;
+
+      double origin[3], direction[3];
+      for(int j = 0; j < 3; j++) {
+        if(projectionMode == 0) {
+          origin[j] = position[j] + u * right[j] + v * trueUp[j];
+          direction[j] = d[j];
+        } else {
+          // not normalized: the ray parameter is the depth along d
+          origin[j] = position[j];
+          direction[j] = d[j] + u * right[j] + v * trueUp[j];
+        }
+      }
+
+      int triangle = -1;
+      double t = 0, tu = 0, tv = 0;
+      if(bvh.intersect(origin, direction, near, far, triangle, t, tu, tv)) {
+        depthBuffer[pixel] = projectionMode == 0
+                               ? (t - near) / (far - near)
+                               : far * (t - near) / (t * (far - near));
+        triangleIds[pixel] = triangle;
+        barycentrics[2 * pixel] = tu;
+        barycentrics[2 * pixel + 1] = tv;
+      } else {
+        depthBuffer[pixel] = 1;
+        triangleIds[pixel] = -1;
+        barycentrics[2 * pixel] = 0;
+        barycentrics[2 * pixel + 1] = 0;
+      }
+    }
+  }
+
+  return 0;
+}
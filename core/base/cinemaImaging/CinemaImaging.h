@@ -0,0 +1,146 @@
+/// \ingroup base
+/// \class ttk::CinemaImaging
+/// \date October 2026.
+///
+/// \brief TTK %cinemaImaging processing package.
+///
+/// %CinemaImaging is a TTK processing package that renders depth images of
+/// a triangle mesh on the CPU, by casting one ray per pixel through a
+/// ttk::BoundingVolumeHierarchy of the triangles. The images of all the
+/// cameras are rendered in parallel.
+///
+/// The depth values follow the OpenGL depth buffer convention (window
+/// coordinates in [0, 1], 1 for the background), so that the images match
+/// the ones of the depth buffer of a VTK render window. For every pixel, the
+/// identifier of the triangle hit and the barycentric coordinates of the hit
+/// point are also stored, so that vertex and triangle fields can be
+/// resampled afterwards (see interpolatePointData() and lookupCellData()).
+///
+/// \sa ttkCinemaImaging.cpp %for a usage example.
+
+#pragma once
+
+// base code includes
+#include <BoundingVolumeHierarchy.h>
+#include <Debug.h>
+
+#include <limits>
+
+namespace ttk {
+
+  class CinemaImaging : virtual public Debug {
+
+  public:
+    CinemaImaging();
+
+    /// Renders one image per camera.
+    ///
+    /// \param depthBuffer Output depth values (one per pixel and camera).
+    /// \param triangleIds Output triangle hit per pixel (-1 if none).
+    /// \param barycentrics Output barycentric coordinates (2 per pixel).
+    /// \param bvh Hierarchy of the rendered triangles.
+    /// \param resolution Image width and height.
+    /// \param nCameras Number of cameras.
+    /// \param camPositions Camera positions (3 per camera).
+    /// \param camDirections Viewing directions (3 per camera, normalized
+    /// here).
+    /// \param camUps Camera up vectors (3 per camera).
+    /// \param projectionMode 0: orthographic, 1: perspective.
+    /// \param camHeight Height of the orthographic viewport.
+    /// \param camAngle Vertical view angle (perspective, in degrees).
+    /// \param camNearFar Near and far clipping distances.
+    int renderImages(float *depthBuffer,
+                     int *triangleIds,
+                     float *barycentrics,
+                     const BoundingVolumeHierarchy &bvh,
+                     const int resolution[2],
+                     const size_t nCameras,
+                     const double *camPositions,
+                     const double *camDirections,
+                     const double *camUps,
+                     const int projectionMode,
+                     const double camHeight,
+                     const double camAngle,
+                     const double camNearFar[2]) const;
+
+    /// Interpolates a component of a vertex field at the pixels (NaN for
+    /// the background).
+    template <typename dataType>
+    int interpolatePointData(float *output,
+                             const dataType *input,
+                             const int nComponents,
+                             const int component,
+                             const int *connectivity,
+                             const int *triangleIds,
+                             const float *barycentrics,
+                             const size_t nPixels) const;
+
+    /// Copies a component of a triangle field at the pixels (NaN for the
+    /// background).
+    template <typename dataType>
+    int lookupCellData(float *output,
+                       const dataType *input,
+                       const int nComponents,
+                       const int component,
+                       const int *triangleIds,
+                       const size_t nPixels) const;
+  };
+} // namespace ttk
+
+template <typename dataType>
+int ttk::CinemaImaging::interpolatePointData(float *output,
+                                             const dataType *input,
+                                             const int nComponents,
+                                             const int component,
+                                             const int *connectivity,
+                                             const int *triangleIds,
+                                             const float *barycentrics,
+                                             const size_t nPixels) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!output || !input || !connectivity || !triangleIds || !barycentrics)
+    return -1;
+#endif
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < nPixels; i++) {
+    const int t = triangleIds[i];
+    if(t < 0) {
+      output[i] = std::numeric_limits<float>::quiet_NaN();
+      continue;
+    }
+    const double u = barycentrics[2 * i];
+    const double v = barycentrics[2 * i + 1];
+    const int *vertices = &connectivity[3 * t];
+    output[i] = (1 - u - v) * input[nComponents * vertices[0] + component]
+                + u * input[nComponents * vertices[1] + component]
+                + v * input[nComponents * vertices[2] + component];
+  }
+
+  return 0;
+}
+
+template <typename dataType>
+int ttk::CinemaImaging::lookupCellData(float *output,
+                                       const dataType *input,
+                                       const int nComponents,
+                                       const int component,
+                                       const int *triangleIds,
+                                       const size_t nPixels) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!output || !input || !triangleIds)
+    return -1;
+#endif
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < nPixels; i++) {
+    const int t = triangleIds[i];
+    output[i] = t < 0 ? std::numeric_limits<float>::quiet_NaN()
+                      : input[nComponents * t + component];
+  }
+
+  return 0;
+}
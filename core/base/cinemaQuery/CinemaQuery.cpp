@@ -1,5 +1,8 @@
 #include <CinemaQuery.h>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 
 #if TTK_ENABLE_SQLITE3
 #include <sqlite3.h>
@@ -9,6 +12,7 @@ ttk::CinemaQuery::CinemaQuery() {
   this->setDebugMsgPrefix("CinemaQuery");
 }
 ttk::CinemaQuery::~CinemaQuery() {
+  this->closeDatabase();
 }
 
 int ttk::CinemaQuery::execute(
@@ -159,4 +163,327 @@ int ttk::CinemaQuery::execute(
   this->printErr("This filter requires Sqlite3");
   return 0;
 #endif
-}
\ No newline at end of file
+}
+
+#if TTK_ENABLE_SQLITE3
+namespace {
+  // SQL identifier (table, column or index name) between double quotes
+  std::string quote(const std::string &name) {
+    std::string quoted = "\"";
+    for(const auto c : name) {
+      quoted += c;
+      if(c == '"')
+        quoted += c;
+    }
+    return quoted + "\"";
+  }
+} // namespace
+#endif
+
+int ttk::CinemaQuery::openDatabase() {
+#if TTK_ENABLE_SQLITE3
+  this->closeDatabase();
+
+  if(sqlite3_open(":memory:", &this->db_) != SQLITE_OK) {
+    this->printErr(sqlite3_errmsg(this->db_));
+    sqlite3_close(this->db_);
+    this->db_ = nullptr;
+    return 0;
+  }
+
+  return 1;
+#else
+  this->printErr("This filter requires Sqlite3");
+  return 0;
+#endif
+}
+
+int ttk::CinemaQuery::closeDatabase() {
+#if TTK_ENABLE_SQLITE3
+  this->tables_.clear();
+  this->indices_.clear();
+  if(this->db_ == nullptr)
+    return 1;
+
+  const int rc = sqlite3_close(this->db_);
+  this->db_ = nullptr;
+  if(rc != SQLITE_OK) {
+    this->printErr("Could not close database");
+    return 0;
+  }
+#endif
+  return 1;
+}
+
+int ttk::CinemaQuery::loadTable(const std::string &tableName,
+                                const std::vector<Column> &columns) {
+#if TTK_ENABLE_SQLITE3
+  if(this->db_ == nullptr) {
+    this->printErr("No database");
+    return 0;
+  }
+
+  Timer timer;
+  this->printMsg("Loading table " + tableName, 0,
+                 ttk::debug::LineMode::REPLACE);
+
+  const size_t nc = columns.size();
+  const size_t nr
+    = nc == 0 ? 0
+              : (columns[0].isNumeric ? columns[0].numericValues.size()
+                                      : columns[0].textValues.size());
+
+  // Table definition
+  std::string sqlTableDefinition = "CREATE TABLE " + quote(tableName) + " (";
+  std::string sqlInsertStatement = "INSERT INTO " + quote(tableName)
+                                   + " VALUES (";
+  for(size_t j = 0; j < nc; j++) {
+    sqlTableDefinition += (j > 0 ? "," : "") + quote(columns[j].name) + " "
+                          + (columns[j].isNumeric ? "REAL" : "TEXT");
+    sqlInsertStatement += (j > 0 ? ",?" : "?");
+
+    const size_t size = columns[j].isNumeric ? columns[j].numericValues.size()
+                                             : columns[j].textValues.size();
+    if(size != nr) {
+      this->printErr("Columns of different sizes");
+      return 0;
+    }
+  }
+  sqlTableDefinition += ")";
+  sqlInsertStatement += ")";
+
+  char *zErrMsg = nullptr;
+  if(sqlite3_exec(this->db_, sqlTableDefinition.data(), nullptr, nullptr,
+                  &zErrMsg)
+     != SQLITE_OK) {
+    this->printErr(zErrMsg);
+    sqlite3_free(zErrMsg);
+    return 0;
+  }
+
+  // Fill table with a single prepared statement, in one transaction
+  sqlite3_stmt *sqlStatement = nullptr;
+  if(sqlite3_prepare_v2(
+       this->db_, sqlInsertStatement.data(), -1, &sqlStatement, nullptr)
+     != SQLITE_OK) {
+    this->printErr(sqlite3_errmsg(this->db_));
+    return 0;
+  }
+
+  sqlite3_exec(this->db_, "BEGIN TRANSACTION", nullptr, nullptr, nullptr);
+  int rc = SQLITE_DONE;
+  for(size_t i = 0; i < nr && rc == SQLITE_DONE; i++) {
+    for(size_t j = 0; j < nc; j++) {
+      if(columns[j].isNumeric)
+        sqlite3_bind_double(sqlStatement, j + 1, columns[j].numericValues[i]);
+      else
+        sqlite3_bind_text(sqlStatement, j + 1,
+                          columns[j].textValues[i].data(),
+                          columns[j].textValues[i].size(), SQLITE_STATIC);
+    }
+    rc = sqlite3_step(sqlStatement);
+    sqlite3_reset(sqlStatement);
+  }
+  sqlite3_exec(this->db_, "COMMIT", nullptr, nullptr, nullptr);
+  sqlite3_finalize(sqlStatement);
+
+  if(rc != SQLITE_DONE) {
+    this->printErr(sqlite3_errmsg(this->db_));
+    return 0;
+  }
+
+  std::vector<std::string> columnNames(nc);
+  for(size_t j = 0; j < nc; j++)
+    columnNames[j] = columns[j].name;
+  this->tables_.emplace_back(tableName, columnNames);
+
+  this->printMsg("Loading table " + tableName + " (#rows: "
+                   + std::to_string(nr) + ")",
+                 1, timer.getElapsedTime());
+
+  return 1;
+#else
+  this->printErr("This filter requires Sqlite3");
+  return 0;
+#endif
+}
+
+int ttk::CinemaQuery::updateIndices(
+  const std::vector<std::string> &columnNames) {
+#if TTK_ENABLE_SQLITE3
+  if(this->db_ == nullptr) {
+    this->printErr("No database");
+    return 0;
+  }
+
+  // requested indices
+  std::vector<std::vector<std::string>> indices;
+  for(const auto &table : this->tables_) {
+    for(const auto &column : table.second) {
+      if(std::find(columnNames.begin(), columnNames.end(), column)
+         != columnNames.end())
+        indices.push_back({"ttkIndex_" + table.first + "_" + column,
+                           table.first, column});
+    }
+  }
+
+  if(indices == this->indices_)
+    return 1;
+
+  Timer timer;
+  this->printMsg("Updating indices", 0, ttk::debug::LineMode::REPLACE);
+
+  char *zErrMsg = nullptr;
+  for(const auto &index : this->indices_) {
+    if(std::find(indices.begin(), indices.end(), index) != indices.end())
+      continue;
+    const std::string sql = "DROP INDEX " + quote(index[0]);
+    if(sqlite3_exec(this->db_, sql.data(), nullptr, nullptr, &zErrMsg)
+       != SQLITE_OK) {
+      this->printErr(zErrMsg);
+      sqlite3_free(zErrMsg);
+      return 0;
+    }
+  }
+  this->indices_.clear();
+
+  for(const auto &index : indices) {
+    const std::string sql = "CREATE INDEX IF NOT EXISTS " + quote(index[0])
+                            + " ON " + quote(index[1]) + " ("
+                            + quote(index[2]) + ")";
+    if(sqlite3_exec(this->db_, sql.data(), nullptr, nullptr, &zErrMsg)
+       != SQLITE_OK) {
+      this->printErr(zErrMsg);
+      sqlite3_free(zErrMsg);
+      return 0;
+    }
+    this->indices_.push_back(index);
+  }
+
+  this->printMsg("Updating indices (#indices: "
+                   + std::to_string(this->indices_.size()) + ")",
+                 1, timer.getElapsedTime());
+
+  return 1;
+#else
+  this->printErr("This filter requires Sqlite3");
+  return 0;
+#endif
+}
+
+int ttk::CinemaQuery::query(const std::string &sqlQuery,
+                            std::vector<Column> &result,
+                            int &nRows) const {
+#if TTK_ENABLE_SQLITE3
+  result.clear();
+  nRows = 0;
+
+  if(this->db_ == nullptr) {
+    this->printErr("No database");
+    return 0;
+  }
+
+  // print input
+  {
+    std::vector<std::string> sqlLines;
+    {
+      std::stringstream ss(sqlQuery);
+      std::string line;
+      while(std::getline(ss, line))
+        sqlLines.push_back(line);
+    }
+    this->printMsg(ttk::debug::Separator::L1);
+    this->printMsg(sqlLines);
+    this->printMsg(ttk::debug::Separator::L1);
+  }
+
+  Timer timer;
+  this->printMsg("Querying database", 0, ttk::debug::LineMode::REPLACE);
+
+  sqlite3_stmt *sqlStatement = nullptr;
+  if(sqlite3_prepare_v2(this->db_, sqlQuery.data(), -1, &sqlStatement, nullptr)
+     != SQLITE_OK) {
+    this->printErr(sqlite3_errmsg(this->db_));
+    return 0;
+  }
+
+  const int nColumns = sqlite3_column_count(sqlStatement);
+  if(nColumns < 1) {
+    this->printErr("Query result has no columns.");
+    sqlite3_finalize(sqlStatement);
+    return 0;
+  }
+
+  result.resize(nColumns);
+  for(int i = 0; i < nColumns; i++) {
+    result[i].name = sqlite3_column_name(sqlStatement, i);
+    result[i].isInteger = true;
+  }
+
+  // columns are numeric until a text value is found
+  const auto toText = [](Column &column) {
+    column.isNumeric = false;
+    column.textValues.resize(column.numericValues.size());
+    for(size_t r = 0; r < column.numericValues.size(); r++) {
+      const double value = column.numericValues[r];
+      if(std::isnan(value))
+        continue;
+      // same formatting as sqlite3_column_text
+      char *text = column.isInteger
+                     ? sqlite3_mprintf("%lld", (sqlite3_int64)value)
+                     : sqlite3_mprintf("%!.15g", value);
+      column.textValues[r] = text;
+      sqlite3_free(text);
+    }
+    column.numericValues.clear();
+    column.isInteger = false;
+  };
+
+  int rc;
+  while((rc = sqlite3_step(sqlStatement)) == SQLITE_ROW) {
+    nRows++;
+    for(int i = 0; i < nColumns; i++) {
+      auto &column = result[i];
+      const int type = sqlite3_column_type(sqlStatement, i);
+      if(column.isNumeric && (type == SQLITE_TEXT || type == SQLITE_BLOB))
+        toText(column);
+
+      if(column.isNumeric) {
+        if(type == SQLITE_INTEGER) {
+          column.numericValues.push_back(
+            (double)sqlite3_column_int64(sqlStatement, i));
+        } else if(type == SQLITE_FLOAT) {
+          column.numericValues.push_back(
+            sqlite3_column_double(sqlStatement, i));
+          column.isInteger = false;
+        } else {
+          column.numericValues.push_back(
+            std::numeric_limits<double>::quiet_NaN());
+          column.isInteger = false;
+        }
+      } else {
+        const unsigned char *text = sqlite3_column_text(sqlStatement, i);
+        column.textValues.emplace_back(
+          text != nullptr ? reinterpret_cast<const char *>(text) : "");
+      }
+    }
+  }
+  sqlite3_finalize(sqlStatement);
+
+  if(rc != SQLITE_DONE) {
+    this->printErr(sqlite3_errmsg(this->db_));
+    return 0;
+  }
+
+  for(auto &column : result)
+    column.isInteger = column.isNumeric && column.isInteger;
+
+  this->printMsg("Querying database (#rows: " + std::to_string(nRows) + ")",
+                 1, timer.getElapsedTime());
+
+  return 1;
+#else
+  this->printErr("This filter requires Sqlite3");
+  return 0;
+#endif
+}
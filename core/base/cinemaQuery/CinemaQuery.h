@@ -7,6 +7,11 @@
 ///
 /// %CinemaQuery is a TTK processing package that generates a temporary SQLite3
 /// Database to perform a SQL query which is returned as a CSV String
+///
+/// Alternatively, the database can be kept alive across several queries
+/// (openDatabase, loadTable, updateIndices, query), in which case the tables
+/// are filled with prepared statements and the query results are returned as
+/// typed columns.
 
 #pragma once
 
@@ -15,12 +20,29 @@
 #include <string>
 #include <vector>
 
+struct sqlite3;
+
 namespace ttk {
   class CinemaQuery : virtual public Debug {
   public:
     CinemaQuery();
     ~CinemaQuery();
 
+    // the database handle is owned (closed on destruction)
+    CinemaQuery(const CinemaQuery &) = delete;
+    CinemaQuery &operator=(const CinemaQuery &) = delete;
+
+    /** Column of a table, either numeric (numericValues, isInteger if all
+     *  the values are integers) or text (textValues).
+     */
+    struct Column {
+      std::string name{};
+      bool isNumeric{true};
+      bool isInteger{false};
+      std::vector<double> numericValues{};
+      std::vector<std::string> textValues{};
+    };
+
     /** Creates a temporary database based on a SQL table definition and
      *  and table content to subsequentually return a query result.
      */
@@ -30,5 +52,39 @@ namespace ttk {
                 std::stringstream &resultCSV,
                 int &csvNColumns,
                 int &csvNRows) const;
+
+    /** Opens a new (empty) in-memory database, kept alive until
+     *  closeDatabase() or destruction.
+     */
+    int openDatabase();
+    int closeDatabase();
+    inline bool hasDatabase() const {
+      return this->db_ != nullptr;
+    }
+
+    /** Creates the table tableName in the database and fills it with the
+     *  given columns (of equal sizes).
+     */
+    int loadTable(const std::string &tableName,
+                  const std::vector<Column> &columns);
+
+    /** Creates an index on every column of the loaded tables whose name is
+     *  in columnNames, and drops the indices of the other columns.
+     */
+    int updateIndices(const std::vector<std::string> &columnNames);
+
+    /** Runs a SQL query on the database, returning the result as typed
+     *  columns.
+     */
+    int query(const std::string &sqlQuery,
+              std::vector<Column> &result,
+              int &nRows) const;
+
+  protected:
+    sqlite3 *db_{nullptr};
+    // columns of the loaded tables
+    std::vector<std::pair<std::string, std::vector<std::string>>> tables_{};
+    // existing indices (index name, table name, column name)
+    std::vector<std::vector<std::string>> indices_{};
   };
-} // namespace ttk
\ No newline at end of file
+} // namespace ttk
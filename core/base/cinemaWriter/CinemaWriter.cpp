@@ -0,0 +1,355 @@
+#include <CinemaWriter.h>
+
+#include <boost/interprocess/sync/file_lock.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+  // serializes the index accesses of the threads of this process (file
+  // locks only exclude other processes)
+  std::mutex &getIndexMutex() {
+    static std::mutex indexMutex;
+    return indexMutex;
+  }
+
+  std::vector<std::string> splitLine(const std::string &line) {
+    std::vector<std::string> cells;
+    size_t start = 0;
+    while(true) {
+      const size_t end = line.find(',', start);
+      cells.emplace_back(line.substr(start, end - start));
+      if(end == std::string::npos)
+        break;
+      start = end + 1;
+    }
+    return cells;
+  }
+
+  std::string joinLine(const std::vector<std::string> &cells) {
+    std::string line;
+    for(size_t i = 0; i < cells.size(); i++) {
+      if(i > 0)
+        line += ",";
+      line += cells[i];
+    }
+    return line;
+  }
+} // namespace
+
+ttk::CinemaWriter::CinemaWriter() {
+  this->setDebugMsgPrefix("CinemaWriter");
+}
+
+ttk::CinemaWriter::~CinemaWriter() {
+  this->flushProducts();
+  this->stopWorkers();
+}
+
+int ttk::CinemaWriter::startWorkers(const int nWorkers) {
+  if(this->workers_.size() == (size_t)nWorkers)
+    return 1;
+
+  this->stopWorkers();
+
+  this->stopWorkers_ = false;
+  for(int i = 0; i < nWorkers; i++)
+    this->workers_.emplace_back(&CinemaWriter::processProducts, this);
+
+  return 1;
+}
+
+int ttk::CinemaWriter::stopWorkers() {
+  {
+    std::lock_guard<std::mutex> lock(this->queueMutex_);
+    this->stopWorkers_ = true;
+  }
+  this->queueCondition_.notify_all();
+
+  for(auto &worker : this->workers_)
+    worker.join();
+  this->workers_.clear();
+
+  return 1;
+}
+
+void ttk::CinemaWriter::processProducts() {
+  while(true) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(this->queueMutex_);
+      this->queueCondition_.wait(
+        lock, [this] { return this->stopWorkers_ || !this->queue_.empty(); });
+      if(this->queue_.empty())
+        return;
+      job = std::move(this->queue_.front());
+      this->queue_.pop_front();
+      this->nActiveJobs_++;
+    }
+    this->doneCondition_.notify_all();
+
+    job();
+
+    {
+      std::lock_guard<std::mutex> lock(this->queueMutex_);
+      this->nActiveJobs_--;
+    }
+    this->doneCondition_.notify_all();
+  }
+}
+
+int ttk::CinemaWriter::enqueueProduct(const std::string &databasePath,
+                                      const IndexRow &row,
+                                      const std::function<int()> &write) {
+  const int nWorkers = std::max(this->threadNumber_, 1);
+  if(this->workers_.size() != (size_t)nWorkers) {
+    this->flushProducts();
+    this->startWorkers(nWorkers);
+  }
+
+  const std::string productPath = databasePath + "/" + row.productPath;
+
+  auto job = [this, databasePath, row, write, productPath]() {
+    const int status = write();
+
+    std::vector<IndexRow> batch;
+    {
+      std::lock_guard<std::mutex> lock(this->pendingRowsMutex_);
+      this->inFlightProducts_.erase(
+        this->inFlightProducts_.find(productPath));
+      if(status != 1) {
+        this->failure_ = true;
+        return;
+      }
+      auto &rows = this->pendingRows_[databasePath];
+      rows.emplace_back(row);
+      if(rows.size() >= (size_t)std::max(this->indexBatchSize_, 1))
+        batch.swap(rows);
+    }
+
+    if(!batch.empty() && !this->appendIndexRows(databasePath, batch)) {
+      std::lock_guard<std::mutex> lock(this->pendingRowsMutex_);
+      this->failure_ = true;
+    }
+  };
+
+  {
+    std::unique_lock<std::mutex> lock(this->queueMutex_);
+    // bounded queue, and no concurrent writes of the same product
+    this->doneCondition_.wait(lock, [this, &productPath] {
+      std::lock_guard<std::mutex> rowsLock(this->pendingRowsMutex_);
+      return this->queue_.size() < 2 * this->workers_.size()
+             && this->inFlightProducts_.count(productPath) == 0;
+    });
+    {
+      std::lock_guard<std::mutex> rowsLock(this->pendingRowsMutex_);
+      this->inFlightProducts_.insert(productPath);
+    }
+    this->queue_.emplace_back(job);
+  }
+  this->queueCondition_.notify_one();
+
+  return 1;
+}
+
+int ttk::CinemaWriter::flushProducts() {
+  {
+    std::unique_lock<std::mutex> lock(this->queueMutex_);
+    this->doneCondition_.wait(lock, [this] {
+      return this->queue_.empty() && this->nActiveJobs_ == 0;
+    });
+  }
+
+  std::map<std::string, std::vector<IndexRow>> pendingRows;
+  bool failure = false;
+  {
+    std::lock_guard<std::mutex> lock(this->pendingRowsMutex_);
+    pendingRows.swap(this->pendingRows_);
+    failure = this->failure_;
+    this->failure_ = false;
+  }
+
+  for(const auto &database : pendingRows)
+    if(!database.second.empty()
+       && !this->appendIndexRows(database.first, database.second))
+      failure = true;
+
+  return failure ? 0 : 1;
+}
+
+int ttk::CinemaWriter::withIndexLock(
+  const std::string &databasePath,
+  const std::function<int()> &function) const {
+
+  std::lock_guard<std::mutex> guard(getIndexMutex());
+
+  // boost file locks require an existing file
+  const std::string lockPath = databasePath + "/data.csv.lock";
+  {
+    std::ofstream lockFile(lockPath.data(), std::ios::app);
+    if(!lockFile.is_open()) {
+      this->printErr("Unable to create '" + lockPath + "'.");
+      return 0;
+    }
+  }
+
+  try {
+    boost::interprocess::file_lock fileLock(lockPath.data());
+    boost::interprocess::scoped_lock<boost::interprocess::file_lock> lock(
+      fileLock);
+    return function();
+  } catch(boost::interprocess::interprocess_exception &e) {
+    this->printErr("Unable to lock the database index ("
+                   + std::string(e.what()) + ").");
+    return 0;
+  }
+}
+
+int ttk::CinemaWriter::appendIndexRows(
+  const std::string &databasePath, const std::vector<IndexRow> &rows) const {
+
+  if(rows.empty())
+    return 1;
+
+  return this->withIndexLock(databasePath, [&]() {
+    const std::string csvPath = databasePath + "/data.csv";
+
+    // -------------------------------------------------------------------------
+    // Read (or create) the header
+    // -------------------------------------------------------------------------
+    std::vector<std::string> lines;
+    {
+      std::ifstream csvFile(csvPath.data());
+      std::string line;
+      while(std::getline(csvFile, line))
+        if(!line.empty())
+          lines.emplace_back(line);
+    }
+
+    const bool newFile = lines.empty();
+    if(newFile) {
+      auto header = rows[0].fields;
+      header.emplace_back("FILE");
+      lines.emplace_back(joinLine(header));
+    }
+
+    const auto header = splitLine(lines[0]);
+    const size_t fileColumn
+      = std::find(header.begin(), header.end(), "FILE") - header.begin();
+    if(fileColumn == header.size()) {
+      this->printErr("'data.csv' file has no 'FILE' column");
+      return 0;
+    }
+
+    // key of a row: all the columns but FILE
+    auto getKey = [&fileColumn](const std::vector<std::string> &cells) {
+      std::string key;
+      for(size_t j = 0; j < cells.size(); j++)
+        if(j != fileColumn)
+          key += cells[j] + ",";
+      return key;
+    };
+
+    // -------------------------------------------------------------------------
+    // New rows, in the column order of the header
+    // -------------------------------------------------------------------------
+    int status = 1;
+    std::vector<std::vector<std::string>> newRows;
+    std::map<std::string, size_t> newKeys;
+    for(const auto &row : rows) {
+      if(row.fields.size() + 1 != header.size()) {
+        this->printErr("'data.csv' file columns do not match the field data "
+                       "of product '"
+                       + row.productPath + "'.");
+        status = 0;
+        continue;
+      }
+
+      std::vector<std::string> cells(header.size());
+      bool valid = true;
+      for(size_t j = 0; j < row.fields.size(); j++) {
+        const size_t column
+          = std::find(header.begin(), header.end(), row.fields[j])
+            - header.begin();
+        if(column == header.size() || column == fileColumn) {
+          this->printErr("Data product has field data array '" + row.fields[j]
+                         + "' not recorded in the data.csv file.");
+          valid = false;
+          break;
+        }
+        cells[column] = row.values[j];
+      }
+      if(!valid) {
+        status = 0;
+        continue;
+      }
+      cells[fileColumn] = row.productPath;
+
+      const auto key = getKey(cells);
+      const auto it = newKeys.find(key);
+      if(it != newKeys.end()) {
+        // replaced within the batch
+        auto &previousPath = newRows[it->second][fileColumn];
+        if(previousPath != row.productPath)
+          remove((databasePath + "/" + previousPath).data());
+        newRows[it->second] = cells;
+      } else {
+        newKeys[key] = newRows.size();
+        newRows.emplace_back(cells);
+      }
+    }
+
+    // -------------------------------------------------------------------------
+    // Remove the existing rows with the same keys
+    // -------------------------------------------------------------------------
+    std::vector<std::string> keptLines{lines[0]};
+    bool removedRows = false;
+    for(size_t i = 1; i < lines.size(); i++) {
+      const auto cells = splitLine(lines[i]);
+      if(cells.size() == header.size()) {
+        const auto it = newKeys.find(getKey(cells));
+        if(it != newKeys.end()) {
+          if(cells[fileColumn] != newRows[it->second][fileColumn])
+            remove((databasePath + "/" + cells[fileColumn]).data());
+          removedRows = true;
+          continue;
+        }
+      }
+      keptLines.emplace_back(lines[i]);
+    }
+
+    // -------------------------------------------------------------------------
+    // Append the new rows (or rewrite the file if rows were removed)
+    // -------------------------------------------------------------------------
+    if(newFile || removedRows) {
+      const std::string tmpPath = csvPath + ".tmp";
+      {
+        std::ofstream csvFile(tmpPath.data());
+        if(!csvFile.is_open()) {
+          this->printErr("Unable to write '" + tmpPath + "'.");
+          return 0;
+        }
+        for(const auto &line : keptLines)
+          csvFile << line << "\n";
+        for(const auto &cells : newRows)
+          csvFile << joinLine(cells) << "\n";
+      }
+      if(std::rename(tmpPath.data(), csvPath.data()) != 0) {
+        this->printErr("Unable to update 'data.csv' file.");
+        return 0;
+      }
+    } else {
+      std::ofstream csvFile(csvPath.data(), std::ios::app);
+      if(!csvFile.is_open()) {
+        this->printErr("Unable to open 'data.csv' file.");
+        return 0;
+      }
+      for(const auto &cells : newRows)
+        csvFile << joinLine(cells) << "\n";
+    }
+
+    return status;
+  });
+}
@@ -0,0 +1,103 @@
+/// \ingroup base
+/// \class ttk::CinemaWriter
+/// \date October 2026.
+///
+/// \brief TTK %cinemaWriter processing package.
+///
+/// %CinemaWriter is a TTK processing package that writes data products of a
+/// Cinema Spec D database asynchronously: products are queued to a pool of
+/// background writer threads (see enqueueProduct()), and the rows of the
+/// written products are appended to the data.csv index of the database in
+/// batches (see appendIndexRows()).
+///
+/// All the accesses to the index go through withIndexLock(), which holds
+/// both a process-wide mutex and an inter-process lock on the database, so
+/// that several writers (threads or processes) can update the same database
+/// concurrently.
+///
+/// \sa ttkCinemaWriter.cpp %for a usage example.
+
+#pragma once
+
+// base code includes
+#include <Debug.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ttk {
+
+  class CinemaWriter : virtual public Debug {
+
+  public:
+    /// Row of the data.csv index of a database.
+    struct IndexRow {
+      std::vector<std::string> fields{};
+      std::vector<std::string> values{};
+      // path of the product, relative to the database
+      std::string productPath{};
+    };
+
+    CinemaWriter();
+    ~CinemaWriter();
+
+    inline void setIndexBatchSize(const int size) {
+      this->indexBatchSize_ = size;
+    }
+
+    /// Queues the writing of a data product to the writer pool (started
+    /// with threadNumber_ threads). Once write() succeeded (returned 1),
+    /// the index row of the product is appended to the data.csv file of
+    /// the database (by batches of indexBatchSize_ rows). Blocks while too
+    /// many products are already waiting to be written.
+    int enqueueProduct(const std::string &databasePath,
+                       const IndexRow &row,
+                       const std::function<int()> &write);
+
+    /// Waits until all the queued products are written and appends the
+    /// remaining index rows. Returns 0 if any product or index update
+    /// failed since the last call.
+    int flushProducts();
+
+    /// Appends rows to the data.csv file of a database (created if
+    /// needed). Existing rows with the same keys as new rows are removed,
+    /// together with their products (if the product path differs).
+    int appendIndexRows(const std::string &databasePath,
+                        const std::vector<IndexRow> &rows) const;
+
+    /// Runs function while holding the process-wide and the inter-process
+    /// lock of the index of the database.
+    int withIndexLock(const std::string &databasePath,
+                      const std::function<int()> &function) const;
+
+  protected:
+    int startWorkers(const int nWorkers);
+    int stopWorkers();
+    void processProducts();
+
+    int indexBatchSize_{64};
+
+    // writer pool
+    std::vector<std::thread> workers_{};
+    std::deque<std::function<void()>> queue_{};
+    std::mutex queueMutex_{};
+    std::condition_variable queueCondition_{};
+    std::condition_variable doneCondition_{};
+    size_t nActiveJobs_{0};
+    bool stopWorkers_{false};
+
+    // index rows of the written products, per database
+    std::map<std::string, std::vector<IndexRow>> pendingRows_{};
+    // products being written (not written concurrently twice)
+    std::set<std::string> inFlightProducts_{};
+    std::mutex pendingRowsMutex_{};
+    bool failure_{false};
+  };
+} // namespace ttk
@@ -1,5 +1,12 @@
 #include <Debug.h>
 
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <thread>
+
 ttk::debug::LineMode ttk::Debug::lastLineMode = ttk::debug::LineMode::NEW;
 
 bool ttk::welcomeMsg_ = true;
@@ -9,6 +16,163 @@ int ttk::globalDebugLevel_ = 0;
 using namespace std;
 using namespace ttk;
 
+namespace {
+
+  struct TraceEvent {
+    string category;
+    string name;
+    double start; // microseconds
+    double duration; // microseconds
+    int thread;
+    float peakMemory; // MB
+    float peakMemoryIncrease; // MB
+  };
+
+  // process-wide recorder of the spans, written at exit
+  class Tracer {
+  public:
+    Tracer() : origin_{chrono::steady_clock::now()} {
+      const char *path = getenv("TTK_TRACE_FILE");
+      if(path != nullptr && path[0] != '\0')
+        path_ = path;
+    }
+
+    ~Tracer() {
+      write();
+    }
+
+    inline bool enabled() const {
+      return !path_.empty();
+    }
+
+    inline double now() const {
+      return chrono::duration<double, micro>(chrono::steady_clock::now()
+                                             - origin_)
+        .count();
+    }
+
+    void record(TraceEvent &&event) {
+      lock_guard<mutex> lock(mutex_);
+      const auto id = this_thread::get_id();
+      const auto it = threads_.find(id);
+      if(it == threads_.end()) {
+        event.thread = threads_.size();
+        threads_[id] = event.thread;
+      } else {
+        event.thread = it->second;
+      }
+      events_.emplace_back(std::move(event));
+    }
+
+    int write() {
+      if(!enabled())
+        return 0;
+
+      lock_guard<mutex> lock(mutex_);
+      ofstream file(path_.data(), ios::out);
+      if(!file.is_open())
+        return 0;
+
+      file << "{\"traceEvents\":[";
+      for(size_t i = 0; i < events_.size(); i++) {
+        const auto &e = events_[i];
+        file << (i > 0 ? ",\n" : "\n") << "{\"name\":\"" << escape(e.name)
+             << "\",\"cat\":\"" << escape(e.category)
+             << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << e.thread
+             << ",\"ts\":" << fixed << setprecision(3) << e.start
+             << ",\"dur\":" << e.duration
+             << ",\"args\":{\"peakMemoryMB\":" << setprecision(1)
+             << e.peakMemory << ",\"peakMemoryIncreaseMB\":"
+             << e.peakMemoryIncrease << "}}";
+      }
+      file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+      return file.good() ? 1 : 0;
+    }
+
+  private:
+    static string escape(const string &str) {
+      string escaped;
+      for(const char c : str) {
+        if(c == '"' || c == '\\')
+          escaped += '\\';
+        if(static_cast<unsigned char>(c) >= 0x20)
+          escaped += c;
+      }
+      return escaped;
+    }
+
+    string path_{};
+    chrono::steady_clock::time_point origin_;
+    mutex mutex_{};
+    vector<TraceEvent> events_{};
+    map<thread::id, int> threads_{};
+  };
+
+  Tracer &getTracer() {
+    static Tracer tracer;
+    return tracer;
+  }
+
+  // read once, so that the spans cost a single test when tracing is off
+  const bool tracingEnabled = getTracer().enabled();
+
+} // namespace
+
+bool debug::isTracingEnabled() {
+  return tracingEnabled;
+}
+
+int debug::writeTrace() {
+  return getTracer().write();
+}
+
+debug::TraceSpan::TraceSpan(const char *category, const char *name) {
+  if(!tracingEnabled)
+    return;
+
+  name_ = name;
+  begin(category);
+}
+
+debug::TraceSpan::TraceSpan(const char *category, const string &name) {
+  if(!tracingEnabled)
+    return;
+
+  name_ = name;
+  begin(category);
+}
+
+void debug::TraceSpan::begin(const char *category) {
+  active_ = true;
+  category_ = category;
+  startPeakMemory_ = OsCall::getMemoryPeakUsage();
+  start_ = getTracer().now();
+}
+
+debug::TraceSpan::TraceSpan(TraceSpan &&other)
+  : active_{other.active_}, category_{std::move(other.category_)},
+    name_{std::move(other.name_)}, start_{other.start_},
+    startPeakMemory_{other.startPeakMemory_} {
+  other.active_ = false;
+}
+
+debug::TraceSpan::~TraceSpan() {
+  end();
+}
+
+void debug::TraceSpan::end() {
+  if(!active_)
+    return;
+  active_ = false;
+
+  auto &tracer = getTracer();
+  const double end = tracer.now();
+  const float peakMemory = OsCall::getMemoryPeakUsage();
+  tracer.record({std::move(category_), std::move(name_), start_, end - start_,
+                 0, peakMemory, peakMemory - startPeakMemory_});
+}
+
 Debug::Debug() {
 
   setDebugMsgPrefix("Debug");
@@ -19,6 +19,12 @@
 /// %Debug provides a few mechanisms to handle debugging messages at a global
 /// and local scope, time and memory measurements, etc.
 /// Each ttk class should inheritate from it.
+///
+/// Processing phases can also be traced with scoped spans (see
+/// debug::TraceSpan). When the TTK_TRACE_FILE environment variable is set, the
+/// spans (name, thread, wall time and peak memory usage) are written to this
+/// file at exit, in the Chrome trace event format (chrome://tracing,
+/// Perfetto), so that runs can be compared across versions.
 
 #ifndef _DEBUG_H
 #define _DEBUG_H
@@ -82,6 +88,41 @@ namespace ttk {
     } // namespace output
 
     const int LINEWIDTH = 80;
+
+    /// Returns true if the spans are recorded (TTK_TRACE_FILE set).
+    bool isTracingEnabled();
+
+    /// Writes the spans recorded so far to the trace file (also done at
+    /// exit). Returns 1 upon success, 0 otherwise.
+    int writeTrace();
+
+    /// Scoped span of a trace: recorded from its construction to its
+    /// destruction (or to the call to end()), if tracing is enabled.
+    /// The names are only copied when tracing is enabled. A default
+    /// constructed span records nothing.
+    class TraceSpan {
+    public:
+      TraceSpan() = default;
+      TraceSpan(const char *category, const char *name);
+      TraceSpan(const char *category, const std::string &name);
+      TraceSpan(TraceSpan &&other);
+      ~TraceSpan();
+
+      TraceSpan(const TraceSpan &) = delete;
+      TraceSpan &operator=(const TraceSpan &) = delete;
+
+      void end();
+
+    private:
+      void begin(const char *category);
+
+      bool active_{false};
+      std::string category_{};
+      std::string name_{};
+      // microseconds since the start of the trace
+      double start_{};
+      float startPeakMemory_{};
+    };
   }; // namespace debug
 
   class Debug : public BaseClass {
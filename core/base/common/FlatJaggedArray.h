@@ -0,0 +1,123 @@
+/// \ingroup base
+/// \class ttk::FlatJaggedArray
+/// \date October 2026.
+///
+/// \brief Compact (CSR-like) storage for jagged arrays of identifiers.
+///
+/// %FlatJaggedArray stores a list of variable-sized identifier lists into
+/// two flat buffers: an offset buffer (one entry per list, plus one) and a
+/// data buffer (the concatenation of all the lists). Compared to a
+/// std::vector<std::vector<SimplexId>>, this avoids one heap allocation per
+/// list and keeps the neighbors of consecutive simplices contiguous in memory.
+///
+/// \sa ttk::ExplicitTriangulation
+
+#ifndef _FLATJAGGEDARRAY_H
+#define _FLATJAGGEDARRAY_H
+
+#include <DataTypes.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace ttk {
+
+  class FlatJaggedArray {
+
+  public:
+    /// Light-weight, non-owning view on one of the lists (span-like).
+    class Slice {
+    public:
+      Slice(const SimplexId *begin, const SimplexId *end)
+        : begin_{begin}, end_{end} {
+      }
+
+      inline const SimplexId *begin() const {
+        return begin_;
+      }
+      inline const SimplexId *end() const {
+        return end_;
+      }
+      inline SimplexId size() const {
+        return end_ - begin_;
+      }
+      inline bool empty() const {
+        return begin_ == end_;
+      }
+      inline const SimplexId &operator[](const SimplexId &i) const {
+        return begin_[i];
+      }
+
+    private:
+      const SimplexId *begin_;
+      const SimplexId *end_;
+    };
+
+    /// Number of lists stored.
+    inline SimplexId size() const {
+      return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+
+    inline bool empty() const {
+      return offsets_.empty();
+    }
+
+    /// Get a view on the \p id-th list.
+    inline Slice operator[](const SimplexId &id) const {
+      return Slice{data_.data() + offsets_[id], data_.data() + offsets_[id + 1]};
+    }
+
+    inline void clear() {
+      std::vector<size_t>{}.swap(offsets_);
+      std::vector<SimplexId>{}.swap(data_);
+    }
+
+    /// Fill the compact storage from a jagged std::vector.
+    inline void fillFrom(const std::vector<std::vector<SimplexId>> &src) {
+      offsets_.resize(src.size() + 1);
+      offsets_[0] = 0;
+      for(size_t i = 0; i < src.size(); i++) {
+        offsets_[i + 1] = offsets_[i] + src[i].size();
+      }
+      data_.resize(offsets_.back());
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < src.size(); i++) {
+        std::copy(src[i].begin(), src[i].end(), data_.begin() + offsets_[i]);
+      }
+    }
+
+    /// Expand the compact storage into a jagged std::vector (for the
+    /// procedures that still consume this legacy representation).
+    inline void copyTo(std::vector<std::vector<SimplexId>> &dst) const {
+      dst.resize(size());
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+      for(SimplexId i = 0; i < size(); i++) {
+        dst[i].assign(data_.begin() + offsets_[i], data_.begin() + offsets_[i + 1]);
+      }
+    }
+
+    /// Memory footprint of the compact storage, in bytes.
+    inline size_t footprint() const {
+      return offsets_.size() * sizeof(size_t)
+             + data_.size() * sizeof(SimplexId);
+    }
+
+    inline void setThreadNumber(const int threadNumber) {
+      threadNumber_ = threadNumber;
+    }
+
+  private:
+    int threadNumber_{1};
+    // offsets_[i] is the position of the i-th list into data_ (64-bit, the
+    // total number of items may exceed the range of SimplexId)
+    std::vector<size_t> offsets_{};
+    std::vector<SimplexId> data_{};
+  };
+
+} // namespace ttk
+
+#endif // _FLATJAGGEDARRAY_H
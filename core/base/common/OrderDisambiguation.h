@@ -0,0 +1,439 @@
+/// \ingroup base
+/// \date October 2026.
+///
+/// \brief Global (Simulation of Simplicity) vertex order of a scalar field.
+///
+/// The order array stores, for each vertex, its rank in the sequence of
+/// vertices sorted by increasing scalar value, ties being broken by the
+/// offset field (or by the vertex identifier if no offset field is given).
+/// Comparing two vertices then reduces to comparing two integers, and the
+/// array can be computed once and shared by all the modules processing the
+/// same scalar field.
+///
+/// The vertices are sorted with a parallel, stable radix sort, where the key
+/// of a vertex is an unsigned integer with the same ordering as its scalar
+/// value. The vertex identifiers are first partitioned in place by the most
+/// significant digits of their key, until each bucket fits in a small chunk
+/// that is then sorted as (key, vertex) pairs by an LSD radix sort. This
+/// bounds the transient memory to one identifier per vertex plus a few
+/// chunks per thread. The offset field is taken into account by first
+/// sorting the vertices by offset, the stability of the radix sort then
+/// preserving this order among vertices of equal scalar value.
+///
+/// \sa ttk::ftm::FTMTree_MT
+/// \sa ttk::dcg::DiscreteGradient
+
+#ifndef _ORDERDISAMBIGUATION_H
+#define _ORDERDISAMBIGUATION_H
+
+#include <DataTypes.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef TTK_ENABLE_OPENMP
+#include <omp.h>
+#endif // TTK_ENABLE_OPENMP
+
+namespace ttk {
+
+  namespace orderDisambiguation {
+
+    /// Unsigned integer type large enough to hold the radix key of T.
+    template <typename T>
+    using keyType = typename std::
+      conditional<(sizeof(T) <= sizeof(uint32_t)), uint32_t, uint64_t>::type;
+
+    /// Map a floating-point value onto an unsigned integer with the same
+    /// ordering (flip the sign bit of positive values, all the bits of
+    /// negative values).
+    template <typename T>
+    inline typename std::enable_if<std::is_floating_point<T>::value,
+                                   keyType<T>>::type
+      getKey(T value) {
+      using K = keyType<T>;
+      static_assert(sizeof(T) == sizeof(K), "unsupported floating-point type");
+      // -0.0 and 0.0 compare equal: give them the same key
+      if(value == T{0}) {
+        value = T{0};
+      }
+      K bits;
+      std::memcpy(&bits, &value, sizeof(K));
+      const K signBit = K{1} << (8 * sizeof(K) - 1);
+      return (bits & signBit) ? ~bits : (bits | signBit);
+    }
+
+    /// Map a signed integer onto an unsigned integer with the same ordering
+    /// (flip the sign bit).
+    template <typename T>
+    inline typename std::enable_if<std::is_integral<T>::value
+                                     && std::is_signed<T>::value,
+                                   keyType<T>>::type
+      getKey(const T value) {
+      using K = keyType<T>;
+      return static_cast<K>(static_cast<int64_t>(value))
+             ^ (K{1} << (8 * sizeof(K) - 1));
+    }
+
+    template <typename T>
+    inline typename std::enable_if<std::is_integral<T>::value
+                                     && !std::is_signed<T>::value,
+                                   keyType<T>>::type
+      getKey(const T value) {
+      return static_cast<keyType<T>>(value);
+    }
+
+    /**
+     * @brief Stable, parallel LSD radix sort of (key, vertex) pairs
+     *
+     * Digits are 8-bit wide. Each thread histograms then scatters its own
+     * contiguous chunk of the input, which keeps the sort stable. Passes
+     * over a digit shared by all the keys are skipped.
+     *
+     * @param[in,out] data Pairs to sort by increasing key
+     * @param[in] nThreads Number of threads
+     * @param[in] nPasses Number of (least significant) digits to sort, the
+     * other ones being shared by all the keys
+     */
+    template <typename K>
+    inline void radixSort(std::vector<std::pair<K, SimplexId>> &data,
+                          int nThreads,
+                          const size_t nPasses = sizeof(K)) {
+
+      constexpr int bucketNumber = 256;
+      const size_t n = data.size();
+
+#ifdef TTK_ENABLE_OPENMP
+      // do not spawn threads for tiny chunks
+      nThreads = std::max(1, std::min<int>(nThreads, n / 65536));
+#else
+      nThreads = 1;
+#endif // TTK_ENABLE_OPENMP
+
+      std::vector<std::pair<K, SimplexId>> buffer(n);
+      std::vector<size_t> histograms(nThreads * bucketNumber);
+
+      for(size_t pass = 0; pass < nPasses; ++pass) {
+        const int shift = 8 * pass;
+
+        std::fill(histograms.begin(), histograms.end(), 0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+        {
+#ifdef TTK_ENABLE_OPENMP
+          const int tid = omp_get_thread_num();
+#else
+          const int tid = 0;
+#endif // TTK_ENABLE_OPENMP
+          const size_t begin = n * tid / nThreads;
+          const size_t end = n * (tid + 1) / nThreads;
+          size_t *const hist = &histograms[tid * bucketNumber];
+          for(size_t i = begin; i < end; ++i) {
+            hist[(data[i].first >> shift) & 0xFF]++;
+          }
+        }
+
+        // skip this pass if every key has the same digit
+        bool trivial = false;
+        for(int d = 0; d < bucketNumber; ++d) {
+          size_t count = 0;
+          for(int t = 0; t < nThreads; ++t) {
+            count += histograms[t * bucketNumber + d];
+          }
+          if(count == n) {
+            trivial = true;
+          }
+          if(count != 0) {
+            break;
+          }
+        }
+        if(trivial) {
+          continue;
+        }
+
+        // exclusive prefix sum in (digit, thread) order
+        size_t sum = 0;
+        for(int d = 0; d < bucketNumber; ++d) {
+          for(int t = 0; t < nThreads; ++t) {
+            const size_t count = histograms[t * bucketNumber + d];
+            histograms[t * bucketNumber + d] = sum;
+            sum += count;
+          }
+        }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+        {
+#ifdef TTK_ENABLE_OPENMP
+          const int tid = omp_get_thread_num();
+#else
+          const int tid = 0;
+#endif // TTK_ENABLE_OPENMP
+          const size_t begin = n * tid / nThreads;
+          const size_t end = n * (tid + 1) / nThreads;
+          size_t *const positions = &histograms[tid * bucketNumber];
+          for(size_t i = begin; i < end; ++i) {
+            buffer[positions[(data[i].first >> shift) & 0xFF]++] = data[i];
+          }
+        }
+
+        data.swap(buffer);
+      }
+    }
+
+    /// Size of the buckets sorted as (key, vertex) pairs.
+    constexpr size_t chunkSize = 1 << 20;
+
+    /**
+     * @brief Stable, parallel MSD radix sort of vertex identifiers
+     *
+     * The identifiers are partitioned by the digit of rank level (from the
+     * most significant one), through the temporary array tmp. Buckets
+     * larger than chunkSize are partitioned again by the next digit, using
+     * all the threads, while smaller buckets are sorted in parallel, one
+     * per thread, by radixSort on their remaining digits.
+     *
+     * @param[in,out] ids Vertex identifiers to sort by increasing key
+     * @param[out] tmp Temporary array of (at least) n identifiers
+     * @param[in] n Number of identifiers
+     * @param[in] level Rank of the digit to partition by
+     * @param[in] getVertexKey Key of a vertex
+     * @param[in] nThreads Number of threads
+     */
+    template <typename K, typename KeyFunction>
+    inline void msdRadixSort(SimplexId *const ids,
+                             SimplexId *const tmp,
+                             const size_t n,
+                             const size_t level,
+                             const KeyFunction &getVertexKey,
+                             const int nThreads) {
+
+      if(level == sizeof(K)) {
+        // equal keys, already in stable order
+        return;
+      }
+
+      if(n <= chunkSize) {
+        std::vector<std::pair<K, SimplexId>> pairs(n);
+        for(size_t i = 0; i < n; ++i) {
+          pairs[i] = {getVertexKey(ids[i]), ids[i]};
+        }
+        radixSort(pairs, nThreads, sizeof(K) - level);
+        for(size_t i = 0; i < n; ++i) {
+          ids[i] = pairs[i].second;
+        }
+        return;
+      }
+
+      constexpr int bucketNumber = 256;
+      const int shift = 8 * (sizeof(K) - 1 - level);
+
+#ifdef TTK_ENABLE_OPENMP
+      // do not spawn threads for tiny chunks
+      const int nChunks = std::max(1, std::min<int>(nThreads, n / 65536));
+#else
+      const int nChunks = 1;
+#endif // TTK_ENABLE_OPENMP
+
+      std::vector<size_t> histograms(nChunks * bucketNumber, 0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nChunks)
+#endif // TTK_ENABLE_OPENMP
+      for(int c = 0; c < nChunks; ++c) {
+        size_t *const hist = &histograms[c * bucketNumber];
+        for(size_t i = n * c / nChunks; i < n * (c + 1) / nChunks; ++i) {
+          hist[(getVertexKey(ids[i]) >> shift) & 0xFF]++;
+        }
+      }
+
+      // bucket boundaries, and exclusive prefix sum in (digit, chunk) order
+      std::vector<size_t> bucketBegin(bucketNumber + 1, 0);
+      size_t sum = 0;
+      for(int d = 0; d < bucketNumber; ++d) {
+        bucketBegin[d] = sum;
+        for(int c = 0; c < nChunks; ++c) {
+          const size_t count = histograms[c * bucketNumber + d];
+          histograms[c * bucketNumber + d] = sum;
+          sum += count;
+        }
+      }
+      bucketBegin[bucketNumber] = n;
+
+      bool trivial = false;
+      for(int d = 0; d < bucketNumber; ++d) {
+        if(bucketBegin[d + 1] - bucketBegin[d] == n) {
+          trivial = true;
+        }
+      }
+
+      if(!trivial) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nChunks)
+#endif // TTK_ENABLE_OPENMP
+        for(int c = 0; c < nChunks; ++c) {
+          size_t *const positions = &histograms[c * bucketNumber];
+          for(size_t i = n * c / nChunks; i < n * (c + 1) / nChunks; ++i) {
+            tmp[positions[(getVertexKey(ids[i]) >> shift) & 0xFF]++] = ids[i];
+          }
+        }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nChunks)
+#endif // TTK_ENABLE_OPENMP
+        for(int c = 0; c < nChunks; ++c) {
+          std::copy(tmp + n * c / nChunks, tmp + n * (c + 1) / nChunks,
+                    ids + n * c / nChunks);
+        }
+      }
+
+      // large buckets: one after the other, with all the threads
+      for(int d = 0; d < bucketNumber; ++d) {
+        const size_t b = bucketBegin[d];
+        const size_t size = bucketBegin[d + 1] - b;
+        if(size > chunkSize) {
+          msdRadixSort<K>(
+            ids + b, tmp + b, size, level + 1, getVertexKey, nThreads);
+        }
+      }
+
+      // small buckets: one per thread
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+      for(int d = 0; d < bucketNumber; ++d) {
+        const size_t b = bucketBegin[d];
+        const size_t size = bucketBegin[d + 1] - b;
+        if(size > 1 && size <= chunkSize) {
+          msdRadixSort<K>(ids + b, tmp + b, size, level + 1, getVertexKey, 1);
+        }
+      }
+    }
+
+    /**
+     * @brief Stable, parallel radix sort of vertex identifiers by key
+     *
+     * @param[in,out] ids Vertex identifiers to sort by increasing key
+     * @param[in] n Number of identifiers
+     * @param[in] getVertexKey Key of a vertex
+     * @param[in] nThreads Number of threads
+     */
+    template <typename K, typename KeyFunction>
+    inline void sortByKey(SimplexId *const ids,
+                          const size_t n,
+                          const KeyFunction &getVertexKey,
+                          const int nThreads) {
+      std::vector<SimplexId> tmp(n > chunkSize ? n : 0);
+      msdRadixSort<K>(ids, tmp.data(), n, 0, getVertexKey, nThreads);
+    }
+
+  } // namespace orderDisambiguation
+
+  /**
+   * @brief Sort the vertices of a scalar field (Simulation of Simplicity)
+   *
+   * Vertices are sorted by increasing scalar value, ties being broken by
+   * increasing offset (or vertex identifier if no offset field is given).
+   * This matches the (scalar, offset) lexicographic comparators used across
+   * the base modules.
+   *
+   * @param[in] nVerts Number of vertices
+   * @param[in] scalars Scalar field values
+   * @param[in] offsets Offset field used to break ties (vertex identifiers
+   * are used if nullptr)
+   * @param[out] sortedVertices Sorted vertex identifiers (allocated by the
+   * caller)
+   * @param[in] nThreads Number of threads
+   */
+  template <typename scalarType, typename idType = SimplexId>
+  inline void sortVertices(const size_t nVerts,
+                           const scalarType *const scalars,
+                           const idType *const offsets,
+                           SimplexId *const sortedVertices,
+                           const int nThreads = 1) {
+
+    using orderDisambiguation::getKey;
+    using orderDisambiguation::keyType;
+    using orderDisambiguation::sortByKey;
+
+    // 1. vertex sequence sorted by offset
+    if(offsets == nullptr) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < nVerts; ++i) {
+        sortedVertices[i] = i;
+      }
+    } else {
+      // offsets are usually a permutation of [0, nVerts): invert it directly
+      std::vector<SimplexId> inverse(nVerts, -1);
+      bool isPermutation = std::is_integral<idType>::value;
+      for(size_t i = 0; isPermutation && i < nVerts; ++i) {
+        const auto o = offsets[i];
+        if(o < idType{0} || static_cast<size_t>(o) >= nVerts
+           || inverse[static_cast<size_t>(o)] != -1) {
+          isPermutation = false;
+        } else {
+          inverse[static_cast<size_t>(o)] = i;
+        }
+      }
+
+      if(isPermutation) {
+        std::copy(inverse.begin(), inverse.end(), sortedVertices);
+      } else {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+        for(size_t i = 0; i < nVerts; ++i) {
+          sortedVertices[i] = i;
+        }
+        sortByKey<keyType<idType>>(
+          sortedVertices, nVerts,
+          [offsets](const SimplexId v) { return getKey(offsets[v]); },
+          nThreads);
+      }
+    }
+
+    // 2. stable sort of this sequence by scalar value
+    sortByKey<keyType<scalarType>>(
+      sortedVertices, nVerts,
+      [scalars](const SimplexId v) { return getKey(scalars[v]); }, nThreads);
+  }
+
+  /**
+   * @brief Compute the global vertex order of a scalar field
+   *
+   * @param[in] nVerts Number of vertices
+   * @param[in] scalars Scalar field values
+   * @param[in] offsets Offset field used to break ties (vertex identifiers
+   * are used if nullptr)
+   * @param[out] order Rank of each vertex (allocated by the caller)
+   * @param[in] nThreads Number of threads
+   */
+  template <typename scalarType, typename idType = SimplexId>
+  inline void preconditionOrderArray(const size_t nVerts,
+                                     const scalarType *const scalars,
+                                     const idType *const offsets,
+                                     SimplexId *const order,
+                                     const int nThreads = 1) {
+
+    std::vector<SimplexId> sortedVertices(nVerts);
+    sortVertices(nVerts, scalars, offsets, sortedVertices.data(), nThreads);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < nVerts; ++i) {
+      order[sortedVertices[i]] = i;
+    }
+  }
+
+} // namespace ttk
+
+#endif // _ORDERDISAMBIGUATION_H
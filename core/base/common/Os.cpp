@@ -21,6 +21,7 @@
 #elif defined(__unix__) || defined(__APPLE__)
 
 #include <dirent.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -62,6 +63,37 @@ namespace ttk {
     return 0;
   }
 
+  float OsCall::getMemoryPeakUsage() {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+      // bytes
+      return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+      // kilobytes
+      return usage.ru_maxrss / 1024.0;
+#endif
+    }
+#endif
+    return 0;
+  }
+
+  float OsCall::getTotalMemory() {
+#ifdef _WIN32
+    MEMORYSTATUSEX status;
+    status.dwLength = sizeof(status);
+    if(GlobalMemoryStatusEx(&status))
+      return status.ullTotalPhys / (1024.0 * 1024.0);
+#elif defined(__unix__) || defined(__APPLE__)
+    const long pageNumber = sysconf(_SC_PHYS_PAGES);
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    if(pageNumber > 0 && pageSize > 0)
+      return (double)pageNumber * pageSize / (1024.0 * 1024.0);
+#endif
+    return 0;
+  }
+
   int OsCall::getNumberOfCores() {
 #ifdef TTK_ENABLE_OPENMP
     return omp_get_num_procs();
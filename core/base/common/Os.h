@@ -68,8 +68,14 @@ namespace ttk {
 
     static float getMemoryInstantUsage();
 
+    /// Peak resident set size of the process (in MB), 0 if unavailable.
+    static float getMemoryPeakUsage();
+
     static int getNumberOfCores();
 
+    /// Physical memory of the machine (in MB), 0 if unavailable.
+    static float getTotalMemory();
+
     static double getTimeStamp();
 
     static std::vector<std::string>
@@ -22,6 +22,8 @@
 #include <Triangulation.h>
 #include <Wrapper.h>
 
+#include <limits>
+
 namespace ttk {
 
   class ContinuousScatterPlot : public Debug {
@@ -40,6 +40,7 @@
 #endif
 
 #include <Geometry.h>
+#include <OrderDisambiguation.h>
 #include <Triangulation.h>
 #include <Wrapper.h>
 
@@ -34,24 +34,12 @@ namespace ttk {
       auto &sortedVect = scalars_->sortedVertices;
 
       if(!sortedVect.size()) {
-        auto indirect_sort = [&](const size_t &a, const size_t &b) {
-          return isLower<scalarType>(a, b);
-        };
-
         sortedVect.resize(nbVertices, 0);
-        iota(sortedVect.begin(), sortedVect.end(), 0);
 
-#ifdef TTK_ENABLE_OPENMP
-#ifdef _GLIBCXX_PARALLEL_FEATURES_H
-        // ensure this namespace exists
-        __gnu_parallel::sort(
-          sortedVect.begin(), sortedVect.end(), indirect_sort);
-#else
-        sort(sortedVect.begin(), sortedVect.end(), indirect_sort);
-#endif
-#else
-        sort(sortedVect.begin(), sortedVect.end(), indirect_sort);
-#endif
+        // parallel radix sort, ties broken by the SoS offsets
+        ttk::sortVertices(nbVertices, (scalarType *)scalars_->values,
+                          scalars_->sosOffsets.data(), sortedVect.data(),
+                          threadNumber_);
       }
 
       if(!scalars_->mirrorVertices.size()) {
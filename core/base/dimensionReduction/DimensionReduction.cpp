@@ -8,14 +8,43 @@
 #include <numpy/arrayobject.h>
 #endif
 
+#ifdef TTK_ENABLE_EIGEN
+#include <Eigen/Dense>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <tuple>
+
 using namespace std;
 using namespace ttk;
 
 DimensionReduction::DimensionReduction()
-  : numberOfRows_{0}, numberOfColumns_{0}, numberOfComponents_{0},
-    numberOfNeighbors_{0}, randomState_{0}, matrix_{nullptr},
-    embedding_{nullptr}, majorVersion_{'0'} {
+  : numberOfRows_{0}, numberOfColumns_{0}, method_{2},
+    backend_{DEFAULT_BACKEND}, numberOfComponents_{0}, numberOfNeighbors_{0},
+    randomState_{0}, matrix_{nullptr}, embedding_{nullptr}, majorVersion_{'0'} {
+}
+
+DimensionReduction::~DimensionReduction() {
+}
+
+bool DimensionReduction::isPythonFound() const {
+#ifdef TTK_ENABLE_SCIKIT_LEARN
+  return true;
+#else
+  return false;
+#endif
+}
+
+int DimensionReduction::initializePython() const {
 #ifdef TTK_ENABLE_SCIKIT_LEARN
+  // started on first use only, the native backend never needs it
+  if(majorVersion_ != '0')
+    return majorVersion_ < '3' ? -1 : 0;
+
   auto finalize_callback = []() { Py_Finalize(); };
 
   if(!Py_IsInitialized()) {
@@ -35,32 +64,26 @@ DimensionReduction::DimensionReduction()
   }
 
   majorVersion_ = version[0];
+  return majorVersion_ < '3' ? -1 : 0;
+#else
+  return -1;
 #endif
 }
 
-DimensionReduction::~DimensionReduction() {
-}
-
-bool DimensionReduction::isPythonFound() const {
-#ifdef TTK_ENABLE_SCIKIT_LEARN
-  return true;
-#else
-  stringstream msg;
-  msg << "[DimensionReduction] "
-      << "Warning: scikit-learn support disabled :(" << endl;
-  msg << "[DimensionReduction] "
-      << "Python/Numpy may not be installed properly." << endl;
-  msg << "[DimensionReduction] Features disabled..." << endl;
-  dMsg(cerr, msg.str(), fatalMsg);
-  return false;
-#endif
+bool DimensionReduction::isNativeMethod() const {
+  // MDS, t-SNE and PCA
+  return method_ == 2 or method_ == 3 or method_ == 5;
 }
 
 int DimensionReduction::execute() const {
+  if(backend_ == NATIVE)
+    return executeNative();
+
 #ifdef TTK_ENABLE_SCIKIT_LEARN
-#ifndef TTK_ENABLE_KAMIKAZE
-  if(majorVersion_ < '3')
+  if(initializePython())
     return -1;
+
+#ifndef TTK_ENABLE_KAMIKAZE
   if(modulePath_.length() <= 0)
     return -1;
   if(moduleName_.length() <= 0)
@@ -412,3 +435,698 @@ collect_garbage:
 
   return 0;
 }
+
+// -----------------------------------------------------------------------------
+// Native engine
+// -----------------------------------------------------------------------------
+
+namespace {
+
+#ifdef TTK_ENABLE_EIGEN
+  using RowMajorMatrix
+    = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  // Leading eigenpairs (by decreasing eigenvalue) of a symmetric matrix. For
+  // large positive semi-definite matrices, only the leading subspace is
+  // computed, with orthogonal (subspace) iterations.
+  void leadingEigenpairs(const Eigen::MatrixXd &A,
+                         const int k,
+                         const bool isPSD,
+                         Eigen::VectorXd &values,
+                         Eigen::MatrixXd &vectors) {
+
+    const Eigen::Index n = A.rows();
+
+    if(!isPSD or n <= 512) {
+      Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(A);
+      // increasing order
+      values = solver.eigenvalues().tail(k).reverse();
+      vectors = solver.eigenvectors().rightCols(k).rowwise().reverse();
+      return;
+    }
+
+    const Eigen::Index m = std::min<Eigen::Index>(n, k + 8);
+    std::mt19937 generator(0);
+    std::normal_distribution<double> normal;
+    Eigen::MatrixXd Q(n, m);
+    for(Eigen::Index j = 0; j < m; ++j)
+      for(Eigen::Index i = 0; i < n; ++i)
+        Q(i, j) = normal(generator);
+
+    Eigen::VectorXd previous = Eigen::VectorXd::Zero(k);
+    Eigen::MatrixXd AQ;
+    for(int it = 0; it < 500; ++it) {
+      Eigen::HouseholderQR<Eigen::MatrixXd> qr(Q);
+      Q = qr.householderQ() * Eigen::MatrixXd::Identity(n, m);
+      AQ.noalias() = A * Q;
+
+      // Rayleigh-Ritz convergence check
+      if(it % 4 == 3) {
+        const Eigen::MatrixXd T = Q.transpose() * AQ;
+        Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(T);
+        const Eigen::VectorXd ritz = solver.eigenvalues().tail(k).reverse();
+        const double error = (ritz - previous).cwiseAbs().maxCoeff();
+        previous = ritz;
+        if(error <= 1e-10 * std::max(std::abs(ritz[0]), 1e-300))
+          break;
+      }
+      Q = AQ;
+    }
+
+    Eigen::HouseholderQR<Eigen::MatrixXd> qr(Q);
+    Q = qr.householderQ() * Eigen::MatrixXd::Identity(n, m);
+    const Eigen::MatrixXd T = Q.transpose() * (A * Q);
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(T);
+    values = solver.eigenvalues().tail(k).reverse();
+    vectors = Q * solver.eigenvectors().rightCols(k).rowwise().reverse();
+  }
+
+  // deterministic signs: the largest entry (in absolute value) of each
+  // column is positive (as scikit-learn's svd_flip)
+  void flipSigns(Eigen::MatrixXd &Y) {
+    for(Eigen::Index j = 0; j < Y.cols(); ++j) {
+      Eigen::Index i{};
+      Y.col(j).cwiseAbs().maxCoeff(&i);
+      if(Y(i, j) < 0)
+        Y.col(j) *= -1;
+    }
+  }
+
+  void copyEmbedding(const Eigen::MatrixXd &Y, std::vector<double> &embedding) {
+    embedding.resize(Y.size());
+    Eigen::Map<RowMajorMatrix>(embedding.data(), Y.rows(), Y.cols()) = Y;
+  }
+#endif // TTK_ENABLE_EIGEN
+
+  // Space-partitioning tree (quadtree, octree, etc.) of the embedding, for
+  // the Barnes-Hut approximation of the t-SNE repulsive forces.
+  class SPTree {
+  public:
+    SPTree(const double *Y, const SimplexId n, const int dim)
+      : Y_{Y}, dim_{dim} {
+
+      Node root{};
+      root.firstChild = -1;
+      root.point = -1;
+      double lower[3], upper[3];
+      for(int k = 0; k < dim_; ++k) {
+        lower[k] = std::numeric_limits<double>::max();
+        upper[k] = std::numeric_limits<double>::lowest();
+      }
+      for(SimplexId i = 0; i < n; ++i) {
+        for(int k = 0; k < dim_; ++k) {
+          lower[k] = std::min(lower[k], Y[i * dim_ + k]);
+          upper[k] = std::max(upper[k], Y[i * dim_ + k]);
+        }
+      }
+      for(int k = 0; k < dim_; ++k) {
+        root.center[k] = (lower[k] + upper[k]) / 2;
+        root.width = std::max(root.width, (upper[k] - lower[k]) / 2);
+      }
+      root.width = root.width * (1 + 1e-5) + 1e-5;
+      nodes_.reserve(4 * n);
+      nodes_.emplace_back(root);
+
+      for(SimplexId i = 0; i < n; ++i)
+        insert(i);
+    }
+
+    // negative forces on point i (and its contribution to the normalization)
+    void repulsion(const SimplexId i,
+                   const double theta,
+                   double *force,
+                   double &sumQ) const {
+      const double *y = &Y_[i * dim_];
+      // at most 7 pending siblings per level
+      int stack[8 * 64];
+      int stackSize = 0;
+      stack[stackSize++] = 0;
+      while(stackSize > 0) {
+        const Node &node = nodes_[stack[--stackSize]];
+        if(node.count == 0)
+          continue;
+        const bool isLeaf = node.firstChild == -1;
+        if(isLeaf and node.count == 1 and node.point == i)
+          continue;
+
+        double diff[3];
+        double d2 = 0;
+        for(int k = 0; k < dim_; ++k) {
+          diff[k] = y[k] - node.centerOfMass[k];
+          d2 += diff[k] * diff[k];
+        }
+
+        if(isLeaf or 2 * node.width < theta * std::sqrt(d2)) {
+          if(d2 == 0) {
+            // duplicates of point i (leaf at the maximum depth)
+            sumQ += node.count - 1;
+            continue;
+          }
+          const double q = 1 / (1 + d2);
+          const double mult = node.count * q;
+          sumQ += mult;
+          for(int k = 0; k < dim_; ++k)
+            force[k] += mult * q * diff[k];
+        } else {
+          for(int c = 0; c < (1 << dim_); ++c)
+            stack[stackSize++] = node.firstChild + c;
+        }
+      }
+    }
+
+  private:
+    struct Node {
+      double center[3];
+      double width; // half side
+      double centerOfMass[3];
+      SimplexId count;
+      int firstChild;
+      SimplexId point;
+    };
+
+    inline int child(const int node, const SimplexId p) const {
+      int c = 0;
+      for(int k = 0; k < dim_; ++k)
+        if(Y_[p * dim_ + k] >= nodes_[node].center[k])
+          c |= (1 << k);
+      return nodes_[node].firstChild + c;
+    }
+
+    inline void add(const int node, const SimplexId p) {
+      Node &n = nodes_[node];
+      n.count++;
+      for(int k = 0; k < dim_; ++k)
+        n.centerOfMass[k] += (Y_[p * dim_ + k] - n.centerOfMass[k]) / n.count;
+      if(n.count == 1)
+        n.point = p;
+    }
+
+    void insert(const SimplexId p) {
+      int node = 0;
+      for(int depth = 0;; ++depth) {
+        add(node, p);
+        if(nodes_[node].firstChild == -1) {
+          if(nodes_[node].count == 1 or depth >= maxDepth_)
+            return;
+
+          // split the leaf and move its previous point down
+          const int firstChild = nodes_.size();
+          for(int c = 0; c < (1 << dim_); ++c) {
+            Node n{};
+            n.width = nodes_[node].width / 2;
+            for(int k = 0; k < dim_; ++k)
+              n.center[k] = nodes_[node].center[k]
+                            + ((c >> k) & 1 ? n.width : -n.width);
+            n.firstChild = -1;
+            n.point = -1;
+            nodes_.emplace_back(n);
+          }
+          nodes_[node].firstChild = firstChild;
+          const SimplexId previous = nodes_[node].point;
+          nodes_[node].point = -1;
+          add(child(node, previous), previous);
+        }
+        node = child(node, p);
+      }
+    }
+
+    const double *Y_;
+    const int dim_;
+    const int maxDepth_{48};
+    std::vector<Node> nodes_{};
+  };
+
+} // namespace
+
+int DimensionReduction::executeNative() const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!matrix_ or !embedding_)
+    return -1;
+  if(numberOfRows_ <= 0 or numberOfColumns_ <= 0)
+    return -1;
+#endif
+
+  Timer t;
+
+  const int numberOfComponents = std::max(2, numberOfComponents_);
+
+#ifdef TTK_ENABLE_EIGEN
+  Eigen::setNbThreads(threadNumber_);
+#endif
+
+  std::vector<double> embedding;
+  int ret = -1;
+  switch(method_) {
+    case 2:
+      ret = computeClassicalMDS(numberOfComponents, embedding);
+      break;
+    case 3:
+      ret = computeTSNE(numberOfComponents, embedding);
+      break;
+    case 5:
+      ret = computePCA(static_cast<double *>(matrix_), numberOfComponents,
+                       pca_Whiten, embedding);
+      break;
+    default:
+      cerr << "[DimensionReduction] Error: this method is not available in "
+              "the native engine (MDS, t-SNE and PCA only)."
+           << endl;
+      return -1;
+  }
+  if(ret != 0)
+    return ret;
+
+  embedding_->resize(numberOfComponents);
+  for(int i = 0; i < numberOfComponents; ++i) {
+    (*embedding_)[i].resize(numberOfRows_);
+    for(SimplexId j = 0; j < numberOfRows_; ++j)
+      (*embedding_)[i][j] = embedding[j * numberOfComponents + i];
+  }
+
+  {
+    stringstream msg;
+    msg << "[DimensionReduction] Native "
+        << (method_ == 2 ? "MDS" : method_ == 3 ? "t-SNE" : "PCA")
+        << " computed in " << t.getElapsedTime() << " s. (" << threadNumber_
+        << " thread(s))." << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+int DimensionReduction::computePCA(const double *matrix,
+                                   const int nComponents,
+                                   const bool whiten,
+                                   std::vector<double> &embedding) const {
+#ifdef TTK_ENABLE_EIGEN
+  const SimplexId n = numberOfRows_;
+  const SimplexId d = numberOfColumns_;
+  if(nComponents > std::min(n, d)) {
+    cerr << "[DimensionReduction] Error: PCA needs at least " << nComponents
+         << " rows and columns." << endl;
+    return -1;
+  }
+
+  const Eigen::Map<const RowMajorMatrix> X(matrix, n, d);
+  const Eigen::MatrixXd C = X.rowwise() - X.colwise().mean();
+
+  Eigen::VectorXd values;
+  Eigen::MatrixXd vectors;
+  Eigen::MatrixXd Y;
+  if(d <= n) {
+    // covariance matrix: the embedding is the projection on its eigenvectors
+    const Eigen::MatrixXd covariance = C.transpose() * C;
+    leadingEigenpairs(covariance, nComponents, true, values, vectors);
+    Y = C * vectors;
+  } else {
+    // Gram matrix: its eigenvectors are the left singular vectors of C
+    const Eigen::MatrixXd gram = C * C.transpose();
+    leadingEigenpairs(gram, nComponents, true, values, vectors);
+    Y = vectors * values.cwiseMax(0).cwiseSqrt().asDiagonal();
+  }
+
+  if(whiten) {
+    // unit variance components
+    for(int j = 0; j < nComponents; ++j) {
+      const double variance = std::max(values[j], 0.0) / std::max(n - 1, 1);
+      if(variance > 0)
+        Y.col(j) /= std::sqrt(variance);
+    }
+  }
+
+  flipSigns(Y);
+  copyEmbedding(Y, embedding);
+  return 0;
+#else
+  (void)matrix;
+  (void)nComponents;
+  (void)whiten;
+  (void)embedding;
+  cerr << "[DimensionReduction] Error: the native PCA requires Eigen." << endl;
+  return -1;
+#endif // TTK_ENABLE_EIGEN
+}
+
+int DimensionReduction::computeClassicalMDS(
+  const int nComponents, std::vector<double> &embedding) const {
+#ifdef TTK_ENABLE_EIGEN
+  const SimplexId n = numberOfRows_;
+  const bool precomputed = mds_Dissimilarity == "precomputed";
+  if(precomputed and numberOfColumns_ != n) {
+    cerr << "[DimensionReduction] Error: the distance matrix is not square."
+         << endl;
+    return -1;
+  }
+  if(nComponents > n) {
+    cerr << "[DimensionReduction] Error: MDS needs at least " << nComponents
+         << " rows." << endl;
+    return -1;
+  }
+
+  const Eigen::Map<const RowMajorMatrix> X(
+    static_cast<const double *>(matrix_), n, numberOfColumns_);
+
+  // squared distances
+  Eigen::MatrixXd B;
+  if(precomputed) {
+    B = X.cwiseAbs2();
+    B = (B + B.transpose()) / 2;
+  } else {
+    const Eigen::MatrixXd C = X.rowwise() - X.colwise().mean();
+    const Eigen::VectorXd norms = C.rowwise().squaredNorm();
+    B = -2 * C * C.transpose();
+    B.colwise() += norms;
+    B.rowwise() += norms.transpose();
+  }
+
+  // double centering: B = -1/2 J D^2 J
+  const Eigen::VectorXd means = B.rowwise().mean();
+  const double mean = means.mean();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId j = 0; j < n; ++j)
+    for(SimplexId i = 0; i < n; ++i)
+      B(i, j) = -0.5 * (B(i, j) - means[i] - means[j] + mean);
+
+  // non-euclidean dissimilarities may have negative eigenvalues
+  Eigen::VectorXd values;
+  Eigen::MatrixXd vectors;
+  leadingEigenpairs(B, nComponents, !precomputed, values, vectors);
+
+  Eigen::MatrixXd Y = vectors * values.cwiseMax(0).cwiseSqrt().asDiagonal();
+  flipSigns(Y);
+  copyEmbedding(Y, embedding);
+  return 0;
+#else
+  (void)nComponents;
+  (void)embedding;
+  cerr << "[DimensionReduction] Error: the native MDS requires Eigen." << endl;
+  return -1;
+#endif // TTK_ENABLE_EIGEN
+}
+
+int DimensionReduction::computeTSNE(const int nComponents,
+                                    std::vector<double> &embedding) const {
+
+  const SimplexId n = numberOfRows_;
+  const int dim = nComponents;
+  const bool exact = tsne_Method == "exact";
+  const bool precomputed = tsne_Metric == "precomputed";
+  const double *matrix = static_cast<const double *>(matrix_);
+  const double perplexity = tsne_Perplexity;
+
+  if(!exact and dim > 3) {
+    cerr << "[DimensionReduction] Error: the Barnes-Hut t-SNE supports up to 3 "
+            "components."
+         << endl;
+    return -1;
+  }
+  if(precomputed and numberOfColumns_ != n) {
+    cerr << "[DimensionReduction] Error: the distance matrix is not square."
+         << endl;
+    return -1;
+  }
+  if(n < 2)
+    return -1;
+
+  // 1. input similarities, on the nearest neighbors (all the points for the
+  // exact method), calibrated to the perplexity
+  const SimplexId K
+    = exact ? n - 1
+            : std::min<SimplexId>(n - 1, (SimplexId)(3 * perplexity + 1));
+  std::vector<SimplexId> neighbors(n * K);
+  std::vector<double> conditionalP(n * K);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  {
+    std::vector<std::pair<double, SimplexId>> distances(n - 1);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < n; ++i) {
+      SimplexId q = 0;
+      for(SimplexId j = 0; j < n; ++j) {
+        if(j == i)
+          continue;
+        double d = 0;
+        if(precomputed) {
+          d = matrix[i * n + j];
+        } else {
+          for(SimplexId k = 0; k < numberOfColumns_; ++k) {
+            const double diff = matrix[i * numberOfColumns_ + k]
+                                - matrix[j * numberOfColumns_ + k];
+            d += diff * diff;
+          }
+        }
+        distances[q++] = {d, j};
+      }
+      if(K < n - 1)
+        std::partial_sort(
+          distances.begin(), distances.begin() + K, distances.end());
+
+      // binary search of the precision matching the perplexity
+      double minDistance = std::numeric_limits<double>::max();
+      for(SimplexId k = 0; k < K; ++k)
+        minDistance = std::min(minDistance, distances[k].first);
+      double *P = &conditionalP[i * K];
+      double beta = 1;
+      double betaMin = -std::numeric_limits<double>::max();
+      double betaMax = std::numeric_limits<double>::max();
+      const double targetEntropy = std::log(perplexity);
+      for(int it = 0; it < 100; ++it) {
+        double sumP = 0;
+        double sumDP = 0;
+        for(SimplexId k = 0; k < K; ++k) {
+          const double d = distances[k].first - minDistance;
+          P[k] = std::exp(-d * beta);
+          sumP += P[k];
+          sumDP += d * P[k];
+        }
+        sumP = std::max(sumP, std::numeric_limits<double>::min());
+        const double entropy = std::log(sumP) + beta * sumDP / sumP;
+        for(SimplexId k = 0; k < K; ++k)
+          P[k] /= sumP;
+
+        const double diff = entropy - targetEntropy;
+        if(std::abs(diff) < 1e-5)
+          break;
+        if(diff > 0) {
+          betaMin = beta;
+          beta = betaMax == std::numeric_limits<double>::max()
+                   ? beta * 2
+                   : (beta + betaMax) / 2;
+        } else {
+          betaMax = beta;
+          beta = betaMin == -std::numeric_limits<double>::max()
+                   ? beta / 2
+                   : (beta + betaMin) / 2;
+        }
+      }
+      for(SimplexId k = 0; k < K; ++k)
+        neighbors[i * K + k] = distances[k].second;
+    }
+  }
+
+  // symmetrized joint probabilities (CSR)
+  std::vector<SimplexId> rowOffsets(n + 1, 0);
+  std::vector<SimplexId> columns;
+  std::vector<double> jointP;
+  {
+    std::vector<std::tuple<SimplexId, SimplexId, double>> entries;
+    entries.reserve(2 * n * K);
+    for(SimplexId i = 0; i < n; ++i) {
+      for(SimplexId k = 0; k < K; ++k) {
+        const SimplexId j = neighbors[i * K + k];
+        entries.emplace_back(i, j, conditionalP[i * K + k]);
+        entries.emplace_back(j, i, conditionalP[i * K + k]);
+      }
+    }
+    std::sort(entries.begin(), entries.end());
+
+    double sum = 0;
+    for(size_t e = 0; e < entries.size(); ++e) {
+      const SimplexId i = std::get<0>(entries[e]);
+      const SimplexId j = std::get<1>(entries[e]);
+      if(e > 0 and std::get<0>(entries[e - 1]) == i
+         and std::get<1>(entries[e - 1]) == j) {
+        jointP.back() += std::get<2>(entries[e]);
+      } else {
+        columns.emplace_back(j);
+        jointP.emplace_back(std::get<2>(entries[e]));
+        rowOffsets[i + 1]++;
+      }
+      sum += std::get<2>(entries[e]);
+    }
+    for(SimplexId i = 0; i < n; ++i)
+      rowOffsets[i + 1] += rowOffsets[i];
+    for(auto &p : jointP)
+      p = std::max(p / sum, std::numeric_limits<double>::epsilon());
+  }
+
+  // 2. initial embedding
+  std::vector<double> Y(n * dim);
+  std::mt19937 generator(randomState_ > 0 ? 0 : std::random_device()());
+#ifdef TTK_ENABLE_EIGEN
+  const bool pcaInit = tsne_Init == "pca" and !precomputed;
+#else
+  // the native PCA requires Eigen
+  const bool pcaInit = false;
+  if(tsne_Init == "pca" and !precomputed)
+    dMsg(cerr,
+         "[DimensionReduction] Warning: PCA initialization requires Eigen, "
+         "using a random initialization.\n",
+         infoMsg);
+#endif
+  if(pcaInit and computePCA(matrix, dim, false, Y) == 0) {
+    double mean = 0, variance = 0;
+    for(SimplexId i = 0; i < n; ++i)
+      mean += Y[i * dim] / n;
+    for(SimplexId i = 0; i < n; ++i)
+      variance += (Y[i * dim] - mean) * (Y[i * dim] - mean) / n;
+    const double scale = variance > 0 ? 1e-4 / std::sqrt(variance) : 1;
+    for(auto &y : Y)
+      y *= scale;
+  } else {
+    std::normal_distribution<double> normal(0, 1e-4);
+    for(auto &y : Y)
+      y = normal(generator);
+  }
+
+  // 3. gradient descent (with early exaggeration, momentum and gains)
+  const int explorationIterations = 250;
+  const int maxIteration = std::max(tsne_MaxIteration, explorationIterations);
+  const double learningRate = tsne_LearningRate;
+  const double theta = tsne_Angle;
+  std::vector<double> gradient(n * dim), update(n * dim, 0), gains(n * dim, 1);
+  std::vector<double> sumQs(n);
+  double bestError = std::numeric_limits<double>::max();
+  int bestIteration = 0;
+
+  for(int it = 0; it < maxIteration; ++it) {
+    const bool exploration = it < explorationIterations;
+    const double exaggeration = exploration ? tsne_Exaggeration : 1;
+    const double momentum = exploration ? 0.5 : 0.8;
+
+    std::unique_ptr<SPTree> tree;
+    if(!exact)
+      tree.reset(new SPTree(Y.data(), n, dim));
+
+    // repulsive forces (stored in the gradient) and normalization
+    double sumQ = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic, 64) num_threads(threadNumber_) \
+  reduction(+ : sumQ)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < n; ++i) {
+      double force[3] = {0, 0, 0};
+      double *g = &gradient[i * dim];
+      double q = 0;
+      if(exact) {
+        std::fill(g, g + dim, 0);
+        for(SimplexId j = 0; j < n; ++j) {
+          if(j == i)
+            continue;
+          double d2 = 0;
+          for(int k = 0; k < dim; ++k)
+            d2 += (Y[i * dim + k] - Y[j * dim + k])
+                  * (Y[i * dim + k] - Y[j * dim + k]);
+          const double qij = 1 / (1 + d2);
+          q += qij;
+          for(int k = 0; k < dim; ++k)
+            g[k] += qij * qij * (Y[i * dim + k] - Y[j * dim + k]);
+        }
+      } else {
+        tree->repulsion(i, theta, force, q);
+        std::copy(force, force + dim, g);
+      }
+      sumQs[i] = q;
+      sumQ += q;
+    }
+
+    // attractive forces and gradient
+    double gradientNorm = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(+ : gradientNorm)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < n; ++i) {
+      double attraction[3] = {0, 0, 0};
+      std::vector<double> attractionExact;
+      double *a = attraction;
+      if(dim > 3) {
+        attractionExact.resize(dim, 0);
+        a = attractionExact.data();
+      }
+      for(SimplexId e = rowOffsets[i]; e < rowOffsets[i + 1]; ++e) {
+        const SimplexId j = columns[e];
+        double d2 = 0;
+        for(int k = 0; k < dim; ++k)
+          d2 += (Y[i * dim + k] - Y[j * dim + k])
+                * (Y[i * dim + k] - Y[j * dim + k]);
+        const double mult = exaggeration * jointP[e] / (1 + d2);
+        for(int k = 0; k < dim; ++k)
+          a[k] += mult * (Y[i * dim + k] - Y[j * dim + k]);
+      }
+      for(int k = 0; k < dim; ++k) {
+        double &g = gradient[i * dim + k];
+        g = 4 * (a[k] - g / sumQ);
+        gradientNorm += g * g;
+      }
+    }
+    gradientNorm = std::sqrt(gradientNorm);
+
+    // update
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId c = 0; c < n * dim; ++c) {
+      const bool sameSign = (update[c] > 0) == (gradient[c] > 0);
+      gains[c] = std::max(sameSign ? gains[c] * 0.8 : gains[c] + 0.2, 0.01);
+      update[c] = momentum * update[c] - learningRate * gains[c] * gradient[c];
+      Y[c] += update[c];
+    }
+
+    if(gradientNorm < tsne_GradientThreshold)
+      break;
+
+    // convergence check (Kullback-Leibler divergence)
+    if(!exploration and (it + 1) % 50 == 0) {
+      double error = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(+ : error)
+#endif // TTK_ENABLE_OPENMP
+      for(SimplexId i = 0; i < n; ++i) {
+        for(SimplexId e = rowOffsets[i]; e < rowOffsets[i + 1]; ++e) {
+          const SimplexId j = columns[e];
+          double d2 = 0;
+          for(int k = 0; k < dim; ++k)
+            d2 += (Y[i * dim + k] - Y[j * dim + k])
+                  * (Y[i * dim + k] - Y[j * dim + k]);
+          const double q = std::max(1 / (1 + d2) / sumQ,
+                                    std::numeric_limits<double>::epsilon());
+          error += jointP[e] * std::log(jointP[e] / q);
+        }
+      }
+      if(tsne_Verbose > 0) {
+        stringstream msg;
+        msg << "[DimensionReduction] t-SNE iteration " << it + 1
+            << ": error = " << error << ", gradient norm = " << gradientNorm
+            << endl;
+        dMsg(cout, msg.str(), infoMsg);
+      }
+      if(error < bestError) {
+        bestError = error;
+        bestIteration = it;
+      } else if(it - bestIteration > tsne_MaxIterationProgress) {
+        break;
+      }
+    }
+  }
+
+  embedding.swap(Y);
+  return 0;
+}
@@ -11,6 +11,12 @@
 /// \brief TTK VTK-filter that takes a matrix (vtkTable) as input and apply a
 /// dimension reduction algorithm from scikit-learn.
 ///
+/// The principal component analysis, the (classical) multi-dimensional
+/// scaling and the t-SNE are also available in a native, multi-threaded
+/// engine (see setInputBackend()), which does not require Python. PCA and
+/// MDS rely on Eigen, the t-SNE uses a Barnes-Hut approximation of the
+/// repulsive forces (up to 3 components).
+///
 /// \sa ttk::Triangulation
 /// \sa ttkDimensionReduction.cpp %for a usage example.
 
@@ -24,6 +30,15 @@ namespace ttk {
   class DimensionReduction : public Debug {
 
   public:
+    enum Backend { SCIKIT_LEARN = 0, NATIVE = 1 };
+
+    // scikit-learn if TTK is built with it, the native engine otherwise
+#ifdef TTK_ENABLE_SCIKIT_LEARN
+    static const int DEFAULT_BACKEND = SCIKIT_LEARN;
+#else
+    static const int DEFAULT_BACKEND = NATIVE;
+#endif
+
     DimensionReduction();
     ~DimensionReduction();
 
@@ -162,6 +177,11 @@ namespace ttk {
       return 0;
     }
 
+    inline int setInputBackend(int backend) {
+      backend_ = backend;
+      return 0;
+    }
+
     inline int setInputNumberOfComponents(int numberOfComponents) {
       numberOfComponents_ = numberOfComponents;
       return 0;
@@ -182,11 +202,32 @@ namespace ttk {
       return 0;
     }
 
+    /// Returns true if TTK is built with scikit-learn support.
     bool isPythonFound() const;
 
+    /// Returns true if the input method is available in the native engine.
+    bool isNativeMethod() const;
+
     int execute() const;
 
   protected:
+    int executeNative() const;
+
+    /// Starts the Python interpreter on first use.
+    int initializePython() const;
+
+    // embeddings are returned row-major (numberOfRows_ x nComponents)
+    int computePCA(const double *matrix,
+                   const int nComponents,
+                   const bool whiten,
+                   std::vector<double> &embedding) const;
+
+    int computeClassicalMDS(const int nComponents,
+                            std::vector<double> &embedding) const;
+
+    int computeTSNE(const int nComponents,
+                    std::vector<double> &embedding) const;
+
     // se
     std::string se_Affinity;
     float se_Gamma;
@@ -243,11 +284,12 @@ namespace ttk {
     SimplexId numberOfRows_;
     SimplexId numberOfColumns_;
     int method_;
+    int backend_;
     int numberOfComponents_;
     int numberOfNeighbors_;
     int randomState_;
     void *matrix_;
     std::vector<std::vector<double>> *embedding_;
-    char majorVersion_;
+    mutable char majorVersion_;
   };
 } // namespace ttk
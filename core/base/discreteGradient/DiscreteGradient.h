@@ -18,11 +18,13 @@
 // base code includes
 #include <FTMTree.h>
 #include <Geometry.h>
+#include <OrderDisambiguation.h>
 #include <Triangulation.h>
 #include <Wrapper.h>
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <functional>
 #include <queue>
 #include <set>
@@ -306,7 +308,117 @@ namespace ttk {
     };
 
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-    using gradientType = std::vector<std::vector<std::vector<char>>>;
+    /**
+     * Bit-packed array of local identifiers, used to store the discrete
+     * gradient as the index of the paired cell in the (co)facet list of
+     * each cell.
+     *
+     * Each entry uses a fixed number of bits, chosen at initialization from
+     * the largest local identifier to store. This width is a power of two
+     * so that an entry never straddles two 64-bit words. -1 (unpaired cell)
+     * is stored as 0. Concurrent writes to distinct entries are safe.
+     */
+    class LocalIdArray {
+    public:
+      /**
+       * Proxy to an entry, convertible to (and assignable from) SimplexId.
+       */
+      class reference {
+      public:
+        reference(LocalIdArray &array, const size_t i) : array_{array}, i_{i} {
+        }
+        inline operator SimplexId() const {
+          return array_.get(i_);
+        }
+        inline reference &operator=(const SimplexId localId) {
+          array_.set(i_, localId);
+          return *this;
+        }
+        inline reference &operator=(const reference &other) {
+          array_.set(i_, static_cast<SimplexId>(other));
+          return *this;
+        }
+
+      private:
+        LocalIdArray &array_;
+        const size_t i_;
+      };
+
+      /**
+       * Allocate @p n entries set to -1, able to store local identifiers
+       * in [0, @p localIdNumber).
+       */
+      inline void init(const size_t n, const SimplexId localIdNumber) {
+        width_ = 1;
+        while(width_ < 32
+              && (uint64_t{1} << width_) - 1
+                   < static_cast<uint64_t>(localIdNumber)) {
+          width_ *= 2;
+        }
+        mask_ = (uint64_t{1} << width_) - 1;
+        entriesPerWordLog_ = 0;
+        while((width_ << entriesPerWordLog_) < 64) {
+          entriesPerWordLog_++;
+        }
+        size_ = n;
+        data_.clear();
+        data_.resize((n + (size_t{1} << entriesPerWordLog_) - 1)
+                       >> entriesPerWordLog_,
+                     0);
+      }
+
+      inline SimplexId get(const size_t i) const {
+        const uint64_t word = data_[i >> entriesPerWordLog_];
+        return static_cast<SimplexId>((word >> offset(i)) & mask_) - 1;
+      }
+
+      inline void set(const size_t i, const SimplexId localId) {
+        const size_t o = offset(i);
+        const uint64_t clear = ~(mask_ << o);
+        const uint64_t value = (static_cast<uint64_t>(localId + 1) & mask_)
+                               << o;
+        uint64_t &word = data_[i >> entriesPerWordLog_];
+        // the other entries of the word may be written concurrently
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic update
+#endif // TTK_ENABLE_OPENMP
+        word &= clear;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic update
+#endif // TTK_ENABLE_OPENMP
+        word |= value;
+      }
+
+      inline SimplexId operator[](const size_t i) const {
+        return get(i);
+      }
+      inline reference operator[](const size_t i) {
+        return reference{*this, i};
+      }
+
+      inline size_t size() const {
+        return size_;
+      }
+      inline int getEntryWidth() const {
+        return width_;
+      }
+      inline size_t getMemoryFootprint() const {
+        return data_.size() * sizeof(uint64_t);
+      }
+
+    private:
+      inline size_t offset(const size_t i) const {
+        return (i & ((size_t{1} << entriesPerWordLog_) - 1)) * width_;
+      }
+
+      std::vector<uint64_t> data_{};
+      size_t size_{};
+      int width_{1};
+      int entriesPerWordLog_{6};
+      uint64_t mask_{1};
+    };
+
+    using gradientType = std::vector<std::vector<LocalIdArray>>;
 #else
     using gradientType = std::vector<std::vector<std::vector<SimplexId>>>;
 #endif
@@ -395,16 +507,9 @@ function value.
         std::vector<SimplexId> sortedVertices(vertexNumber);
         vertsOrder.resize(vertexNumber);
 
-        // fill with numbers from 0 to vertexNumber - 1
-        std::iota(sortedVertices.begin(), sortedVertices.end(), 0);
-
         // sort vertices in ascending order following scalarfield / offsets
-        PSORT(sortedVertices.begin(), sortedVertices.end(),
-              [&](const SimplexId a, const SimplexId b) {
-                return (scalarField[a] < scalarField[b])
-                       || (scalarField[a] == scalarField[b]
-                           && offsetField[a] < offsetField[b]);
-              });
+        ttk::sortVertices(vertexNumber, scalarField, offsetField,
+                          sortedVertices.data(), threadNumber_);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
@@ -423,12 +528,15 @@ function value.
        * @brief Store the subcomplexes around vertex for which offset
        * at vertex is maximum
        *
+       * @param[out] ls Lower star as 4 sets of cells (0-cells, 1-cells,
+       * 2-cells and 3-cells), cleared before use
        * @param[in] a Vertex Id
-       *
-       * @return Lower star as 4 sets of cells (0-cells, 1-cells, 2-cells and
-       * 3-cells)
+       * @param[in] triangulation Concrete triangulation
        */
-      inline lowerStarType lowerStar(const SimplexId a) const;
+      template <typename triangulationType>
+      inline void lowerStar(lowerStarType &ls,
+                            const SimplexId a,
+                            const triangulationType *const triangulation) const;
 
       /**
        * @brief Return the number of unpaired faces of a given cell in
@@ -458,16 +566,28 @@ function value.
        *
        * @param[in] alpha Cell of lower dimension
        * @param[in] beta Cell of higher dimension
+       * @param[in] triangulation Concrete triangulation
        */
-      inline void pairCells(CellExt &alpha, CellExt &beta);
+      template <typename triangulationType>
+      inline void pairCells(CellExt &alpha,
+                            CellExt &beta,
+                            const triangulationType *const triangulation);
 
       /**
        * Implements the ProcessLowerStars algorithm from "Theory and
        * Algorithms for Constructing Discrete Morse Complexes from
        * Grayscale Digital Images", V. Robins, P. J. Wood,
        * A. P. Sheppard
+       *
+       * The triangulation is given with its concrete type (see
+       * ttkTemplateMacro) so that the lower star traversals are not virtual
+       * calls. Vertices are processed in parallel, each thread reusing its
+       * own lower star and priority queue buffers. Since a cell belongs to
+       * exactly one lower star, the result does not depend on the number of
+       * threads.
        */
-      int processLowerStars();
+      template <typename triangulationType>
+      int processLowerStars(const triangulationType *const triangulation);
 
     public:
       /**
@@ -696,6 +816,16 @@ according to them.
         return 0;
       }
 
+      /**
+       * Set the precomputed global vertex order (rank of each vertex, see
+       * ttk::preconditionOrderArray). When given, the vertices are not sorted
+       * again by buildGradient().
+       */
+      inline int setInputVertexOrder(const SimplexId *const order) {
+        inputVertexOrder_ = order;
+        return 0;
+      }
+
       /**
        * Set the output data pointer to the critical points.
        */
@@ -745,6 +875,14 @@ triangulation (equal to dimensionality+1).
        */
       SimplexId getNumberOfCells(const int dimension) const;
 
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+      /**
+       * Get the maximum number of cofacets of the cells of the given
+       * dimension (sizes the bit-packed gradient storage).
+       */
+      SimplexId getMaxNumberOfCofacets(const int dimension) const;
+#endif // TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+
       /**
        * Return true if the given cell is a minimum regarding the discrete
 gradient, false otherwise.
@@ -934,6 +1072,7 @@ tetra identifier.
 
       const void *inputScalarField_{};
       const void *inputOffsets_{};
+      const SimplexId *inputVertexOrder_{};
       Triangulation *inputTriangulation_{};
 
       SimplexId *outputCriticalPoints_numberOfPoints_{};
@@ -195,8 +195,424 @@ dataType DiscreteGradient::getPersistence(const Cell &up,
   return scalarMax<dataType>(up, scalars) - scalarMin<dataType>(down, scalars);
 }
 
+template <typename triangulationType>
+inline void DiscreteGradient::lowerStar(
+  lowerStarType &res,
+  const SimplexId a,
+  const triangulationType *const triangulation) const {
+
+  // keep the capacity of the vectors across calls
+  for(auto &cells : res) {
+    cells.clear();
+  }
+
+  // a belongs to its lower star
+  res[0].emplace_back(CellExt{0, a});
+
+  // store lower edges
+  const auto nedges = triangulation->getVertexEdgeNumber(a);
+  res[1].reserve(nedges);
+  for(SimplexId i = 0; i < nedges; i++) {
+    SimplexId edgeId;
+    triangulation->getVertexEdge(a, i, edgeId);
+    SimplexId vertexId;
+    triangulation->getEdgeVertex(edgeId, 0, vertexId);
+    if(vertexId == a) {
+      triangulation->getEdgeVertex(edgeId, 1, vertexId);
+    }
+    if(vertsOrder_[vertexId] < vertsOrder_[a]) {
+      res[1].emplace_back(CellExt{1, edgeId, {vertexId}, {}});
+    }
+  }
+
+  if(res[1].size() < 2) {
+    // at least two edges in the lower star for one triangle
+    return;
+  }
+
+  const auto processTriangle
+    = [&](const SimplexId triangleId, const SimplexId v0, const SimplexId v1,
+          const SimplexId v2) {
+        std::array<SimplexId, 3> lowVerts{};
+        if(v0 == a) {
+          lowVerts[0] = v1;
+          lowVerts[1] = v2;
+        } else if(v1 == a) {
+          lowVerts[0] = v0;
+          lowVerts[1] = v2;
+        } else if(v2 == a) {
+          lowVerts[0] = v0;
+          lowVerts[1] = v1;
+        }
+        if(vertsOrder_[a] > vertsOrder_[lowVerts[0]]
+           && vertsOrder_[a] > vertsOrder_[lowVerts[1]]) {
+          uint8_t j{}, k{};
+          // store edges indices of current triangle
+          std::array<uint8_t, 3> faces{};
+          for(const auto &e : res[1]) {
+            if(e.lowVerts_[0] == lowVerts[0] || e.lowVerts_[0] == lowVerts[1]) {
+              faces[k++] = j;
+            }
+            j++;
+          }
+          res[2].emplace_back(CellExt{2, triangleId, lowVerts, faces});
+        }
+      };
+
+  if(dimensionality_ == 2) {
+    // store lower triangles
+
+    // use optimised triangulation methods:
+    // getVertexStar instead of getVertexTriangle
+    // getCellVertex instead of getTriangleVertex
+    const auto ncells = triangulation->getVertexStarNumber(a);
+    res[2].reserve(ncells);
+    for(SimplexId i = 0; i < ncells; ++i) {
+      SimplexId cellId;
+      triangulation->getVertexStar(a, i, cellId);
+      SimplexId v0{}, v1{}, v2{};
+      triangulation->getCellVertex(cellId, 0, v0);
+      triangulation->getCellVertex(cellId, 1, v1);
+      triangulation->getCellVertex(cellId, 2, v2);
+      processTriangle(cellId, v0, v1, v2);
+    }
+  } else if(dimensionality_ == 3) {
+    // store lower triangles
+    const auto ntri = triangulation->getVertexTriangleNumber(a);
+    res[2].reserve(ntri);
+    for(SimplexId i = 0; i < ntri; i++) {
+      SimplexId triangleId;
+      triangulation->getVertexTriangle(a, i, triangleId);
+      SimplexId v0{}, v1{}, v2{};
+      triangulation->getTriangleVertex(triangleId, 0, v0);
+      triangulation->getTriangleVertex(triangleId, 1, v1);
+      triangulation->getTriangleVertex(triangleId, 2, v2);
+      processTriangle(triangleId, v0, v1, v2);
+    }
+
+    // at least three triangles in the lower star for one tetra
+    if(res[2].size() >= 3) {
+      // store lower tetra
+      const auto ncells = triangulation->getVertexStarNumber(a);
+      res[3].reserve(ncells);
+      for(SimplexId i = 0; i < ncells; ++i) {
+        SimplexId cellId;
+        triangulation->getVertexStar(a, i, cellId);
+        std::array<SimplexId, 3> lowVerts{};
+        SimplexId v0{}, v1{}, v2{}, v3{};
+        triangulation->getCellVertex(cellId, 0, v0);
+        triangulation->getCellVertex(cellId, 1, v1);
+        triangulation->getCellVertex(cellId, 2, v2);
+        triangulation->getCellVertex(cellId, 3, v3);
+        if(v0 == a) {
+          lowVerts[0] = v1;
+          lowVerts[1] = v2;
+          lowVerts[2] = v3;
+        } else if(v1 == a) {
+          lowVerts[0] = v0;
+          lowVerts[1] = v2;
+          lowVerts[2] = v3;
+        } else if(v2 == a) {
+          lowVerts[0] = v0;
+          lowVerts[1] = v1;
+          lowVerts[2] = v3;
+        } else if(v3 == a) {
+          lowVerts[0] = v0;
+          lowVerts[1] = v1;
+          lowVerts[2] = v2;
+        }
+        if(vertsOrder_[a] > vertsOrder_[lowVerts[0]]
+           && vertsOrder_[a] > vertsOrder_[lowVerts[1]]
+           && vertsOrder_[a] > vertsOrder_[lowVerts[2]]) {
+          uint8_t j{}, k{};
+          // store triangles indices of current tetra
+          std::array<uint8_t, 3> faces{};
+          for(const auto &t : res[2]) {
+            if((t.lowVerts_[0] == lowVerts[0] || t.lowVerts_[0] == lowVerts[1]
+                || t.lowVerts_[0] == lowVerts[2])
+               && (t.lowVerts_[1] == lowVerts[0]
+                   || t.lowVerts_[1] == lowVerts[1]
+                   || t.lowVerts_[1] == lowVerts[2])) {
+              faces[k++] = j;
+            }
+            j++;
+          }
+
+          res[3].emplace_back(CellExt{3, cellId, lowVerts, faces});
+        }
+      }
+    }
+  }
+}
+
+template <typename triangulationType>
+inline void
+  DiscreteGradient::pairCells(CellExt &alpha,
+                              CellExt &beta,
+                              const triangulationType *const triangulation) {
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+  char localBId{0}, localAId{0};
+  SimplexId a{}, b{};
+
+  if(beta.dim_ == 1) {
+
+    for(SimplexId i = 0; i < 2; ++i) {
+      triangulation->getEdgeVertex(beta.id_, i, a);
+      if(a == alpha.id_) {
+        localAId = i;
+        break;
+      }
+    }
+    const auto nedges = triangulation->getVertexEdgeNumber(alpha.id_);
+    for(SimplexId i = 0; i < nedges; ++i) {
+      triangulation->getVertexEdge(alpha.id_, i, b);
+      if(b == beta.id_) {
+        localBId = i;
+      }
+    }
+  } else if(beta.dim_ == 2) {
+    for(SimplexId i = 0; i < 3; ++i) {
+      triangulation->getTriangleEdge(beta.id_, i, a);
+      if(a == alpha.id_) {
+        localAId = i;
+        break;
+      }
+    }
+    const auto ntri = triangulation->getEdgeTriangleNumber(alpha.id_);
+    for(SimplexId i = 0; i < ntri; ++i) {
+      triangulation->getEdgeTriangle(alpha.id_, i, b);
+      if(b == beta.id_) {
+        localBId = i;
+      }
+    }
+  } else {
+    for(SimplexId i = 0; i < 4; ++i) {
+      triangulation->getCellTriangle(beta.id_, i, a);
+      if(a == alpha.id_) {
+        localAId = i;
+        break;
+      }
+    }
+    const auto ntetra = triangulation->getTriangleStarNumber(alpha.id_);
+    for(SimplexId i = 0; i < ntetra; ++i) {
+      triangulation->getTriangleStar(alpha.id_, i, b);
+      if(b == beta.id_) {
+        localBId = i;
+      }
+    }
+  }
+  gradient_[alpha.dim_][alpha.dim_][alpha.id_] = localBId;
+  gradient_[alpha.dim_][alpha.dim_ + 1][beta.id_] = localAId;
+#else
+  gradient_[alpha.dim_][alpha.dim_][alpha.id_] = beta.id_;
+  gradient_[alpha.dim_][alpha.dim_ + 1][beta.id_] = alpha.id_;
+#endif // TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+  alpha.paired_ = true;
+  beta.paired_ = true;
+}
+
+template <typename triangulationType>
+int DiscreteGradient::processLowerStars(
+  const triangulationType *const triangulation) {
+
+  /* Compute gradient */
+
+  auto nverts = triangulation->getNumberOfVertices();
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  {
+    // Comparison function for Cells inside priority queues
+    const auto orderCells = [&](const CellExt &a, const CellExt &b) -> bool {
+      if(a.dim_ == b.dim_) {
+        // there should be a shared facet between the two cells
+        // compare the vertices not in the shared facet
+        if(a.dim_ == 1) {
+          return vertsOrder_[a.lowVerts_[0]] > vertsOrder_[b.lowVerts_[0]];
+
+        } else if(a.dim_ == 2) {
+          const auto &m0 = a.lowVerts_[0];
+          const auto &m1 = a.lowVerts_[1];
+          const auto &n0 = b.lowVerts_[0];
+          const auto &n1 = b.lowVerts_[1];
+
+          if(m0 == n0) {
+            return vertsOrder_[m1] > vertsOrder_[n1];
+          } else if(m0 == n1) {
+            return vertsOrder_[m1] > vertsOrder_[n0];
+          } else if(m1 == n0) {
+            return vertsOrder_[m0] > vertsOrder_[n1];
+          } else if(m1 == n1) {
+            return vertsOrder_[m0] > vertsOrder_[n0];
+          }
+
+        } else if(a.dim_ == 3) {
+          SimplexId m{-1}, n{-1};
+
+          const auto &m0 = a.lowVerts_[0];
+          const auto &m1 = a.lowVerts_[1];
+          const auto &m2 = a.lowVerts_[2];
+          const auto &n0 = b.lowVerts_[0];
+          const auto &n1 = b.lowVerts_[1];
+          const auto &n2 = b.lowVerts_[2];
+
+          // extract vertex of a not in b
+          if(m0 != n0 && m0 != n1 && m0 != n2) {
+            m = m0;
+          } else if(m1 != n0 && m1 != n1 && m1 != n2) {
+            m = m1;
+          } else if(m2 != n0 && m2 != n1 && m2 != n2) {
+            m = m2;
+          }
+
+          // extract vertex of b not in a
+          if(n0 != m0 && n0 != m1 && n0 != m2) {
+            n = n0;
+          } else if(n1 != m0 && n1 != m1 && n1 != m2) {
+            n = n1;
+          } else if(n2 != m0 && n2 != m1 && n2 != m2) {
+            n = n2;
+          }
+
+          return vertsOrder_[m] > vertsOrder_[n];
+        }
+      } else {
+        // the cell of greater dimension should contain the cell of
+        // smaller dimension
+        return a.dim_ > b.dim_;
+      }
+
+      return false;
+    };
+
+    // Type alias for priority queues
+    using pqType
+      = std::priority_queue<std::reference_wrapper<CellExt>,
+                            std::vector<std::reference_wrapper<CellExt>>,
+                            decltype(orderCells)>;
+
+    // Priority queues are pushed at the beginning and popped at the
+    // end. To pop the minimum, elements should be sorted in a
+    // decreasing order.
+    pqType pqZero(orderCells), pqOne(orderCells);
+
+    // Insert into pqOne cofacets of cell c_alpha such as numUnpairedFaces == 1
+    const auto insertCofacets = [&](const CellExt &ca, lowerStarType &ls) {
+      if(ca.dim_ == 1) {
+        for(auto &beta : ls[2]) {
+          if(ls[1][beta.faces_[0]].id_ == ca.id_
+             || ls[1][beta.faces_[1]].id_ == ca.id_) {
+            // edge ca belongs to triangle beta
+            if(numUnpairedFacesTriangle(beta, ls).first == 1) {
+              pqOne.push(beta);
+            }
+          }
+        }
+
+      } else if(ca.dim_ == 2) {
+        for(auto &beta : ls[3]) {
+          if(ls[2][beta.faces_[0]].id_ == ca.id_
+             || ls[2][beta.faces_[1]].id_ == ca.id_
+             || ls[2][beta.faces_[2]].id_ == ca.id_) {
+            // triangle ca belongs to tetra beta
+            if(numUnpairedFacesTetra(beta, ls).first == 1) {
+              pqOne.push(beta);
+            }
+          }
+        }
+      }
+    };
+
+    // The lower star and the priority queues are thread-local and reused
+    // for every vertex: the queues are empty at the end of each iteration
+    // and the lower star vectors keep their capacity once cleared.
+    lowerStarType Lx{};
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId x = 0; x < nverts; x++) {
+      lowerStar(Lx, x, triangulation);
+
+      // Lx[1] empty => x is a local minimum
+
+      if(!Lx[1].empty()) {
+        // get delta: 1-cell (edge) with minimal G value (steeper gradient)
+        size_t minId = 0;
+        for(size_t i = 1; i < Lx[1].size(); ++i) {
+          const auto &a = Lx[1][minId].lowVerts_[0];
+          const auto &b = Lx[1][i].lowVerts_[0];
+          if(vertsOrder_[a] > vertsOrder_[b]) {
+            // edge[i] < edge[0]
+            minId = i;
+          }
+        }
+
+        auto &c_delta = Lx[1][minId];
+
+        // store x (0-cell) -> delta (1-cell) V-path
+        pairCells(Lx[0][0], c_delta, triangulation);
+
+        // push every 1-cell in Lx that is not delta into pqZero
+        for(auto &alpha : Lx[1]) {
+          if(alpha.id_ != c_delta.id_) {
+            pqZero.push(alpha);
+          }
+        }
+
+        // push into pqOne every coface of delta in Lx (2-cells only,
+        // 3-cells have not any facet paired yet) such that
+        // numUnpairedFaces == 1
+        insertCofacets(c_delta, Lx);
+
+        while(!pqOne.empty() || !pqZero.empty()) {
+          while(!pqOne.empty()) {
+            auto &c_alpha = pqOne.top().get();
+            pqOne.pop();
+            auto unpairedFaces = numUnpairedFaces(c_alpha, Lx);
+            if(unpairedFaces.first == 0) {
+              pqZero.push(c_alpha);
+            } else {
+              auto &c_pair_alpha = Lx[c_alpha.dim_ - 1][unpairedFaces.second];
+
+              // store (pair_alpha) -> (alpha) V-path
+              pairCells(c_pair_alpha, c_alpha, triangulation);
+
+              // add cofaces of c_alpha and c_pair_alpha to pqOne
+              insertCofacets(c_alpha, Lx);
+              insertCofacets(c_pair_alpha, Lx);
+            }
+          }
+
+          // skip pair_alpha from pqZero:
+          // cells in pqZero are not critical if already paired
+          while(!pqZero.empty() && pqZero.top().get().paired_) {
+            pqZero.pop();
+          }
+
+          if(!pqZero.empty()) {
+            auto &c_gamma = pqZero.top().get();
+            pqZero.pop();
+
+            // gamma is a critical cell
+            // mark gamma as paired
+            c_gamma.paired_ = true;
+
+            // add cofacets of c_gamma to pqOne
+            insertCofacets(c_gamma, Lx);
+          }
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
 template <typename dataType, typename idType>
 int DiscreteGradient::buildGradient() {
+  const debug::TraceSpan span("DiscreteGradient", "buildGradient");
   Timer t;
 
   const auto *const offsets = static_cast<const idType *>(inputOffsets_);
@@ -218,14 +634,39 @@ int DiscreteGradient::buildGradient() {
   for(int i = 0; i < dimensionality_; ++i) {
     // init gradient memory
     gradient_[i].resize(numberOfDimensions);
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+    // local index among the cofacets of the i-cells
+    gradient_[i][i].init(numberOfCells[i], getMaxNumberOfCofacets(i));
+    // local index among the i + 2 facets of the (i+1)-cells
+    gradient_[i][i + 1].init(numberOfCells[i + 1], i + 2);
+#else
     gradient_[i][i].resize(numberOfCells[i], -1);
     gradient_[i][i + 1].resize(numberOfCells[i + 1], -1);
+#endif // TTK_ENABLE_DCG_OPTIMIZE_MEMORY
   }
 
-  sortVertices(numberOfCells[0], vertsOrder_, scalars, offsets);
+  debug::TraceSpan orderSpan("DiscreteGradient", "vertexOrder");
+  if(inputVertexOrder_ != nullptr) {
+    vertsOrder_.resize(numberOfCells[0]);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < numberOfCells[0]; ++i) {
+      vertsOrder_[i] = inputVertexOrder_[i];
+    }
+  } else {
+    sortVertices(numberOfCells[0], vertsOrder_, scalars, offsets);
+  }
+
+  orderSpan.end();
 
   // compute gradient pairs
-  processLowerStars();
+  {
+    const debug::TraceSpan pairsSpan("DiscreteGradient", "processLowerStars");
+    ttkTemplateMacro(
+      inputTriangulation_->getType(),
+      processLowerStars((TTK_TT *)inputTriangulation_->getData()));
+  }
 
   {
     std::stringstream msg;
@@ -239,6 +680,17 @@ int DiscreteGradient::buildGradient() {
           << std::endl;
     }
 
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+    size_t footprint{};
+    for(const auto &arrays : gradient_) {
+      for(const auto &localIds : arrays) {
+        footprint += localIds.getMemoryFootprint();
+      }
+    }
+    msg << "[DiscreteGradient] Gradient storage: " << footprint / 1024
+        << " KB." << std::endl;
+#endif // TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+
     msg << "[DiscreteGradient] Processed in " << t.getElapsedTime() << " s. ("
         << threadNumber_ << " thread(s))." << std::endl;
     dMsg(std::cout, msg.str(), timeMsg);
@@ -1115,6 +1567,8 @@ int DiscreteGradient::simplifySaddleSaddleConnections1(
   const bool allowBoundary,
   const bool allowBruteForce,
   const bool returnSaddleConnectors) {
+  const debug::TraceSpan span(
+    "DiscreteGradient", "simplifySaddleSaddleConnections1");
   Timer t;
 
   // Part 0 : get removable cells
@@ -1725,6 +2179,8 @@ int DiscreteGradient::simplifySaddleSaddleConnections2(
   const bool allowBoundary,
   const bool allowBruteForce,
   const bool returnSaddleConnectors) {
+  const debug::TraceSpan span(
+    "DiscreteGradient", "simplifySaddleSaddleConnections2");
   Timer t;
 
   // Part 0 : get removable cells
@@ -1843,6 +2299,7 @@ int DiscreteGradient::filterSaddleConnectors(const bool allowBoundary) {
 
 template <typename dataType, typename idType>
 int DiscreteGradient::reverseGradient(bool detectCriticalPoints) {
+  const debug::TraceSpan span("DiscreteGradient", "reverseGradient");
 
   std::vector<std::pair<SimplexId, char>> criticalPoints{};
 
@@ -10,11 +10,21 @@
 /// identifiers attached to them) and produces a distance field to the closest
 /// source.
 ///
+/// By default, all the sources are propagated in a single Dijkstra front
+/// (linear memory in the number of vertices). The parallel variant
+/// (delta-stepping) processes the vertices by distance buckets of width
+/// Delta, each bucket being relaxed in parallel. Ties are broken towards the
+/// source of lowest index in the three methods.
+///
 /// \b Related \b publication \n
 /// "A note on two problems in connexion with graphs" \n
 /// Edsger W. Dijkstra \n
 /// Numerische Mathematik, 1959.
 ///
+/// "Delta-stepping: a parallelizable shortest path algorithm" \n
+/// Ulrich Meyer, Peter Sanders \n
+/// Journal of Algorithms, 2003.
+///
 /// \sa ttkDistanceField.cpp %for a usage example.
 
 #ifndef _DISTANCEFIELD_H
@@ -27,7 +37,10 @@
 #include <Wrapper.h>
 
 // std includes
+#include <array>
+#include <cmath>
 #include <limits>
+#include <queue>
 #include <set>
 
 namespace ttk {
@@ -38,12 +51,27 @@ namespace ttk {
     DistanceField();
     ~DistanceField();
 
+    enum class PropagationMethod { PER_SOURCE, MULTI_SOURCE, DELTA_STEPPING };
+
     template <typename dataType>
     dataType getDistance(const SimplexId a, const SimplexId b) const;
 
     template <typename dataType>
     int execute() const;
 
+    inline int setPropagationMethod(int method) {
+      propagationMethod_ = static_cast<PropagationMethod>(method);
+      return 0;
+    }
+
+    // Bucket width of the delta-stepping (0: mean edge length). Widths
+    // below the diagonal of the bounding box divided by the number of
+    // vertices are raised to it.
+    inline int setDelta(double delta) {
+      delta_ = delta;
+      return 0;
+    }
+
     inline int setVertexNumber(SimplexId vertexNumber) {
       vertexNumber_ = vertexNumber;
       return 0;
@@ -83,6 +111,31 @@ namespace ttk {
     }
 
   protected:
+    template <typename dataType>
+    int executePerSource(const std::vector<SimplexId> &sources,
+                         dataType *dist,
+                         SimplexId *origin,
+                         SimplexId *seg) const;
+    template <typename dataType>
+    int executeMultiSource(const std::vector<SimplexId> &sources,
+                           dataType *dist,
+                           SimplexId *origin,
+                           SimplexId *seg) const;
+    template <typename dataType>
+    int executeDeltaStepping(const std::vector<SimplexId> &sources,
+                             dataType *dist,
+                             SimplexId *origin,
+                             SimplexId *seg) const;
+
+    template <typename dataType>
+    inline dataType getEdgeLength(const float *p, const SimplexId v) const {
+      std::array<float, 3> q{};
+      triangulation_->getVertexPoint(v, q[0], q[1], q[2]);
+      return Geometry::distance(p, q.data());
+    }
+
+    PropagationMethod propagationMethod_{PropagationMethod::MULTI_SOURCE};
+    double delta_{0};
     SimplexId vertexNumber_;
     SimplexId sourceNumber_;
     Triangulation *triangulation_;
@@ -103,8 +156,10 @@ int ttk::DistanceField::execute() const {
 
   Timer t;
 
-  std::fill(dist, dist + vertexNumber_, std::numeric_limits<dataType>::max());
-  std::fill(origin, origin + vertexNumber_, -1);
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!triangulation_ || !identifiers || !dist || !origin || !seg)
+    return -1;
+#endif
 
   // get the sources
   std::set<SimplexId> isSource;
@@ -115,6 +170,40 @@ int ttk::DistanceField::execute() const {
     sources.push_back(s);
   isSource.clear();
 
+  int ret = 0;
+  switch(propagationMethod_) {
+    case PropagationMethod::PER_SOURCE:
+      ret = executePerSource(sources, dist, origin, seg);
+      break;
+    case PropagationMethod::MULTI_SOURCE:
+      ret = executeMultiSource(sources, dist, origin, seg);
+      break;
+    case PropagationMethod::DELTA_STEPPING:
+      ret = executeDeltaStepping(sources, dist, origin, seg);
+      break;
+  }
+  if(ret != 0)
+    return ret;
+
+  {
+    std::stringstream msg;
+    msg << "[DistanceField] Data-set (" << vertexNumber_
+        << " points) processed in " << t.getElapsedTime() << " s. ("
+        << threadNumber_ << " thread(s))." << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+template <typename dataType>
+int ttk::DistanceField::executePerSource(const std::vector<SimplexId> &sources,
+                                         dataType *dist,
+                                         SimplexId *origin,
+                                         SimplexId *seg) const {
+  std::fill(dist, dist + vertexNumber_, std::numeric_limits<dataType>::max());
+  std::fill(origin, origin + vertexNumber_, -1);
+
   // prepare output
   std::vector<std::vector<dataType>> scalars(sources.size());
 
@@ -138,14 +227,260 @@ int ttk::DistanceField::execute() const {
     }
   }
 
+  return 0;
+}
+
+template <typename dataType>
+int ttk::DistanceField::executeMultiSource(
+  const std::vector<SimplexId> &sources,
+  dataType *dist,
+  SimplexId *origin,
+  SimplexId *seg) const {
+  std::fill(
+    dist, dist + vertexNumber_, std::numeric_limits<dataType>::infinity());
+  std::fill(origin, origin + vertexNumber_, -1);
+  std::fill(seg, seg + vertexNumber_, -1);
+
+  // (distance, seed index, vertex): lowest seed index first on ties
+  using pq_t = std::tuple<dataType, SimplexId, SimplexId>;
+  std::priority_queue<pq_t, std::vector<pq_t>, std::greater<pq_t>> pq;
+
+  for(SimplexId i = 0; i < (SimplexId)sources.size(); ++i) {
+    dist[sources[i]] = 0;
+    origin[sources[i]] = sources[i];
+    seg[sources[i]] = i;
+    pq.emplace(dataType(0), i, sources[i]);
+  }
+
+  while(!pq.empty()) {
+    const auto elem = pq.top();
+    pq.pop();
+    const SimplexId vert = std::get<2>(elem);
+    // outdated entry
+    if(std::get<0>(elem) != dist[vert] || std::get<1>(elem) != seg[vert])
+      continue;
+
+    std::array<float, 3> p{};
+    triangulation_->getVertexPoint(vert, p[0], p[1], p[2]);
+
+    const SimplexId neighborNumber
+      = triangulation_->getVertexNeighborNumber(vert);
+    for(SimplexId j = 0; j < neighborNumber; ++j) {
+      SimplexId neigh{};
+      triangulation_->getVertexNeighbor(vert, j, neigh);
+      const dataType d = dist[vert] + getEdgeLength<dataType>(p.data(), neigh);
+      if(d < dist[neigh] || (d == dist[neigh] && seg[vert] < seg[neigh])) {
+        dist[neigh] = d;
+        origin[neigh] = origin[vert];
+        seg[neigh] = seg[vert];
+        pq.emplace(d, seg[neigh], neigh);
+      }
+    }
+  }
+
+  return 0;
+}
+
+template <typename dataType>
+int ttk::DistanceField::executeDeltaStepping(
+  const std::vector<SimplexId> &sources,
+  dataType *dist,
+  SimplexId *origin,
+  SimplexId *seg) const {
+  std::fill(
+    dist, dist + vertexNumber_, std::numeric_limits<dataType>::infinity());
+  std::fill(seg, seg + vertexNumber_, -1);
+
+  // bucket width
+  double delta = delta_;
+  if(delta <= 0) {
+    // mean edge length, on a sample of the vertices
+    double sum = 0;
+    SimplexId edgeNumber = 0;
+    const SimplexId step = std::max<SimplexId>(1, vertexNumber_ / 1024);
+    for(SimplexId v = 0; v < vertexNumber_; v += step) {
+      std::array<float, 3> p{};
+      triangulation_->getVertexPoint(v, p[0], p[1], p[2]);
+      const SimplexId neighborNumber
+        = triangulation_->getVertexNeighborNumber(v);
+      for(SimplexId j = 0; j < neighborNumber; ++j) {
+        SimplexId neigh{};
+        triangulation_->getVertexNeighbor(v, j, neigh);
+        sum += getEdgeLength<double>(p.data(), neigh);
+        edgeNumber++;
+      }
+    }
+    delta = (edgeNumber > 0 && sum > 0) ? sum / edgeNumber : 1.0;
+  }
   {
-    std::stringstream msg;
-    msg << "[DistanceField] Data-set (" << vertexNumber_
-        << " points) processed in " << t.getElapsedTime() << " s. ("
-        << threadNumber_ << " thread(s))." << std::endl;
-    dMsg(std::cout, msg.str(), timeMsg);
+    // at least the diagonal of the bounding box divided by the number of
+    // vertices, so that the number of buckets stays in O(vertexNumber_)
+    std::array<float, 3> lower{}, upper{};
+    for(SimplexId v = 0; v < vertexNumber_; ++v) {
+      std::array<float, 3> p{};
+      triangulation_->getVertexPoint(v, p[0], p[1], p[2]);
+      for(int j = 0; j < 3; ++j) {
+        lower[j] = v ? std::min(lower[j], p[j]) : p[j];
+        upper[j] = v ? std::max(upper[j], p[j]) : p[j];
+      }
+    }
+    double diagonal = 0;
+    for(int j = 0; j < 3; ++j)
+      diagonal += ((double)upper[j] - lower[j]) * ((double)upper[j] - lower[j]);
+    diagonal = std::sqrt(diagonal);
+    if(diagonal > 0)
+      delta = std::max(delta, diagonal / std::max<SimplexId>(vertexNumber_, 1));
   }
 
+  int threadNumber = 1;
+#ifdef TTK_ENABLE_OPENMP
+  threadNumber = std::max(threadNumber_, 1);
+#endif
+
+  // each vertex v is owned by the thread v % threadNumber, which is the only
+  // one to update its distance and to queue it in its buckets
+  std::vector<std::vector<std::vector<SimplexId>>> buckets(threadNumber);
+  // bucket in which each vertex is queued (-1: none)
+  std::vector<SimplexId> queued(vertexNumber_, -1);
+  // last bucket in which each vertex was processed (-1: none)
+  std::vector<SimplexId> processed(vertexNumber_, -1);
+
+  // relaxation requests, from each thread to each owner
+  struct Request {
+    SimplexId vertex;
+    dataType distance;
+    SimplexId seed;
+  };
+  std::vector<std::vector<std::vector<Request>>> requests(
+    threadNumber, std::vector<std::vector<Request>>(threadNumber));
+
+  const auto queue = [&](const int owner, const SimplexId v,
+                         const SimplexId bucket) {
+    if(queued[v] == bucket)
+      return;
+    queued[v] = bucket;
+    auto &ownerBuckets = buckets[owner];
+    if((SimplexId)ownerBuckets.size() <= bucket)
+      ownerBuckets.resize(bucket + 1);
+    ownerBuckets[bucket].push_back(v);
+  };
+
+  for(SimplexId i = 0; i < (SimplexId)sources.size(); ++i) {
+    dist[sources[i]] = 0;
+    seg[sources[i]] = i;
+    queue(sources[i] % threadNumber, sources[i], 0);
+  }
+
+  // relaxes the light (or heavy) edges of the given vertices
+  const auto relax = [&](const std::vector<SimplexId> &vertices,
+                         const bool light, const SimplexId current) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber)
+#endif
+    {
+      int tid = 0;
+#ifdef TTK_ENABLE_OPENMP
+      tid = omp_get_thread_num();
+#endif
+      auto &threadRequests = requests[tid];
+
+      // 1. requests (distances are only read)
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+      for(size_t i = 0; i < vertices.size(); ++i) {
+        const SimplexId v = vertices[i];
+        std::array<float, 3> p{};
+        triangulation_->getVertexPoint(v, p[0], p[1], p[2]);
+        const SimplexId neighborNumber
+          = triangulation_->getVertexNeighborNumber(v);
+        for(SimplexId j = 0; j < neighborNumber; ++j) {
+          SimplexId neigh{};
+          triangulation_->getVertexNeighbor(v, j, neigh);
+          const dataType w = getEdgeLength<dataType>(p.data(), neigh);
+          if((w <= delta) != light)
+            continue;
+          const dataType d = dist[v] + w;
+          if(d < dist[neigh] || (d == dist[neigh] && seg[v] < seg[neigh]))
+            threadRequests[neigh % threadNumber].push_back({neigh, d, seg[v]});
+        }
+      }
+      // (implicit barrier)
+
+      // 2. each owner applies the requests on its vertices
+      for(int t = 0; t < threadNumber; ++t) {
+        for(const auto &r : requests[t][tid]) {
+          if(r.distance < dist[r.vertex]
+             || (r.distance == dist[r.vertex] && r.seed < seg[r.vertex])) {
+            dist[r.vertex] = r.distance;
+            seg[r.vertex] = r.seed;
+            queue(tid, r.vertex,
+                  std::max(current, (SimplexId)(r.distance / delta)));
+          }
+        }
+      }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp barrier
+#endif
+      for(int t = 0; t < threadNumber; ++t)
+        requests[t][tid].clear();
+    }
+  };
+
+  std::vector<SimplexId> frontier, bucketVertices;
+  SimplexId current = 0;
+  while(true) {
+    // smallest non-empty bucket
+    SimplexId next = -1;
+    for(int t = 0; t < threadNumber; ++t) {
+      for(SimplexId b = current; b < (SimplexId)buckets[t].size(); ++b) {
+        if(!buckets[t][b].empty()) {
+          if(next == -1 || b < next)
+            next = b;
+          break;
+        }
+      }
+    }
+    if(next == -1)
+      break;
+    current = next;
+
+    // light edges, until no vertex is queued in the current bucket
+    bucketVertices.clear();
+    while(true) {
+      frontier.clear();
+      for(int t = 0; t < threadNumber; ++t) {
+        if((SimplexId)buckets[t].size() <= current)
+          continue;
+        for(const auto v : buckets[t][current]) {
+          // skip duplicates and vertices moved to another bucket
+          if(queued[v] != current)
+            continue;
+          queued[v] = -1;
+          frontier.push_back(v);
+          if(processed[v] != current) {
+            processed[v] = current;
+            bucketVertices.push_back(v);
+          }
+        }
+        buckets[t][current].clear();
+      }
+      if(frontier.empty())
+        break;
+      relax(frontier, true, current);
+    }
+
+    // heavy edges, once per bucket
+    relax(bucketVertices, false, current);
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < vertexNumber_; ++k)
+    origin[k] = seg[k] != -1 ? sources[seg[k]] : -1;
+
   return 0;
 }
 
@@ -1,8 +1,18 @@
 #include <ExplicitTriangulation.h>
 
+#include <mutex>
+
 using namespace std;
 using namespace ttk;
 
+namespace {
+  // serializes the lazy expansions of the global list getters
+  std::mutex &getExpandMutex() {
+    static std::mutex expandMutex;
+    return expandMutex;
+  }
+} // namespace
+
 ExplicitTriangulation::ExplicitTriangulation() {
 
   setDebugMsgPrefix("ExplicitTriangulation");
@@ -21,9 +31,91 @@ int ExplicitTriangulation::clear() {
   cellNumber_ = 0;
   doublePrecision_ = false;
 
+  cellEdges_.clear();
+  cellNeighbors_.clear();
+  cellTriangles_.clear();
+  edgeLinks_.clear();
+  edgeStars_.clear();
+  edgeTriangles_.clear();
+  triangles_.clear();
+  triangleEdges_.clear();
+  triangleLinks_.clear();
+  triangleStars_.clear();
+  vertexEdges_.clear();
+  vertexLinks_.clear();
+  vertexNeighbors_.clear();
+  vertexStars_.clear();
+  vertexTriangles_.clear();
+  stagedLists_.clear();
+
   printMsg(
     "[ExplicitTriangulation] Triangulation cleared.", debug::Priority::DETAIL);
   // clear twice ??
 
   return AbstractTriangulation::clear();
 }
+
+int ExplicitTriangulation::compactRelations() {
+
+  const std::array<std::pair<FlatJaggedArray *, vector<vector<SimplexId>> *>,
+                   15>
+    relations{{{&cellEdges_, &cellEdgeList_},
+               {&cellNeighbors_, &cellNeighborList_},
+               {&cellTriangles_, &cellTriangleList_},
+               {&edgeLinks_, &edgeLinkList_},
+               {&edgeStars_, &edgeStarList_},
+               {&edgeTriangles_, &edgeTriangleList_},
+               {&triangles_, &triangleList_},
+               {&triangleEdges_, &triangleEdgeList_},
+               {&triangleLinks_, &triangleLinkList_},
+               {&triangleStars_, &triangleStarList_},
+               {&vertexEdges_, &vertexEdgeList_},
+               {&vertexLinks_, &vertexLinkList_},
+               {&vertexNeighbors_, &vertexNeighborList_},
+               {&vertexStars_, &vertexStarList_},
+               {&vertexTriangles_, &vertexTriangleList_}}};
+
+  for(const auto &r : relations) {
+    if(r.first->empty() && !r.second->empty()) {
+      r.first->setThreadNumber(threadNumber_);
+      r.first->fillFrom(*r.second);
+      vector<vector<SimplexId>>{}.swap(*r.second);
+    }
+  }
+
+  // jagged copies expanded as skeleton inputs are not needed anymore
+  for(auto list : stagedLists_) {
+    vector<vector<SimplexId>>{}.swap(*list);
+  }
+  stagedLists_.clear();
+
+  return 0;
+}
+
+const vector<vector<SimplexId>> *
+  ExplicitTriangulation::expand(const FlatJaggedArray &compact,
+                                vector<vector<SimplexId>> &list) const {
+
+  std::lock_guard<std::mutex> lock(getExpandMutex());
+  if(list.empty() && !compact.empty()) {
+    compact.copyTo(list);
+  }
+  return &list;
+}
+
+size_t ExplicitTriangulation::footprint() const {
+
+  const size_t compactSize
+    = cellEdges_.footprint() + cellNeighbors_.footprint()
+      + cellTriangles_.footprint() + edgeLinks_.footprint()
+      + edgeStars_.footprint() + edgeTriangles_.footprint()
+      + triangles_.footprint() + triangleEdges_.footprint()
+      + triangleLinks_.footprint() + triangleStars_.footprint()
+      + vertexEdges_.footprint() + vertexLinks_.footprint()
+      + vertexNeighbors_.footprint() + vertexStars_.footprint()
+      + vertexTriangles_.footprint();
+
+  printMsg("Compact relations: " + std::to_string(compactSize) + " bytes");
+
+  return AbstractTriangulation::footprint() + compactSize;
+}
@@ -12,6 +12,7 @@
 
 // base code includes
 #include <AbstractTriangulation.h>
+#include <FlatJaggedArray.h>
 #include <OneSkeleton.h>
 #include <ThreeSkeleton.h>
 #include <TwoSkeleton.h>
@@ -28,36 +29,36 @@ namespace ttk {
 
     virtual ~ExplicitTriangulation();
 
-    int clear();
+    int clear() override;
 
     inline int getCellEdgeInternal(const SimplexId &cellId,
                                    const int &localEdgeId,
                                    SimplexId &edgeId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellEdgeList_.size()))
+      if((cellId < 0) || (cellId >= cellEdges_.size()))
         return -1;
       if((localEdgeId < 0)
-         || (localEdgeId >= (SimplexId)cellEdgeList_[cellId].size()))
+         || (localEdgeId >= cellEdges_[cellId].size()))
         return -2;
 #endif
-      edgeId = cellEdgeList_[cellId][localEdgeId];
+      edgeId = cellEdges_[cellId][localEdgeId];
       return 0;
     }
 
     inline SimplexId
       getCellEdgeNumberInternal(const SimplexId &cellId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellEdgeList_.size()))
+      if((cellId < 0) || (cellId >= cellEdges_.size()))
         return -1;
 #endif
-      return cellEdgeList_[cellId].size();
+      return cellEdges_[cellId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getCellEdgesInternal() override {
 
-      return &cellEdgeList_;
+      return expand(cellEdges_, cellEdgeList_);
     }
 
     inline int TTK_TRIANGULATION_INTERNAL(getCellNeighbor)(
@@ -65,28 +66,28 @@ namespace ttk {
       const int &localNeighborId,
       SimplexId &neighborId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellNeighborList_.size()))
+      if((cellId < 0) || (cellId >= cellNeighbors_.size()))
         return -1;
       if((localNeighborId < 0)
-         || (localNeighborId >= (SimplexId)cellNeighborList_[cellId].size()))
+         || (localNeighborId >= cellNeighbors_[cellId].size()))
         return -2;
 #endif
-      neighborId = cellNeighborList_[cellId][localNeighborId];
+      neighborId = cellNeighbors_[cellId][localNeighborId];
       return 0;
     }
 
     inline SimplexId TTK_TRIANGULATION_INTERNAL(getCellNeighborNumber)(
       const SimplexId &cellId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellNeighborList_.size()))
+      if((cellId < 0) || (cellId >= cellNeighbors_.size()))
         return -1;
 #endif
-      return cellNeighborList_[cellId].size();
+      return cellNeighbors_[cellId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       TTK_TRIANGULATION_INTERNAL(getCellNeighbors)() override {
-      return &cellNeighborList_;
+      return expand(cellNeighbors_, cellNeighborList_);
     }
 
     inline int getCellTriangleInternal(const SimplexId &cellId,
@@ -94,13 +95,13 @@ namespace ttk {
                                        SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellTriangleList_.size()))
+      if((cellId < 0) || (cellId >= cellTriangles_.size()))
         return -1;
       if((localTriangleId < 0)
-         || (localTriangleId >= (SimplexId)cellTriangleList_[cellId].size()))
+         || (localTriangleId >= cellTriangles_[cellId].size()))
         return -2;
 #endif
-      triangleId = cellTriangleList_[cellId][localTriangleId];
+      triangleId = cellTriangles_[cellId][localTriangleId];
 
       return 0;
     }
@@ -109,17 +110,17 @@ namespace ttk {
       getCellTriangleNumberInternal(const SimplexId &cellId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellTriangleList_.size()))
+      if((cellId < 0) || (cellId >= cellTriangles_.size()))
         return -1;
 #endif
 
-      return cellTriangleList_[cellId].size();
+      return cellTriangles_[cellId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getCellTrianglesInternal() override {
 
-      return &cellTriangleList_;
+      return expand(cellTriangles_, cellTriangleList_);
     }
 
     inline int TTK_TRIANGULATION_INTERNAL(getCellVertex)(
@@ -157,28 +158,28 @@ namespace ttk {
       const int &localLinkId,
       SimplexId &linkId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeLinkList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeLinks_.size()))
         return -1;
       if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)edgeLinkList_[edgeId].size()))
+         || (localLinkId >= edgeLinks_[edgeId].size()))
         return -2;
 #endif
-      linkId = edgeLinkList_[edgeId][localLinkId];
+      linkId = edgeLinks_[edgeId][localLinkId];
       return 0;
     }
 
     inline SimplexId TTK_TRIANGULATION_INTERNAL(getEdgeLinkNumber)(
       const SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeLinkList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeLinks_.size()))
         return -1;
 #endif
-      return edgeLinkList_[edgeId].size();
+      return edgeLinks_[edgeId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       TTK_TRIANGULATION_INTERNAL(getEdgeLinks)() override {
-      return &edgeLinkList_;
+      return expand(edgeLinks_, edgeLinkList_);
     }
 
     inline int TTK_TRIANGULATION_INTERNAL(getEdgeStar)(
@@ -186,28 +187,28 @@ namespace ttk {
       const int &localStarId,
       SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeStarList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeStars_.size()))
         return -1;
       if((localStarId < 0)
-         || (localStarId >= (SimplexId)edgeStarList_[edgeId].size()))
+         || (localStarId >= edgeStars_[edgeId].size()))
         return -2;
 #endif
-      starId = edgeStarList_[edgeId][localStarId];
+      starId = edgeStars_[edgeId][localStarId];
       return 0;
     }
 
     inline SimplexId TTK_TRIANGULATION_INTERNAL(getEdgeStarNumber)(
       const SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeStarList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeStars_.size()))
         return -1;
 #endif
-      return edgeStarList_[edgeId].size();
+      return edgeStars_[edgeId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       TTK_TRIANGULATION_INTERNAL(getEdgeStars)() override {
-      return &edgeStarList_;
+      return expand(edgeStars_, edgeStarList_);
     }
 
     inline int getEdgeTriangleInternal(const SimplexId &edgeId,
@@ -215,14 +216,14 @@ namespace ttk {
                                        SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeTriangleList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeTriangles_.size()))
         return -1;
       if((localTriangleId < 0)
-         || (localTriangleId >= (SimplexId)edgeTriangleList_[edgeId].size()))
+         || (localTriangleId >= edgeTriangles_[edgeId].size()))
         return -2;
 #endif
 
-      triangleId = edgeTriangleList_[edgeId][localTriangleId];
+      triangleId = edgeTriangles_[edgeId][localTriangleId];
 
       return 0;
     }
@@ -231,17 +232,17 @@ namespace ttk {
       getEdgeTriangleNumberInternal(const SimplexId &edgeId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeTriangleList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeTriangles_.size()))
         return -1;
 #endif
 
-      return edgeTriangleList_[edgeId].size();
+      return edgeTriangles_[edgeId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getEdgeTrianglesInternal() override {
 
-      return &edgeTriangleList_;
+      return expand(edgeTriangles_, edgeTriangleList_);
     }
 
     inline int getEdgeVertexInternal(const SimplexId &edgeId,
@@ -270,7 +271,7 @@ namespace ttk {
     }
 
     inline SimplexId getNumberOfTrianglesInternal() const override {
-      return triangleList_.size();
+      return triangles_.size();
     }
 
     inline SimplexId
@@ -280,7 +281,7 @@ namespace ttk {
 
     inline const std::vector<std::vector<SimplexId>> *
       TTK_TRIANGULATION_INTERNAL(getTriangles)() override {
-      return &triangleList_;
+      return expand(triangles_, triangleList_);
     }
 
     inline int getTriangleEdgeInternal(const SimplexId &triangleId,
@@ -289,13 +290,13 @@ namespace ttk {
 
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleEdgeList_.size()))
+         || (triangleId >= triangleEdges_.size()))
         return -1;
       if((localEdgeId < 0) || (localEdgeId > 2))
         return -2;
 #endif
 
-      edgeId = triangleEdgeList_[triangleId][localEdgeId];
+      edgeId = triangleEdges_[triangleId][localEdgeId];
 
       return 0;
     }
@@ -305,17 +306,17 @@ namespace ttk {
 
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleEdgeList_.size()))
+         || (triangleId >= triangleEdges_.size()))
         return -1;
 #endif
 
-      return triangleEdgeList_[triangleId].size();
+      return triangleEdges_[triangleId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getTriangleEdgesInternal() override {
 
-      return &triangleEdgeList_;
+      return expand(triangleEdges_, triangleEdgeList_);
     }
 
     inline int TTK_TRIANGULATION_INTERNAL(getTriangleLink)(
@@ -324,13 +325,13 @@ namespace ttk {
       SimplexId &linkId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleLinkList_.size()))
+         || (triangleId >= triangleLinks_.size()))
         return -1;
       if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)triangleLinkList_[triangleId].size()))
+         || (localLinkId >= triangleLinks_[triangleId].size()))
         return -2;
 #endif
-      linkId = triangleLinkList_[triangleId][localLinkId];
+      linkId = triangleLinks_[triangleId][localLinkId];
       return 0;
     }
 
@@ -338,15 +339,15 @@ namespace ttk {
       const SimplexId &triangleId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleLinkList_.size()))
+         || (triangleId >= triangleLinks_.size()))
         return -1;
 #endif
-      return triangleLinkList_[triangleId].size();
+      return triangleLinks_[triangleId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       TTK_TRIANGULATION_INTERNAL(getTriangleLinks)() override {
-      return &triangleLinkList_;
+      return expand(triangleLinks_, triangleLinkList_);
     }
 
     inline int TTK_TRIANGULATION_INTERNAL(getTriangleStar)(
@@ -355,13 +356,13 @@ namespace ttk {
       SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleStarList_.size()))
+         || (triangleId >= triangleStars_.size()))
         return -1;
       if((localStarId < 0)
-         || (localStarId >= (SimplexId)triangleStarList_[triangleId].size()))
+         || (localStarId >= triangleStars_[triangleId].size()))
         return -2;
 #endif
-      starId = triangleStarList_[triangleId][localStarId];
+      starId = triangleStars_[triangleId][localStarId];
       return 0;
     }
 
@@ -369,28 +370,28 @@ namespace ttk {
       const SimplexId &triangleId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleStarList_.size()))
+         || (triangleId >= triangleStars_.size()))
         return -1;
 #endif
-      return triangleStarList_[triangleId].size();
+      return triangleStars_[triangleId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       TTK_TRIANGULATION_INTERNAL(getTriangleStars)() override {
-      return &triangleStarList_;
+      return expand(triangleStars_, triangleStarList_);
     }
 
     inline int getTriangleVertexInternal(const SimplexId &triangleId,
                                          const int &localVertexId,
                                          SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((triangleId < 0) || (triangleId >= (SimplexId)triangleList_.size()))
+      if((triangleId < 0) || (triangleId >= triangles_.size()))
         return -1;
       if((localVertexId < 0)
-         || (localVertexId >= (SimplexId)triangleList_[triangleId].size()))
+         || (localVertexId >= triangles_[triangleId].size()))
         return -2;
 #endif
-      vertexId = triangleList_[triangleId][localVertexId];
+      vertexId = triangles_[triangleId][localVertexId];
       return 0;
     }
 
@@ -398,13 +399,13 @@ namespace ttk {
                                      const int &localEdgeId,
                                      SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexEdgeList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexEdges_.size()))
         return -1;
       if((localEdgeId < 0)
-         || (localEdgeId >= (SimplexId)vertexEdgeList_[vertexId].size()))
+         || (localEdgeId >= vertexEdges_[vertexId].size()))
         return -2;
 #endif
-      edgeId = vertexEdgeList_[vertexId][localEdgeId];
+      edgeId = vertexEdges_[vertexId][localEdgeId];
       return 0;
     }
 
@@ -412,15 +413,15 @@ namespace ttk {
       getVertexEdgeNumberInternal(const SimplexId &vertexId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexEdgeList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexEdges_.size()))
         return -1;
 #endif
-      return vertexEdgeList_[vertexId].size();
+      return vertexEdges_[vertexId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getVertexEdgesInternal() override {
-      return &vertexEdgeList_;
+      return expand(vertexEdges_, vertexEdgeList_);
     }
 
     inline int TTK_TRIANGULATION_INTERNAL(getVertexLink)(
@@ -428,13 +429,13 @@ namespace ttk {
       const int &localLinkId,
       SimplexId &linkId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexLinkList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexLinks_.size()))
         return -1;
       if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)vertexLinkList_[vertexId].size()))
+         || (localLinkId >= vertexLinks_[vertexId].size()))
         return -2;
 #endif
-      linkId = vertexLinkList_[vertexId][localLinkId];
+      linkId = vertexLinks_[vertexId][localLinkId];
 
       return 0;
     }
@@ -442,15 +443,15 @@ namespace ttk {
     inline SimplexId TTK_TRIANGULATION_INTERNAL(getVertexLinkNumber)(
       const SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexLinkList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexLinks_.size()))
         return -1;
 #endif
-      return vertexLinkList_[vertexId].size();
+      return vertexLinks_[vertexId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       TTK_TRIANGULATION_INTERNAL(getVertexLinks)() override {
-      return &vertexLinkList_;
+      return expand(vertexLinks_, vertexLinkList_);
     }
 
     inline int TTK_TRIANGULATION_INTERNAL(getVertexNeighbor)(
@@ -458,14 +459,14 @@ namespace ttk {
       const int &localNeighborId,
       SimplexId &neighborId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexNeighborList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexNeighbors_.size()))
         return -1;
       if((localNeighborId < 0)
          || (localNeighborId
-             >= (SimplexId)vertexNeighborList_[vertexId].size()))
+             >= vertexNeighbors_[vertexId].size()))
         return -2;
 #endif
-      neighborId = vertexNeighborList_[vertexId][localNeighborId];
+      neighborId = vertexNeighbors_[vertexId][localNeighborId];
       return 0;
     }
 
@@ -475,12 +476,12 @@ namespace ttk {
       if((vertexId < 0) || (vertexId >= vertexNumber_))
         return -1;
 #endif
-      return vertexNeighborList_[vertexId].size();
+      return vertexNeighbors_[vertexId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       TTK_TRIANGULATION_INTERNAL(getVertexNeighbors)() override {
-      return &vertexNeighborList_;
+      return expand(vertexNeighbors_, vertexNeighborList_);
     }
 
     inline int TTK_TRIANGULATION_INTERNAL(getVertexPoint)(
@@ -508,28 +509,28 @@ namespace ttk {
       const int &localStarId,
       SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexStarList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexStars_.size()))
         return -1;
       if((localStarId < 0)
-         || (localStarId >= (SimplexId)vertexStarList_[vertexId].size()))
+         || (localStarId >= vertexStars_[vertexId].size()))
         return -2;
 #endif
-      starId = vertexStarList_[vertexId][localStarId];
+      starId = vertexStars_[vertexId][localStarId];
       return 0;
     }
 
     inline SimplexId TTK_TRIANGULATION_INTERNAL(getVertexStarNumber)(
       const SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexStarList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexStars_.size()))
         return -1;
 #endif
-      return vertexStarList_[vertexId].size();
+      return vertexStars_[vertexId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       TTK_TRIANGULATION_INTERNAL(getVertexStars)() override {
-      return &vertexStarList_;
+      return expand(vertexStars_, vertexStarList_);
     }
 
     inline int getVertexTriangleInternal(const SimplexId &vertexId,
@@ -537,14 +538,14 @@ namespace ttk {
                                          SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexTriangleList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexTriangles_.size()))
         return -1;
       if((localTriangleId < 0)
          || (localTriangleId
-             >= (SimplexId)vertexTriangleList_[vertexId].size()))
+             >= vertexTriangles_[vertexId].size()))
         return -2;
 #endif
-      triangleId = vertexTriangleList_[vertexId][localTriangleId];
+      triangleId = vertexTriangles_[vertexId][localTriangleId];
       return 0;
     }
 
@@ -552,16 +553,16 @@ namespace ttk {
       const SimplexId &vertexId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexTriangleList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexTriangles_.size()))
         return -1;
 #endif
-      return vertexTriangleList_[vertexId].size();
+      return vertexTriangles_[vertexId].size();
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getVertexTrianglesInternal() override {
 
-      return &vertexTriangleList_;
+      return expand(vertexTriangles_, vertexTriangleList_);
     }
 
     inline bool TTK_TRIANGULATION_INTERNAL(isEdgeOnBoundary)(
@@ -608,8 +609,8 @@ namespace ttk {
 
       if(getDimensionality() == 2) {
         preconditionEdgeStarsInternal();
-        for(SimplexId i = 0; i < (SimplexId)edgeStarList_.size(); i++) {
-          if(edgeStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < edgeStars_.size(); i++) {
+          if(edgeStars_[i].size() == 1) {
             boundaryEdges_[i] = true;
           }
         }
@@ -617,10 +618,10 @@ namespace ttk {
         preconditionTriangleStarsInternal();
         preconditionTriangleEdgesInternal();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < triangleStars_.size(); i++) {
+          if(triangleStars_[i].size() == 1) {
             for(int j = 0; j < 3; j++) {
-              boundaryEdges_[triangleEdgeList_[i][j]] = true;
+              boundaryEdges_[triangleEdges_[i][j]] = true;
             }
           }
         }
@@ -639,18 +640,18 @@ namespace ttk {
         return 0;
 
       if((!boundaryTriangles_.empty())
-         && (boundaryTriangles_.size() == triangleList_.size())) {
+         && ((SimplexId)boundaryTriangles_.size() == triangles_.size())) {
         return 0;
       }
 
       preconditionTrianglesInternal();
-      boundaryTriangles_.resize(triangleList_.size(), false);
+      boundaryTriangles_.resize(triangles_.size(), false);
 
       if(getDimensionality() == 3) {
         preconditionTriangleStarsInternal();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < triangleStars_.size(); i++) {
+          if(triangleStars_[i].size() == 1) {
             boundaryTriangles_[i] = true;
           }
         }
@@ -676,8 +677,8 @@ namespace ttk {
       // look for singletons
       if(getDimensionality() == 1) {
         preconditionVertexStarsInternal();
-        for(SimplexId i = 0; i < (SimplexId)vertexStarList_.size(); i++) {
-          if(vertexStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < vertexStars_.size(); i++) {
+          if(vertexStars_[i].size() == 1) {
             boundaryVertices_[i] = true;
           }
         }
@@ -685,8 +686,8 @@ namespace ttk {
         preconditionEdgesInternal();
         preconditionEdgeStarsInternal();
 
-        for(SimplexId i = 0; i < (SimplexId)edgeStarList_.size(); i++) {
-          if(edgeStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < edgeStars_.size(); i++) {
+          if(edgeStars_[i].size() == 1) {
             boundaryVertices_[edgeList_[i].first] = true;
             boundaryVertices_[edgeList_[i].second] = true;
           }
@@ -695,11 +696,11 @@ namespace ttk {
         preconditionTrianglesInternal();
         preconditionTriangleStarsInternal();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
-            boundaryVertices_[triangleList_[i][0]] = true;
-            boundaryVertices_[triangleList_[i][1]] = true;
-            boundaryVertices_[triangleList_[i][2]] = true;
+        for(SimplexId i = 0; i < triangleStars_.size(); i++) {
+          if(triangleStars_[i].size() == 1) {
+            boundaryVertices_[triangles_[i][0]] = true;
+            boundaryVertices_[triangles_[i][1]] = true;
+            boundaryVertices_[triangles_[i][2]] = true;
           }
         }
       } else {
@@ -713,13 +714,15 @@ namespace ttk {
 
     inline int preconditionCellEdgesInternal() override {
 
-      if(!cellEdgeList_.size()) {
+      if(cellEdges_.empty()) {
 
         ThreeSkeleton threeSkeleton;
         threeSkeleton.setWrapper(this);
 
         threeSkeleton.buildCellEdges(vertexNumber_, *cellArray_, cellEdgeList_,
-                                     &edgeList_, &vertexEdgeList_);
+                                     &edgeList_,
+                                     stage(vertexEdges_, vertexEdgeList_));
+        compactRelations();
       }
 
       return 0;
@@ -727,13 +730,15 @@ namespace ttk {
 
     inline int preconditionCellNeighborsInternal() override {
 
-      if(!cellNeighborList_.size()) {
+      if(cellNeighbors_.empty()) {
         ThreeSkeleton threeSkeleton;
         threeSkeleton.setWrapper(this);
 
         // choice here (for the more likely)
         threeSkeleton.buildCellNeighborsFromVertices(
-          vertexNumber_, *cellArray_, cellNeighborList_, &vertexStarList_);
+          vertexNumber_, *cellArray_, cellNeighborList_,
+          stage(vertexStars_, vertexStarList_));
+        compactRelations();
       }
 
       return 0;
@@ -741,37 +746,40 @@ namespace ttk {
 
     inline int preconditionCellTrianglesInternal() override {
 
-      if(!cellTriangleList_.size()) {
+      if(cellTriangles_.empty()) {
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
 
-        if(triangleList_.size()) {
+        int ret = 0;
+        if(!triangles_.empty()) {
           // we already computed this guy, let's just get the cell triangles
-          if(triangleStarList_.size()) {
-            return twoSkeleton.buildTriangleList(
+          if(!triangleStars_.empty()) {
+            ret = twoSkeleton.buildTriangleList(
               vertexNumber_, *cellArray_, nullptr, nullptr, &cellTriangleList_);
           } else {
             // let's compute the triangle star while we're at it...
             // it's just a tiny overhead.
-            return twoSkeleton.buildTriangleList(vertexNumber_, *cellArray_,
-                                                 nullptr, &triangleStarList_,
-                                                 &cellTriangleList_);
+            ret = twoSkeleton.buildTriangleList(vertexNumber_, *cellArray_,
+                                                nullptr, &triangleStarList_,
+                                                &cellTriangleList_);
           }
         } else {
           // we have not computed this guy, let's do it while we're at it
-          if(triangleStarList_.size()) {
-            return twoSkeleton.buildTriangleList(vertexNumber_, *cellArray_,
-                                                 &triangleList_, nullptr,
-                                                 &cellTriangleList_);
+          if(!triangleStars_.empty()) {
+            ret = twoSkeleton.buildTriangleList(vertexNumber_, *cellArray_,
+                                                &triangleList_, nullptr,
+                                                &cellTriangleList_);
           } else {
             // let's compute the triangle star while we're at it...
             // it's just a tiny overhead.
-            return twoSkeleton.buildTriangleList(
+            ret = twoSkeleton.buildTriangleList(
               vertexNumber_, *cellArray_, &triangleList_, &triangleStarList_,
               &cellTriangleList_);
           }
         }
+        compactRelations();
+        return ret;
       }
 
       return 0;
@@ -790,16 +798,18 @@ namespace ttk {
 
     inline int preconditionEdgeLinksInternal() override {
 
-      if(!edgeLinkList_.size()) {
+      if(edgeLinks_.empty()) {
 
+        int ret = 0;
         if(getDimensionality() == 2) {
           preconditionEdgesInternal();
           preconditionEdgeStarsInternal();
 
           OneSkeleton oneSkeleton;
           oneSkeleton.setWrapper(this);
-          return oneSkeleton.buildEdgeLinks(
-            edgeList_, edgeStarList_, *cellArray_, edgeLinkList_);
+          ret = oneSkeleton.buildEdgeLinks(edgeList_,
+                                           *stage(edgeStars_, edgeStarList_),
+                                           *cellArray_, edgeLinkList_);
         } else if(getDimensionality() == 3) {
           preconditionEdgesInternal();
           preconditionEdgeStarsInternal();
@@ -807,13 +817,16 @@ namespace ttk {
 
           OneSkeleton oneSkeleton;
           oneSkeleton.setWrapper(this);
-          return oneSkeleton.buildEdgeLinks(
-            edgeList_, edgeStarList_, cellEdgeList_, edgeLinkList_);
+          ret = oneSkeleton.buildEdgeLinks(
+            edgeList_, *stage(edgeStars_, edgeStarList_),
+            *stage(cellEdges_, cellEdgeList_), edgeLinkList_);
         } else {
           // unsupported dimension
           printErr("Unsupported dimension for edge link precondition");
           return -1;
         }
+        compactRelations();
+        return ret;
       }
 
       return 0;
@@ -821,19 +834,21 @@ namespace ttk {
 
     inline int preconditionEdgeStarsInternal() override {
 
-      if(!edgeStarList_.size()) {
+      if(edgeStars_.empty()) {
         OneSkeleton oneSkeleton;
         oneSkeleton.setWrapper(this);
-        return oneSkeleton.buildEdgeStars(vertexNumber_, *cellArray_,
-                                          edgeStarList_, &edgeList_,
-                                          &vertexStarList_);
+        const int ret = oneSkeleton.buildEdgeStars(
+          vertexNumber_, *cellArray_, edgeStarList_, &edgeList_,
+          stage(vertexStars_, vertexStarList_));
+        compactRelations();
+        return ret;
       }
       return 0;
     }
 
     inline int preconditionEdgeTrianglesInternal() override {
 
-      if(!edgeTriangleList_.size()) {
+      if(edgeTriangles_.empty()) {
 
         // WARNING
         // here vertexStarList and triangleStarList will be computed (for
@@ -842,10 +857,14 @@ namespace ttk {
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
-        return twoSkeleton.buildEdgeTriangles(
-          vertexNumber_, *cellArray_, edgeTriangleList_, &vertexStarList_,
-          &edgeList_, &edgeStarList_, &triangleList_, &triangleStarList_,
-          &cellTriangleList_);
+        const int ret = twoSkeleton.buildEdgeTriangles(
+          vertexNumber_, *cellArray_, edgeTriangleList_,
+          stage(vertexStars_, vertexStarList_), &edgeList_,
+          stage(edgeStars_, edgeStarList_), stage(triangles_, triangleList_),
+          stage(triangleStars_, triangleStarList_),
+          stage(cellTriangles_, cellTriangleList_));
+        compactRelations();
+        return ret;
       }
 
       return 0;
@@ -853,14 +872,16 @@ namespace ttk {
 
     inline int preconditionTrianglesInternal() override {
 
-      if(!triangleList_.size()) {
+      if(triangles_.empty()) {
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
 
-        twoSkeleton.buildTriangleList(vertexNumber_, *cellArray_,
-                                      &triangleList_, &triangleStarList_,
-                                      &cellTriangleList_);
+        twoSkeleton.buildTriangleList(
+          vertexNumber_, *cellArray_, &triangleList_,
+          sideOutput(triangleStars_, triangleStarList_),
+          sideOutput(cellTriangles_, cellTriangleList_));
+        compactRelations();
       }
 
       return 0;
@@ -868,7 +889,7 @@ namespace ttk {
 
     inline int preconditionTriangleEdgesInternal() override {
 
-      if(!triangleEdgeList_.size()) {
+      if(triangleEdges_.empty()) {
 
         // WARNING
         // here triangleStarList and cellTriangleList will be computed (for
@@ -878,9 +899,14 @@ namespace ttk {
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
 
-        return twoSkeleton.buildTriangleEdgeList(
-          vertexNumber_, *cellArray_, triangleEdgeList_, &vertexEdgeList_,
-          &edgeList_, &triangleList_, &triangleStarList_, &cellTriangleList_);
+        const int ret = twoSkeleton.buildTriangleEdgeList(
+          vertexNumber_, *cellArray_, triangleEdgeList_,
+          stage(vertexEdges_, vertexEdgeList_), &edgeList_,
+          stage(triangles_, triangleList_),
+          stage(triangleStars_, triangleStarList_),
+          stage(cellTriangles_, cellTriangleList_));
+        compactRelations();
+        return ret;
       }
 
       return 0;
@@ -888,14 +914,18 @@ namespace ttk {
 
     inline int preconditionTriangleLinksInternal() override {
 
-      if(!triangleLinkList_.size()) {
+      if(triangleLinks_.empty()) {
 
         preconditionTriangleStarsInternal();
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
-        return twoSkeleton.buildTriangleLinks(
-          triangleList_, triangleStarList_, *cellArray_, triangleLinkList_);
+        const int ret = twoSkeleton.buildTriangleLinks(
+          *stage(triangles_, triangleList_),
+          *stage(triangleStars_, triangleStarList_), *cellArray_,
+          triangleLinkList_);
+        compactRelations();
+        return ret;
       }
 
       return 0;
@@ -903,12 +933,15 @@ namespace ttk {
 
     inline int preconditionTriangleStarsInternal() override {
 
-      if(!triangleStarList_.size()) {
+      if(triangleStars_.empty()) {
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
-        return twoSkeleton.buildTriangleList(
-          vertexNumber_, *cellArray_, &triangleList_, &triangleStarList_);
+        const int ret = twoSkeleton.buildTriangleList(
+          vertexNumber_, *cellArray_, sideOutput(triangles_, triangleList_),
+          &triangleStarList_);
+        compactRelations();
+        return ret;
       }
 
       return 0;
@@ -916,7 +949,7 @@ namespace ttk {
 
     inline int preconditionVertexEdgesInternal() override {
 
-      if((SimplexId)vertexEdgeList_.size() != vertexNumber_) {
+      if(vertexEdges_.size() != vertexNumber_) {
         ZeroSkeleton zeroSkeleton;
 
         if(!edgeList_.size()) {
@@ -926,67 +959,79 @@ namespace ttk {
         }
 
         zeroSkeleton.setWrapper(this);
-        return zeroSkeleton.buildVertexEdges(
+        const int ret = zeroSkeleton.buildVertexEdges(
           vertexNumber_, edgeList_, vertexEdgeList_);
+        compactRelations();
+        return ret;
       }
       return 0;
     }
 
     inline int preconditionVertexLinksInternal() override {
 
-      if((SimplexId)vertexLinkList_.size() != vertexNumber_) {
+      if(vertexLinks_.size() != vertexNumber_) {
 
+        int ret = 0;
         if(getDimensionality() == 2) {
           preconditionVertexStarsInternal();
           preconditionCellEdgesInternal();
 
           ZeroSkeleton zeroSkeleton;
           zeroSkeleton.setWrapper(this);
-          return zeroSkeleton.buildVertexLinks(
-            vertexStarList_, cellEdgeList_, edgeList_, vertexLinkList_);
+          ret = zeroSkeleton.buildVertexLinks(
+            *stage(vertexStars_, vertexStarList_),
+            *stage(cellEdges_, cellEdgeList_), edgeList_, vertexLinkList_);
         } else if(getDimensionality() == 3) {
           preconditionVertexStarsInternal();
           preconditionCellTrianglesInternal();
 
           ZeroSkeleton zeroSkeleton;
           zeroSkeleton.setWrapper(this);
-          return zeroSkeleton.buildVertexLinks(
-            vertexStarList_, cellTriangleList_, triangleList_, vertexLinkList_);
+          ret = zeroSkeleton.buildVertexLinks(
+            *stage(vertexStars_, vertexStarList_),
+            *stage(cellTriangles_, cellTriangleList_),
+            *stage(triangles_, triangleList_), vertexLinkList_);
         } else {
           // unsupported dimension
           printErr("Unsupported dimension for vertex link precondition");
           return -1;
         }
+        compactRelations();
+        return ret;
       }
       return 0;
     }
 
     inline int preconditionVertexNeighborsInternal() override {
 
-      if((SimplexId)vertexNeighborList_.size() != vertexNumber_) {
+      if(vertexNeighbors_.size() != vertexNumber_) {
         ZeroSkeleton zeroSkeleton;
         zeroSkeleton.setWrapper(this);
-        return zeroSkeleton.buildVertexNeighbors(
+        const int ret = zeroSkeleton.buildVertexNeighbors(
           vertexNumber_, *cellArray_, vertexNeighborList_, &edgeList_);
+        compactRelations();
+        return ret;
       }
       return 0;
     }
 
     inline int preconditionVertexStarsInternal() override {
 
-      if((SimplexId)vertexStarList_.size() != vertexNumber_) {
+      if(vertexStars_.size() != vertexNumber_) {
         ZeroSkeleton zeroSkeleton;
         zeroSkeleton.setWrapper(this);
 
-        return zeroSkeleton.buildVertexStars(
+        const int ret = zeroSkeleton.buildVertexStars(
           vertexNumber_, *cellArray_, vertexStarList_);
+        compactRelations();
+        return ret;
       }
       return 0;
     }
 
     inline int preconditionVertexTrianglesInternal() override {
 
-      if((SimplexId)vertexTriangleList_.size() != vertexNumber_) {
+      if(vertexTriangles_.size() != vertexNumber_) {
 
         preconditionTrianglesInternal();
 
@@ -994,7 +1039,9 @@ namespace ttk {
         twoSkeleton.setWrapper(this);
 
         twoSkeleton.buildVertexTriangles(
-          vertexNumber_, triangleList_, vertexTriangleList_);
+          vertexNumber_, *stage(triangles_, triangleList_),
+          vertexTriangleList_);
+        compactRelations();
       }
 
       return 0;
@@ -1055,12 +1102,55 @@ namespace ttk {
       return 0;
     }
 
+    size_t footprint() const override;
+
+  protected:
+    /// Expand a compact relation into its jagged std::vector counterpart,
+    /// for the (rare) callers of the global list getters. The copy is kept
+    /// until clear() and is safe to request from concurrent threads.
+    const std::vector<std::vector<SimplexId>> *
+      expand(const FlatJaggedArray &compact,
+             std::vector<std::vector<SimplexId>> &list) const;
+
+    /// Jagged copy of an already compact relation, to be used as an input by
+    /// the skeleton procedures. Released by the next compactRelations()
+    /// unless the list was already expanded by a global list getter.
+    inline std::vector<std::vector<SimplexId>> *
+      stage(const FlatJaggedArray &compact,
+            std::vector<std::vector<SimplexId>> &list) {
+      if(list.empty() && !compact.empty()) {
+        compact.copyTo(list);
+        stagedLists_.emplace_back(&list);
+      }
+      return &list;
+    }
+
+    /// Output pointer for a relation the skeleton procedures can compute on
+    /// the side, nullptr if this relation is already compact.
+    inline std::vector<std::vector<SimplexId>> *
+      sideOutput(const FlatJaggedArray &compact,
+                 std::vector<std::vector<SimplexId>> &list) const {
+      return compact.empty() ? &list : nullptr;
+    }
+
+    /// Move the freshly built jagged relations into their compact storage
+    /// and release the staged jagged copies.
+    int compactRelations();
+
   private:
     bool doublePrecision_;
     SimplexId cellNumber_, vertexNumber_;
     const void *pointSet_;
     int maxCellDim_;
     std::shared_ptr<CellArray> cellArray_;
+
+    // compact (offsets + data) storage of the preconditioned relations
+    FlatJaggedArray cellEdges_, cellNeighbors_, cellTriangles_, edgeLinks_,
+      edgeStars_, edgeTriangles_, triangles_, triangleEdges_, triangleLinks_,
+      triangleStars_, vertexEdges_, vertexLinks_, vertexNeighbors_,
+      vertexStars_, vertexTriangles_;
+    // jagged copies of compact relations staged as skeleton inputs
+    std::vector<std::vector<std::vector<SimplexId>> *> stagedLists_;
   };
 } // namespace ttk
 
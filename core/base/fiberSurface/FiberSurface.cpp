@@ -1,5 +1,8 @@
 #include <FiberSurface.h>
 
+#include <cstring>
+#include <numeric>
+
 using namespace std;
 using namespace ttk;
 
@@ -8,75 +11,6 @@ static const float PREC_FLT_2{powf(10.F, -FLT_DIG + 2)};
 static const double PREC_DBL{Geometry::pow(10.0, -DBL_DIG)};
 static const double PREC_DBL_4{Geometry::pow(10.0, -DBL_DIG + 4)};
 
-struct _fiberSurfaceVertexCmpX {
-
-  bool operator()(const FiberSurface::Vertex &v0,
-                  const FiberSurface::Vertex &v1) {
-
-    if(fabs(v0.p_[0] - v1.p_[0]) < PREC_DBL) {
-      // let's consider x coordinates are equal
-      if(fabs(v0.p_[1] - v1.p_[1]) < PREC_DBL) {
-        // let's consider y coordinates are equal
-        if(fabs(v0.p_[2] - v1.p_[2]) < PREC_DBL) {
-          // let's consider z coordinates are equal
-          // NOTE: the local Id should be sufficient
-          return v0.globalId_ < v1.globalId_;
-        } else
-          return v0.p_[2] < v1.p_[2];
-      } else
-        return v0.p_[1] < v1.p_[1];
-    } else {
-      return v0.p_[0] < v1.p_[0];
-    }
-  }
-} FiberSurfaceVertexComparisonX;
-
-struct _fiberSurfaceVertexCmpY {
-
-  bool operator()(const FiberSurface::Vertex &v0,
-                  const FiberSurface::Vertex &v1) {
-
-    if(fabs(v0.p_[1] - v1.p_[1]) < PREC_DBL) {
-      // let's consider y coordinates are equal
-      if(fabs(v0.p_[2] - v1.p_[2]) < PREC_DBL) {
-        // let's consider z coordinates are equal
-        if(fabs(v0.p_[0] - v1.p_[0]) < PREC_DBL) {
-          // let's consider x coordinates are equal
-          // NOTE: the local Id should be sufficient
-          return v0.globalId_ < v1.globalId_;
-        } else
-          return v0.p_[0] < v1.p_[0];
-      } else
-        return v0.p_[2] < v1.p_[2];
-    } else {
-      return v0.p_[1] < v1.p_[1];
-    }
-  }
-} FiberSurfaceVertexComparisonY;
-
-struct _fiberSurfaceVertexCmpZ {
-
-  bool operator()(const FiberSurface::Vertex &v0,
-                  const FiberSurface::Vertex &v1) {
-
-    if(fabs(v0.p_[2] - v1.p_[2]) < PREC_DBL) {
-      // let's consider z coordinates are equal
-      if(fabs(v0.p_[0] - v1.p_[0]) < PREC_DBL) {
-        // let's consider x coordinates are equal
-        if(fabs(v0.p_[1] - v1.p_[1]) < PREC_DBL) {
-          // let's consider y coordinates are equal
-          // NOTE: the local Id should be sufficient
-          return v0.globalId_ < v1.globalId_;
-        } else
-          return v0.p_[1] < v1.p_[1];
-      } else
-        return v0.p_[0] < v1.p_[0];
-    } else {
-      return v0.p_[2] < v1.p_[2];
-    }
-  }
-} FiberSurfaceVertexComparisonZ;
-
 struct _fiberSurfaceTriangleCmp {
 
   bool operator()(const pair<double, pair<SimplexId, SimplexId>> &t0,
@@ -1390,210 +1324,210 @@ int FiberSurface::mergeVertices(const double &distanceThreshold) const {
 
   Timer t;
 
-  vector<Vertex> tmpList = (*globalVertexList_);
-
-  for(SimplexId i = 0; i < (SimplexId)tmpList.size(); i++) {
-    tmpList[i].localId_ = i;
+  // Vertices are welded if they have been computed on the same edge of the
+  // input mesh (or are both interior to tetrahedra) and are closer than
+  // distanceThreshold (transitively). Candidates are found with a spatial
+  // hash: the space is cut in cells of 8 times the threshold size, so that
+  // a vertex only needs to be compared to the vertices of its own cell and
+  // of the (at most 7) neighbor cells within the threshold distance.
+  // With a zero threshold, only identical vertices are welded: the exact
+  // coordinates are hashed instead.
+  const SimplexId vertexNumber = globalVertexList_->size();
+  const bool exact = distanceThreshold <= 0;
+  double maxCoordinate = 0;
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    for(int j = 0; j < 3; j++)
+      maxCoordinate = max(maxCoordinate, fabs((*globalVertexList_)[i].p_[j]));
   }
-
-  // now do a parallel sort
-  SimplexId uniqueVertexNumber = 0;
-  for(int k = 0; k < 3; k++) {
-
-    switch(k) {
-      case 0:
-        sort(tmpList.begin(), tmpList.end(), FiberSurfaceVertexComparisonX);
-        break;
-
-      case 1:
-        sort(tmpList.begin(), tmpList.end(), FiberSurfaceVertexComparisonY);
-        break;
-
-      case 2:
-        sort(tmpList.begin(), tmpList.end(), FiberSurfaceVertexComparisonZ);
-        break;
+  // larger cells if needed, so that the cell coordinates fit in integers
+  const double cellSize
+    = max(8 * distanceThreshold, maxCoordinate / (double)(1LL << 40));
+  const double margin = exact ? 0 : distanceThreshold / cellSize;
+  // cell coordinates, shifted by half a cell: the vertices computed on the
+  // (often axis-aligned) edges of the input mesh have round coordinates,
+  // which are then far from the cell boundaries
+  const auto getCellCoordinate
+    = [cellSize](const double &x) { return x / cellSize + 0.5; };
+  const auto getCell = [exact, &getCellCoordinate](const double *p,
+                                                   long long int *cell) {
+    for(int j = 0; j < 3; j++) {
+      if(exact) {
+        // bit pattern of the coordinate (-0 and 0 are identical)
+        const double x = p[j] + 0.0;
+        memcpy(&cell[j], &x, sizeof(x));
+      } else {
+        cell[j] = (long long int)floor(getCellCoordinate(p[j]));
+      }
     }
+  };
+
+  const auto getEdge = [](const Vertex &v) {
+    return make_pair(min(v.meshEdge_.first, v.meshEdge_.second),
+                     max(v.meshEdge_.first, v.meshEdge_.second));
+  };
+  const auto hashCell = [](const pair<SimplexId, SimplexId> &edge,
+                           const long long int *cell) {
+    // splitmix64 mixing of the edge and cell coordinates
+    unsigned long long int h = 0;
+    const long long int keys[5]
+      = {edge.first, edge.second, cell[0], cell[1], cell[2]};
+    for(int j = 0; j < 5; j++) {
+      h ^= (unsigned long long int)keys[j] + 0x9e3779b97f4a7c15ULL + (h << 6)
+           + (h >> 2);
+      h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+      h ^= h >> 31;
+    }
+    return h;
+  };
+
+  // 1. hash the vertices by edge and cell, in buckets (counting sort)
+  int bucketBits = 1;
+  while((1LL << bucketBits) < 2 * (long long int)vertexNumber)
+    bucketBits++;
+  const unsigned long long int bucketMask = (1ULL << bucketBits) - 1;
+  vector<unsigned long long int> hashes(vertexNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    const Vertex &v = (*globalVertexList_)[i];
+    long long int cell[3];
+    getCell(v.p_, cell);
+    hashes[i] = hashCell(getEdge(v), cell);
+  }
+  vector<SimplexId> bucketOffsets((1ULL << bucketBits) + 1, 0);
+  for(SimplexId i = 0; i < vertexNumber; i++)
+    bucketOffsets[(hashes[i] & bucketMask) + 1]++;
+  for(size_t b = 1; b < bucketOffsets.size(); b++)
+    bucketOffsets[b] += bucketOffsets[b - 1];
+  // the entries of a bucket are self-contained (contiguous memory accesses)
+  struct BucketEntry {
+    unsigned long long int hash;
+    SimplexId id;
+    pair<SimplexId, SimplexId> edge;
+    double p[3];
+  };
+  vector<BucketEntry> buckets(vertexNumber);
+  {
+    vector<SimplexId> cursors(bucketOffsets.begin(), bucketOffsets.end() - 1);
+    for(SimplexId i = 0; i < vertexNumber; i++) {
+      const Vertex &v = (*globalVertexList_)[i];
+      BucketEntry &entry = buckets[cursors[hashes[i] & bucketMask]++];
+      entry.hash = hashes[i];
+      entry.id = i;
+      entry.edge = getEdge(v);
+      for(int j = 0; j < 3; j++)
+        entry.p[j] = v.p_[j];
+    }
+  }
 
-    // NOTE:
-    // ethaneDiol dataset
-    // 0.019224 in parallel (2 cores HT)
-    // 0.041353 in sequential (speedup: x2.15, perfect (HT))
-
-    // now merge the thing
-    // 1. Identity duplicates
-    // NOTE: order is important, so no parallelism
-    // NOTE: points are represented with single precision (floats) so use that
-    // as a limit for distances
-    uniqueVertexNumber = 0;
-    double distance = 0;
-    for(SimplexId i = 0; i < (SimplexId)tmpList.size(); i++) {
-
-      bool canMerge = false;
-
-      if(i) {
-        distance = Geometry::distance(tmpList[i].p_, tmpList[i - 1].p_);
-
-        if(distance <= distanceThreshold) {
-
-          // one of the two is -1 (interior vertex)
-          //           if((tmpList[i - 1].meshEdge_.first == -1)
-          //             ||(tmpList[i].meshEdge_.first == -1)){
-          //             canMerge = true;
-          //           }
-          //
-          //           // one vertex in common
-          //           if((tmpList[i].meshEdge_.first ==
-          //             tmpList[i - 1].meshEdge_.first)
-          //             ||
-          //             (tmpList[i].meshEdge_.first ==
-          //             tmpList[i - 1].meshEdge_.second)){
-          //             canMerge = true;
-          //           }
-          //
-          //           // one vertex in common
-          //           if((tmpList[i].meshEdge_.second ==
-          //             tmpList[i - 1].meshEdge_.first)
-          //             ||
-          //             (tmpList[i].meshEdge_.second ==
-          //             tmpList[i - 1].meshEdge_.second)){
-          //             canMerge = true;
-          //           }
-
-          // NOTE: still some bugs here in terms of manifoldness.
-
-          if((tmpList[i].meshEdge_.first == tmpList[i - 1].meshEdge_.first)
-             && (tmpList[i].meshEdge_.second
-                 == tmpList[i - 1].meshEdge_.second)) {
-            canMerge = true;
-          }
-          if((tmpList[i].meshEdge_.first == tmpList[i - 1].meshEdge_.second)
-             && (tmpList[i].meshEdge_.second
-                 == tmpList[i - 1].meshEdge_.first)) {
-            canMerge = true;
-          }
-
-          //           canMerge = true;
+  // 2. pairs of vertices to weld (j < i), looked up in the neighbor cells
+  vector<vector<pair<SimplexId, SimplexId>>> threadPairs(threadNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+#ifdef TTK_ENABLE_OPENMP
+    auto &pairs = threadPairs[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 1024)
+#else
+    auto &pairs = threadPairs[0];
+#endif
+    // bucket order: the vertices of a cell are processed consecutively
+    for(SimplexId k = 0; k < vertexNumber; k++) {
+      const BucketEntry &v = buckets[k];
+      long long int cell[3], side[3] = {0, 0, 0}, neighbor[3];
+      getCell(v.p, cell);
+      for(int j = 0; !exact && j < 3; j++) {
+        // neighbor cell to visit along this axis (if any)
+        const double c = getCellCoordinate(v.p[j]) - cell[j];
+        side[j] = (c <= margin) ? -1 : (c >= 1 - margin) ? 1 : 0;
+      }
+      for(int c = 0; c < 8; c++) {
+        bool skip = false;
+        for(int j = 0; j < 3; j++) {
+          if(((c >> j) & 1) && !side[j])
+            skip = true;
+          neighbor[j] = cell[j] + (((c >> j) & 1) ? side[j] : 0);
         }
-
-        if(canMerge) {
-          tmpList[i].globalId_ = tmpList[i - 1].globalId_;
-          if((tmpList[i].isBasePoint_) || (tmpList[i - 1].isBasePoint_)) {
-            tmpList[i].isBasePoint_ = true;
-            tmpList[i - 1].isBasePoint_ = true;
-          }
-          if((tmpList[i].isIntersectionPoint_)
-             || (tmpList[i - 1].isIntersectionPoint_)) {
-            tmpList[i].isIntersectionPoint_ = true;
-            tmpList[i - 1].isIntersectionPoint_ = true;
-          }
-          for(int j = 0; j < 3; j++) {
-            tmpList[i].p_[j] = tmpList[i - 1].p_[j];
-          }
-
-          // update meshEdge...
-          if((tmpList[i - 1].meshEdge_.first == -1)
-             && (tmpList[i].meshEdge_.first != -1)) {
-            tmpList[i - 1].meshEdge_ = tmpList[i].meshEdge_;
-          }
-          if((tmpList[i].meshEdge_.first == -1)
-             && (tmpList[i - 1].meshEdge_.first != -1)) {
-            tmpList[i].meshEdge_ = tmpList[i - 1].meshEdge_;
-          }
+        if(skip)
+          continue;
+        const unsigned long long int h
+          = c ? hashCell(v.edge, neighbor) : v.hash;
+        const unsigned long long int b = h & bucketMask;
+        for(SimplexId l = bucketOffsets[b]; l < bucketOffsets[b + 1]; l++) {
+          const BucketEntry &entry = buckets[l];
+          // hash collisions are filtered by the edge test
+          if(entry.id < v.id && entry.hash == h && entry.edge == v.edge
+             && Geometry::distance(v.p, entry.p) <= distanceThreshold)
+            pairs.emplace_back(entry.id, v.id);
         }
       }
-
-      if((!i) || (!canMerge)) {
-        tmpList[i].globalId_ = uniqueVertexNumber;
-        uniqueVertexNumber++;
-      }
-
-      (*globalVertexList_)[tmpList[i].localId_].globalId_
-        = tmpList[i].globalId_;
     }
   }
 
-  // update the triangles
-  for(SimplexId i = 0; i < (SimplexId)polygonEdgeTriangleLists_.size(); i++) {
-    for(SimplexId j = 0; j < (SimplexId)polygonEdgeTriangleLists_[i]->size();
-        j++) {
-      for(int k = 0; k < 3; k++) {
-        (*polygonEdgeTriangleLists_[i])[j].vertexIds_[k]
-          = (*globalVertexList_)[(*polygonEdgeTriangleLists_[i])[j]
-                                   .vertexIds_[k]]
-              .globalId_;
-      }
+  // 3. connected components (union-find, the representative of a component
+  // is its smallest vertex)
+  vector<SimplexId> parent(vertexNumber);
+  iota(parent.begin(), parent.end(), 0);
+  const auto find = [&parent](SimplexId i) {
+    while(parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
     }
-  }
-
-  // 2. create the actual global list
-  // NOTE: order is no longer important, we can do this in parallel.
-  (*globalVertexList_).resize(uniqueVertexNumber);
-
-  // duplicate vertices but only a subset have the right edge information
-  // (because they have actually been computed on the edge)
-  SimplexId lastId = -1;
-  for(SimplexId i = 0; i < (SimplexId)tmpList.size(); i++) {
-
-    if(lastId != -1) {
-      if((tmpList[lastId].globalId_ == tmpList[i].globalId_)
-         && (tmpList[i].meshEdge_.first != -1)) {
-
-        (*globalVertexList_)[tmpList[lastId].globalId_].meshEdge_
-          = tmpList[i].meshEdge_;
-        (*globalVertexList_)[tmpList[lastId].globalId_].isBasePoint_ = true;
-        lastId = -1;
-      }
+    return i;
+  };
+  for(const auto &pairs : threadPairs) {
+    for(const auto &p : pairs) {
+      const SimplexId r0 = find(p.first);
+      const SimplexId r1 = find(p.second);
+      if(r0 < r1)
+        parent[r1] = r0;
+      else if(r1 < r0)
+        parent[r0] = r1;
     }
+  }
 
-    if((!i) || (tmpList[i].globalId_ != tmpList[i - 1].globalId_)) {
-      (*globalVertexList_)[tmpList[i].globalId_] = tmpList[i];
-      if((*globalVertexList_)[tmpList[i].globalId_].meshEdge_.first == -1) {
-        lastId = i;
-      } else {
-        lastId = -1;
-      }
-    }
+  // new identifiers, in the order of the representatives
+  vector<SimplexId> newIds(vertexNumber);
+  SimplexId uniqueVertexNumber = 0;
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    parent[i] = find(i);
+    newIds[i] = (parent[i] == i) ? uniqueVertexNumber++ : newIds[parent[i]];
   }
 
-  // 3. update the 2-sheets, ignore zero-area triangles
-  // and free their vertex memory
-  // NOTE: order is no longer important, parallel
-  vector<vector<bool>> keepTriangle(polygonEdgeTriangleLists_.size());
-  vector<vector<FiberSurface::Triangle>> tmpTriangleLists(
-    polygonEdgeTriangleLists_.size());
-  for(SimplexId i = 0; i < (SimplexId)polygonEdgeTriangleLists_.size(); i++) {
-    tmpTriangleLists[i] = (*polygonEdgeTriangleLists_[i]);
-    keepTriangle[i].resize((*polygonEdgeTriangleLists_[i]).size(), true);
+  // 4. compact the global list (vertices move to lower indices only)
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    Vertex &v = (*globalVertexList_)[i];
+    if(parent[i] == i) {
+      v.globalId_ = newIds[i];
+      (*globalVertexList_)[newIds[i]] = v;
+    } else {
+      Vertex &r = (*globalVertexList_)[newIds[i]];
+      r.isBasePoint_ = r.isBasePoint_ || v.isBasePoint_;
+      r.isIntersectionPoint_ = r.isIntersectionPoint_ || v.isIntersectionPoint_;
+    }
   }
+  (*globalVertexList_).resize(uniqueVertexNumber);
 
+  // 5. remap the triangles in place and remove the zero-area ones
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
   for(SimplexId i = 0; i < (SimplexId)polygonEdgeTriangleLists_.size(); i++) {
-    for(SimplexId j = 0; j < (SimplexId)tmpTriangleLists[i].size(); j++) {
-      for(int k = 0; k < 3; k++) {
-        if((k)
-           && (tmpTriangleLists[i][j].vertexIds_[k]
-               == tmpTriangleLists[i][j].vertexIds_[(k - 1)])) {
-          keepTriangle[i][j] = false;
-        }
-      }
-      if(tmpTriangleLists[i][j].vertexIds_[0]
-         == tmpTriangleLists[i][j].vertexIds_[2]) {
-        keepTriangle[i][j] = false;
-      }
-    }
-
-    // now copy triangles over with non zero-area triangles
-    // NOTE: no need to re-allocate the memory, we know we are not going to use
-    // more.
-    (*polygonEdgeTriangleLists_[i]).resize(0);
-    for(SimplexId j = 0; j < (SimplexId)tmpTriangleLists[i].size(); j++) {
-
-      if(keepTriangle[i][j]) {
-        (*polygonEdgeTriangleLists_[i]).push_back(tmpTriangleLists[i][j]);
-      }
+    vector<Triangle> &triangles = *polygonEdgeTriangleLists_[i];
+    size_t kept = 0;
+    for(size_t j = 0; j < triangles.size(); j++) {
+      Triangle triangle = triangles[j];
+      for(int k = 0; k < 3; k++)
+        triangle.vertexIds_[k] = newIds[triangle.vertexIds_[k]];
+      if(triangle.vertexIds_[0] != triangle.vertexIds_[1]
+         && triangle.vertexIds_[1] != triangle.vertexIds_[2]
+         && triangle.vertexIds_[0] != triangle.vertexIds_[2])
+        triangles[kept++] = triangle;
     }
+    triangles.resize(kept);
   }
 
   {
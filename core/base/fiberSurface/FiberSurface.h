@@ -48,6 +48,7 @@
 
 // base code includes
 #include <Geometry.h>
+#include <RangeBrickIndex.h>
 #ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
 #include <RangeDrivenOctree.h>
 #endif
@@ -81,6 +82,14 @@ namespace ttk {
 
     ~FiberSurface();
 
+    /// Builds the min-max brick index of the range (only for 3D regular
+    /// grids, returns a negative value otherwise). The index is kept until
+    /// flushBrickIndex() is called, and is used instead of the octree if
+    /// both are built. It is much faster to build than the octree, and
+    /// slightly faster to query.
+    template <class dataTypeU, class dataTypeV>
+    inline int buildBrickIndex();
+
 #ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
     template <class dataTypeU, class dataTypeV>
     inline int buildOctree();
@@ -107,6 +116,12 @@ namespace ttk {
     template <class dataTypeU, class dataTypeV>
     inline int computeSurface();
 
+    template <class dataTypeU, class dataTypeV>
+    inline int computeSurfaceWithBrickIndex(
+      const std::pair<double, double> &rangePoint0,
+      const std::pair<double, double> &rangePoint1,
+      const SimplexId &polygonEdgeId) const;
+
 #ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
     template <class dataTypeU, class dataTypeV>
     inline int
@@ -121,6 +136,10 @@ namespace ttk {
                         const bool &edgeFlips = false,
                         const bool &intersectionRemesh = false);
 
+    inline int flushBrickIndex() {
+      return brickIndex_.flush();
+    }
+
 #ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
     inline int flushOctree() {
       return octree_.flush();
@@ -505,12 +524,41 @@ namespace ttk {
 
     Triangulation *triangulation_;
 
+    RangeBrickIndex brickIndex_;
+
 #ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
     RangeDrivenOctree octree_;
 #endif
   };
 } // namespace ttk
 
+template <class dataTypeU, class dataTypeV>
+inline int ttk::FiberSurface::buildBrickIndex() {
+
+  if(!uField_)
+    return -1;
+  if(!vField_)
+    return -2;
+  if((!triangulation_)
+     || (triangulation_->getType() != Triangulation::Type::IMPLICIT)
+     || (triangulation_->getDimensionality() != 3))
+    return -3;
+
+  std::vector<int> dimensions;
+  if(triangulation_->getGridDimensions(dimensions))
+    return -4;
+
+  if(!brickIndex_.isBuilt(dimensions.data())) {
+    brickIndex_.setDebugLevel(debugLevel_);
+    brickIndex_.setThreadNumber(threadNumber_);
+    return brickIndex_.build<dataTypeU, dataTypeV>(
+      (const dataTypeU *)uField_, (const dataTypeV *)vField_,
+      dimensions.data());
+  }
+
+  return 0;
+}
+
 #ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
 template <class dataTypeU, class dataTypeV>
 inline int ttk::FiberSurface::buildOctree() {
@@ -1685,38 +1733,40 @@ inline int ttk::FiberSurface::computeSurface() {
 
   Timer t;
 
-#ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
-  if(!octree_.empty()) {
+  if(!brickIndex_.empty()) {
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
     for(SimplexId i = 0; i < polygonEdgeNumber_; i++) {
 
-      computeSurfaceWithOctree<dataTypeU, dataTypeV>(
+      computeSurfaceWithBrickIndex<dataTypeU, dataTypeV>(
         (*polygon_)[i].first, (*polygon_)[i].second, i);
     }
-  } else {
-    // regular extraction (the octree has not been computed)
+  }
+#ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
+  else if(!octree_.empty()) {
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
     for(SimplexId i = 0; i < polygonEdgeNumber_; i++) {
-      computeSurface<dataTypeU, dataTypeV>(
+
+      computeSurfaceWithOctree<dataTypeU, dataTypeV>(
         (*polygon_)[i].first, (*polygon_)[i].second, i);
     }
   }
-
-#else
+#endif
+  else {
+    // regular extraction (no range index has been computed)
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < polygonEdgeNumber_; i++) {
-
-    computeSurface<dataTypeU, dataTypeV>(
-      (*polygon_)[i].first, (*polygon_)[i].second, i);
+    for(SimplexId i = 0; i < polygonEdgeNumber_; i++) {
+      computeSurface<dataTypeU, dataTypeV>(
+        (*polygon_)[i].first, (*polygon_)[i].second, i);
+    }
   }
-#endif
 
   finalize<dataTypeU, dataTypeV>(pointSnapping_, false, false, false);
 
@@ -1731,6 +1781,51 @@ inline int ttk::FiberSurface::computeSurface() {
   return 0;
 }
 
+template <class dataTypeU, class dataTypeV>
+inline int ttk::FiberSurface::computeSurfaceWithBrickIndex(
+  const std::pair<double, double> &rangePoint0,
+  const std::pair<double, double> &rangePoint1,
+  const SimplexId &polygonEdgeId) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!triangulation_)
+    return -1;
+  if(!uField_)
+    return -3;
+  if(!vField_)
+    return -4;
+  if(!polygonEdgeNumber_)
+    return -6;
+  if(!globalVertexList_)
+    return -7;
+#endif
+
+  std::vector<SimplexId> brickList;
+  brickIndex_.rangeSegmentQuery(rangePoint0, rangePoint1, brickList);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    std::vector<SimplexId> tetList;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+    for(SimplexId i = 0; i < (SimplexId)brickList.size(); i++) {
+      brickIndex_.getBrickCells<dataTypeU, dataTypeV>(
+        brickList[i], (const dataTypeU *)uField_, (const dataTypeV *)vField_,
+        rangePoint0, rangePoint1, tetList);
+      for(const auto &tetId : tetList) {
+        processTetrahedron<dataTypeU, dataTypeV>(
+          tetId, rangePoint0, rangePoint1, polygonEdgeId);
+      }
+    }
+  }
+
+  return 0;
+}
+
 #ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
 template <class dataTypeU, class dataTypeV>
 inline int ttk::FiberSurface::computeSurfaceWithOctree(
@@ -0,0 +1,364 @@
+/// \ingroup base
+/// \class ttk::RangeBrickIndex
+/// \date October 2026.
+///
+/// \brief TTK range index of bivariate data on regular grids, for fiber
+/// surface extraction.
+///
+/// The cubes of the grid are grouped in bricks (of brickSize^3 cubes) and the
+/// range (minimum and maximum of both fields) of each brick is stored in four
+/// flat arrays. The index is small (32 MB for 512^3 grids), built in
+/// parallel in one pass over the data and queried with vectorized tests, so
+/// that it can be kept between two fiber surface extractions with different
+/// polygons (see FiberSurface::buildBrickIndex()).
+///
+/// The tetrahedra of a brick are numbered as in ttk::ImplicitTriangulation
+/// (6 per cube). Within a brick returned by a query, the cubes and then the
+/// tetrahedra whose vertices all lie on the same side of the line of the
+/// range segment, or all beyond the same end of the segment, are skipped.
+///
+/// \sa ttk::RangeDrivenOctree (slower to build and to query)
+/// \sa FiberSurface.h %for a usage example.
+
+#pragma once
+
+#include <Wrapper.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace ttk {
+
+  class RangeBrickIndex : public Debug {
+
+  public:
+    /// Builds the index of the fields u and v (vertex data) of a 3D grid of
+    /// dimensions (in vertices) dimensions.
+    template <class dataTypeU, class dataTypeV>
+    inline int build(const dataTypeU *u,
+                     const dataTypeV *v,
+                     const int dimensions[3],
+                     const int brickSize = 4);
+
+    inline bool empty() const {
+      return uMin_.empty();
+    }
+
+    inline int flush() {
+      uMin_.clear();
+      uMax_.clear();
+      vMin_.clear();
+      vMax_.clear();
+      return 0;
+    }
+
+    /// Returns true if the index has been built for a grid of the given
+    /// dimensions.
+    inline bool isBuilt(const int dimensions[3]) const {
+      return !empty() && dimensions[0] == dimensions_[0]
+             && dimensions[1] == dimensions_[1]
+             && dimensions[2] == dimensions_[2];
+    }
+
+    /// Bricks whose range box intersects the range segment [p0, p1].
+    inline int rangeSegmentQuery(const std::pair<double, double> &p0,
+                                 const std::pair<double, double> &p1,
+                                 std::vector<SimplexId> &brickList) const;
+
+    /// Tetrahedra of a brick.
+    inline int getBrickCells(const SimplexId &brickId,
+                             std::vector<SimplexId> &cellList) const;
+
+    /// Tetrahedra of a brick, except those lying strictly on one side of the
+    /// line carrying the range segment [p0, p1] or strictly beyond one of its
+    /// ends (these cannot contain any fiber of the segment).
+    template <class dataTypeU, class dataTypeV>
+    inline int getBrickCells(const SimplexId &brickId,
+                             const dataTypeU *u,
+                             const dataTypeV *v,
+                             const std::pair<double, double> &p0,
+                             const std::pair<double, double> &p1,
+                             std::vector<SimplexId> &cellList) const;
+
+  protected:
+    // conservative single precision bounds
+    static inline float lowerBound(const double &x) {
+      float f = static_cast<float>(x);
+      if(f > x)
+        f = std::nextafter(f, -std::numeric_limits<float>::max());
+      return f;
+    }
+
+    static inline float upperBound(const double &x) {
+      float f = static_cast<float>(x);
+      if(f < x)
+        f = std::nextafter(f, std::numeric_limits<float>::max());
+      return f;
+    }
+
+    int dimensions_[3]{};
+    int brickSize_{4};
+    // number of bricks per axis
+    SimplexId brickNumber_[3]{};
+    std::vector<float> uMin_{}, uMax_{}, vMin_{}, vMax_{};
+  };
+} // namespace ttk
+
+template <class dataTypeU, class dataTypeV>
+inline int ttk::RangeBrickIndex::build(const dataTypeU *u,
+                                       const dataTypeV *v,
+                                       const int dimensions[3],
+                                       const int brickSize) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!u || !v)
+    return -1;
+  if(dimensions[0] < 2 || dimensions[1] < 2 || dimensions[2] < 2)
+    return -2;
+  if(brickSize < 1)
+    return -3;
+#endif
+
+  Timer t;
+
+  for(int i = 0; i < 3; i++) {
+    dimensions_[i] = dimensions[i];
+    brickNumber_[i] = (dimensions[i] - 2) / brickSize + 1;
+  }
+  brickSize_ = brickSize;
+
+  const SimplexId brickNumber
+    = brickNumber_[0] * brickNumber_[1] * brickNumber_[2];
+  uMin_.resize(brickNumber);
+  uMax_.resize(brickNumber);
+  vMin_.resize(brickNumber);
+  vMax_.resize(brickNumber);
+
+  const SimplexId rowSize = dimensions[0];
+  const SimplexId sliceSize = rowSize * dimensions[1];
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threadNumber_)
+#endif
+  for(SimplexId b = 0; b < brickNumber; b++) {
+    const SimplexId bx = b % brickNumber_[0];
+    const SimplexId by = (b / brickNumber_[0]) % brickNumber_[1];
+    const SimplexId bz = b / (brickNumber_[0] * brickNumber_[1]);
+
+    // vertex bounds of the brick (shared with the neighbor bricks)
+    const SimplexId x0 = bx * brickSize, y0 = by * brickSize,
+                    z0 = bz * brickSize;
+    const SimplexId x1 = std::min<SimplexId>(x0 + brickSize, dimensions[0] - 1);
+    const SimplexId y1 = std::min<SimplexId>(y0 + brickSize, dimensions[1] - 1);
+    const SimplexId z1 = std::min<SimplexId>(z0 + brickSize, dimensions[2] - 1);
+
+    double uLow = std::numeric_limits<double>::max();
+    double uHigh = std::numeric_limits<double>::lowest();
+    double vLow = uLow, vHigh = uHigh;
+    for(SimplexId z = z0; z <= z1; z++) {
+      for(SimplexId y = y0; y <= y1; y++) {
+        const SimplexId offset = z * sliceSize + y * rowSize;
+        for(SimplexId x = x0; x <= x1; x++) {
+          const double uValue = u[offset + x];
+          const double vValue = v[offset + x];
+          uLow = std::min(uLow, uValue);
+          uHigh = std::max(uHigh, uValue);
+          vLow = std::min(vLow, vValue);
+          vHigh = std::max(vHigh, vValue);
+        }
+      }
+    }
+
+    uMin_[b] = lowerBound(uLow);
+    uMax_[b] = upperBound(uHigh);
+    vMin_[b] = lowerBound(vLow);
+    vMax_[b] = upperBound(vHigh);
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[RangeBrickIndex] Index built (" << brickNumber << " bricks) in "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+inline int ttk::RangeBrickIndex::rangeSegmentQuery(
+  const std::pair<double, double> &p0,
+  const std::pair<double, double> &p1,
+  std::vector<SimplexId> &brickList) const {
+
+  brickList.clear();
+
+  const SimplexId brickNumber = uMin_.size();
+  std::vector<unsigned char> hits(brickNumber);
+
+  // bounding box of the segment
+  const double su0 = std::min(p0.first, p1.first);
+  const double su1 = std::max(p0.first, p1.first);
+  const double sv0 = std::min(p0.second, p1.second);
+  const double sv1 = std::max(p0.second, p1.second);
+  // normal of the segment line
+  const double nu = p0.second - p1.second;
+  const double nv = p1.first - p0.first;
+  const double anu = std::abs(nu), anv = std::abs(nv);
+
+  const float *uMin = uMin_.data();
+  const float *uMax = uMax_.data();
+  const float *vMin = vMin_.data();
+  const float *vMax = vMax_.data();
+  unsigned char *hit = hits.data();
+
+  // separating axis test (segment bounding box and segment line)
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId b = 0; b < brickNumber; b++) {
+    const double cu = 0.5 * ((double)uMin[b] + (double)uMax[b]);
+    const double cv = 0.5 * ((double)vMin[b] + (double)vMax[b]);
+    const double hu = 0.5 * ((double)uMax[b] - (double)uMin[b]);
+    const double hv = 0.5 * ((double)vMax[b] - (double)vMin[b]);
+    const double distance = nu * (cu - p0.first) + nv * (cv - p0.second);
+    const double radius = anu * hu + anv * hv;
+    // rounding slack (the test must be conservative)
+    const double slack = 1e-9
+                         * (anu * (std::abs(cu) + std::abs(p0.first) + hu)
+                            + anv * (std::abs(cv) + std::abs(p0.second) + hv));
+    hit[b] = (uMin[b] <= su1) & (uMax[b] >= su0) & (vMin[b] <= sv1)
+             & (vMax[b] >= sv0) & (std::abs(distance) <= radius + slack);
+  }
+
+  for(SimplexId b = 0; b < brickNumber; b++)
+    if(hit[b])
+      brickList.push_back(b);
+
+  return 0;
+}
+
+inline int
+  ttk::RangeBrickIndex::getBrickCells(const SimplexId &brickId,
+                                      std::vector<SimplexId> &cellList) const {
+
+  cellList.clear();
+
+  const SimplexId bx = brickId % brickNumber_[0];
+  const SimplexId by = (brickId / brickNumber_[0]) % brickNumber_[1];
+  const SimplexId bz = brickId / (brickNumber_[0] * brickNumber_[1]);
+
+  // cube bounds of the brick
+  const SimplexId x0 = bx * brickSize_, y0 = by * brickSize_,
+                  z0 = bz * brickSize_;
+  const SimplexId x1 = std::min<SimplexId>(x0 + brickSize_, dimensions_[0] - 1);
+  const SimplexId y1 = std::min<SimplexId>(y0 + brickSize_, dimensions_[1] - 1);
+  const SimplexId z1 = std::min<SimplexId>(z0 + brickSize_, dimensions_[2] - 1);
+
+  const SimplexId rowSize = (SimplexId)(dimensions_[0] - 1) * 6;
+  const SimplexId sliceSize = rowSize * (dimensions_[1] - 1);
+
+  for(SimplexId z = z0; z < z1; z++) {
+    for(SimplexId y = y0; y < y1; y++) {
+      for(SimplexId x = x0; x < x1; x++) {
+        const SimplexId cube = z * sliceSize + y * rowSize + x * 6;
+        for(int k = 0; k < 6; k++)
+          cellList.push_back(cube + k);
+      }
+    }
+  }
+
+  return 0;
+}
+
+template <class dataTypeU, class dataTypeV>
+inline int ttk::RangeBrickIndex::getBrickCells(
+  const SimplexId &brickId,
+  const dataTypeU *u,
+  const dataTypeV *v,
+  const std::pair<double, double> &p0,
+  const std::pair<double, double> &p1,
+  std::vector<SimplexId> &cellList) const {
+
+  cellList.clear();
+
+  const SimplexId bx = brickId % brickNumber_[0];
+  const SimplexId by = (brickId / brickNumber_[0]) % brickNumber_[1];
+  const SimplexId bz = brickId / (brickNumber_[0] * brickNumber_[1]);
+
+  const SimplexId x0 = bx * brickSize_, y0 = by * brickSize_,
+                  z0 = bz * brickSize_;
+  const SimplexId x1 = std::min<SimplexId>(x0 + brickSize_, dimensions_[0] - 1);
+  const SimplexId y1 = std::min<SimplexId>(y0 + brickSize_, dimensions_[1] - 1);
+  const SimplexId z1 = std::min<SimplexId>(z0 + brickSize_, dimensions_[2] - 1);
+
+  const SimplexId rowSize = dimensions_[0];
+  const SimplexId sliceSize = rowSize * dimensions_[1];
+  const SimplexId cubeRowSize = (SimplexId)(dimensions_[0] - 1) * 6;
+  const SimplexId cubeSliceSize = cubeRowSize * (dimensions_[1] - 1);
+
+  const double nu = p0.second - p1.second;
+  const double nv = p1.first - p0.first;
+  // squared length of the segment
+  const double length = nv * nv + nu * nu;
+  // vertices closer to the line or to the segment ends are not classified
+  // (they are snapped by FiberSurface::processTetrahedron())
+  const double margin
+    = 1e-9 * (std::abs(nu) + std::abs(nv))
+      * (1 + std::abs(p0.first) + std::abs(p0.second));
+
+  // half-planes of the range containing each vertex of the brick: one side
+  // of the segment line (bits 0 and 1), before the first segment end or
+  // after the second one (bits 2 and 3)
+  const SimplexId sx = x1 - x0 + 1, sy = y1 - y0 + 1;
+  std::vector<unsigned char> planes(sx * sy * (z1 - z0 + 1));
+  for(SimplexId z = z0; z <= z1; z++) {
+    for(SimplexId y = y0; y <= y1; y++) {
+      const SimplexId offset = z * sliceSize + y * rowSize;
+      unsigned char *row = &planes[((z - z0) * sy + (y - y0)) * sx - x0];
+      for(SimplexId x = x0; x <= x1; x++) {
+        const double du = (double)u[offset + x] - p0.first;
+        const double dv = (double)v[offset + x] - p0.second;
+        const double d = nu * du + nv * dv;
+        const double t = nv * du - nu * dv;
+        row[x] = (d > margin) | (d < -margin) << 1 | (t < -margin) << 2
+                 | (t > length + margin) << 3;
+      }
+    }
+  }
+
+  // cube corner offsets (bit 0: x, bit 1: y, bit 2: z) and corners of the
+  // 6 tetrahedra of a cube (ImplicitTriangulation order)
+  const SimplexId corner[8]
+    = {0, 1, sx, sx + 1, sx * sy, sx * sy + 1, sx * sy + sx, sx * sy + sx + 1};
+  static const int tetCorners[6][4] = {{0, 1, 2, 6}, {1, 2, 3, 6},
+                                       {0, 1, 4, 6}, {1, 4, 5, 6},
+                                       {1, 5, 6, 7}, {1, 3, 6, 7}};
+
+  // a cube (or a tetrahedron) whose vertices all lie in one of these
+  // half-planes cannot contain any fiber of the segment
+  for(SimplexId z = z0; z < z1; z++) {
+    for(SimplexId y = y0; y < y1; y++) {
+      for(SimplexId x = x0; x < x1; x++) {
+        const unsigned char *c
+          = &planes[((z - z0) * sy + (y - y0)) * sx + (x - x0)];
+        unsigned char m[8];
+        for(int k = 0; k < 8; k++)
+          m[k] = c[corner[k]];
+        if(m[0] & m[1] & m[2] & m[3] & m[4] & m[5] & m[6] & m[7])
+          continue;
+        const SimplexId cube = z * cubeSliceSize + y * cubeRowSize + x * 6;
+        for(int k = 0; k < 6; k++) {
+          const int *tc = tetCorners[k];
+          if(!(m[tc[0]] & m[tc[1]] & m[tc[2]] & m[tc[3]]))
+            cellList.push_back(cube + k);
+        }
+      }
+    }
+  }
+
+  return 0;
+}
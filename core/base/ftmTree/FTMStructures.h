@@ -46,6 +46,8 @@ namespace ttk {
       SimplexId size;
       void *values;
       void *offsets;
+      // optional precomputed global vertex order (rank of each vertex)
+      const SimplexId *order;
 
       std::shared_ptr<std::vector<SimplexId>> sortedVertices, mirrorVertices;
 
@@ -66,13 +68,13 @@ namespace ttk {
       }
 
       Scalars()
-        : size(0), values(nullptr), offsets(nullptr), sortedVertices(nullptr),
-          mirrorVertices(nullptr) {
+        : size(0), values(nullptr), offsets(nullptr), order(nullptr),
+          sortedVertices(nullptr), mirrorVertices(nullptr) {
       }
 
       // Heavy
       Scalars(const Scalars &o)
-        : size(o.size), values(o.values), offsets(o.offsets),
+        : size(o.size), values(o.values), offsets(o.offsets), order(o.order),
           sortedVertices(o.sortedVertices), mirrorVertices(o.mirrorVertices) {
         std::cout << "copy in depth, bad perfs" << std::endl;
       }
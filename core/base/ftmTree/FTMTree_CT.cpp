@@ -455,32 +455,9 @@ int FTMTree_CT::leafSearch() {
     {
       const SimplexId lowerBound = chunkId * chunkSize;
       const SimplexId upperBound = min(nbScalars, (chunkId + 1) * chunkSize);
-      for(SimplexId v = lowerBound; v < upperBound; ++v) {
-        const auto &neighNumb = mesh_->getVertexNeighborNumber(v);
-        valence upval = 0;
-        valence downval = 0;
-
-        for(valence n = 0; n < neighNumb; ++n) {
-          SimplexId neigh;
-          mesh_->getVertexNeighbor(v, n, neigh);
-          if(scalars_->isLower(neigh, v)) {
-            ++downval;
-          } else {
-            ++upval;
-          }
-        }
-
-        jt_->setValence(v, downval);
-        st_->setValence(v, upval);
-
-        if(!downval) {
-          jt_->makeNode(v);
-        }
-
-        if(!upval) {
-          st_->makeNode(v);
-        }
-      }
+      ttkTemplateMacro(
+        mesh_->getType(),
+        leafSearchChunk((TTK_TT *)mesh_->getData(), lowerBound, upperBound));
     }
   }
 
@@ -489,3 +466,35 @@ int FTMTree_CT::leafSearch() {
 #endif
   return 0;
 }
+
+template <class triangulationType>
+void FTMTree_CT::leafSearchChunk(const triangulationType *mesh,
+                                 const SimplexId lowerBound,
+                                 const SimplexId upperBound) {
+  for(SimplexId v = lowerBound; v < upperBound; ++v) {
+    const auto &neighNumb = mesh->getVertexNeighborNumber(v);
+    valence upval = 0;
+    valence downval = 0;
+
+    for(valence n = 0; n < neighNumb; ++n) {
+      SimplexId neigh;
+      mesh->getVertexNeighbor(v, n, neigh);
+      if(scalars_->isLower(neigh, v)) {
+        ++downval;
+      } else {
+        ++upval;
+      }
+    }
+
+    jt_->setValence(v, downval);
+    st_->setValence(v, upval);
+
+    if(!downval) {
+      jt_->makeNode(v);
+    }
+
+    if(!upval) {
+      st_->makeNode(v);
+    }
+  }
+}
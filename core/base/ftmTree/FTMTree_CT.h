@@ -99,6 +99,11 @@ namespace ttk {
 
       int leafSearch();
 
+      template <class triangulationType>
+      void leafSearchChunk(const triangulationType *mesh,
+                           const SimplexId lowerBound,
+                           const SimplexId upperBound);
+
       void build(TreeType tt);
 
       void insertNodes();
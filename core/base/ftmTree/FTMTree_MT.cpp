@@ -146,7 +146,10 @@ FTMTree_MT::~FTMTree_MT() {
 #endif
 }
 
-void FTMTree_MT::arcGrowth(const SimplexId startVert, const SimplexId orig) {
+template <class triangulationType>
+void FTMTree_MT::arcGrowth(const triangulationType *mesh,
+                           const SimplexId startVert,
+                           const SimplexId orig) {
   // current task id / propag
 
   // local order (ignore non regular verts)
@@ -203,7 +206,7 @@ void FTMTree_MT::arcGrowth(const SimplexId startVert, const SimplexId orig) {
 
     // Saddle & Last detection + propagation
     bool isSaddle, isLast;
-    tie(isSaddle, isLast) = propage(*currentState, startUF);
+    tie(isSaddle, isLast) = propage(mesh, *currentState, startUF);
 
     // regular propagation
 #ifdef TTK_ENABLE_OPENMP
@@ -250,7 +253,7 @@ void FTMTree_MT::arcGrowth(const SimplexId startVert, const SimplexId orig) {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp taskyield
 #endif
-        arcGrowth(currentVert, orig);
+        arcGrowth(mesh, currentVert, orig);
       } else {
         // Active tasks / threads
 #ifdef TTK_ENABLE_OPENMP
@@ -303,11 +306,14 @@ void FTMTree_MT::build(const bool ct) {
   }
 
   // Build Merge treeString using tasks
+  debug::TraceSpan leafSearchSpan("FTMTree", "leafSearch " + treeString);
   DebugTimer precomputeTime;
   int alreadyDone = leafSearch();
   printTime(precomputeTime, "[FTM] leafSearch " + treeString, scalars_->size,
             3 + alreadyDone);
+  leafSearchSpan.end();
 
+  debug::TraceSpan leafGrowthSpan("FTMTree", "leafGrowth " + treeString);
   DebugTimer buildTime;
   leafGrowth();
   int nbProcessed = 0;
@@ -319,13 +325,17 @@ void FTMTree_MT::build(const bool ct) {
   }
 #endif
   printTime(buildTime, "[FTM] leafGrowth " + treeString, nbProcessed, 3);
+  leafGrowthSpan.end();
 
+  debug::TraceSpan trunkSpan("FTMTree", "trunk " + treeString);
   DebugTimer bbTime;
   SimplexId bbSize = trunk(ct);
   printTime(bbTime, "[FTM] trunk " + treeString, bbSize, 3);
+  trunkSpan.end();
 
   // Segmentation
   if(ct && params_->segm) {
+    const debug::TraceSpan segmentSpan("FTMTree", "segment " + treeString);
     DebugTimer segmTime;
     buildSegmentation();
     printTime(segmTime, "[FTM] segment " + treeString, scalars_->size, 3);
@@ -789,7 +799,10 @@ void FTMTree_MT::leafGrowth() {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp task untied OPTIONAL_PRIORITY(isPrior())
 #endif
-    arcGrowth(v, n);
+    {
+      ttkTemplateMacro(
+        mesh_->getType(), arcGrowth((TTK_TT *)mesh_->getData(), v, n));
+    }
   }
 
 #ifdef TTK_ENABLE_OPENMP
@@ -813,22 +826,10 @@ int FTMTree_MT::leafSearch() {
       {
         const SimplexId lowerBound = chunkId * chunkSize;
         const SimplexId upperBound = min(nbScalars, (chunkId + 1) * chunkSize);
-        for(SimplexId v = lowerBound; v < upperBound; ++v) {
-          const auto &neighNumb = mesh_->getVertexNeighborNumber(v);
-          valence val = 0;
-
-          for(valence n = 0; n < neighNumb; ++n) {
-            SimplexId neigh;
-            mesh_->getVertexNeighbor(v, n, neigh);
-            comp_.vertLower(neigh, v) && ++val;
-          }
-
-          (*mt_data_.valences)[v] = val;
-
-          if(!val) {
-            makeNode(v);
-          }
-        }
+        ttkTemplateMacro(
+          mesh_->getType(),
+          leafSearchChunk(
+            (TTK_TT *)mesh_->getData(), lowerBound, upperBound));
       }
     }
 
@@ -858,6 +859,28 @@ int FTMTree_MT::leafSearch() {
   return ret;
 }
 
+template <class triangulationType>
+void FTMTree_MT::leafSearchChunk(const triangulationType *mesh,
+                                 const SimplexId lowerBound,
+                                 const SimplexId upperBound) {
+  for(SimplexId v = lowerBound; v < upperBound; ++v) {
+    const auto &neighNumb = mesh->getVertexNeighborNumber(v);
+    valence val = 0;
+
+    for(valence n = 0; n < neighNumb; ++n) {
+      SimplexId neigh;
+      mesh->getVertexNeighbor(v, n, neigh);
+      comp_.vertLower(neigh, v) && ++val;
+    }
+
+    (*mt_data_.valences)[v] = val;
+
+    if(!val) {
+      makeNode(v);
+    }
+  }
+}
+
 idNode FTMTree_MT::makeNode(SimplexId vertexId, SimplexId term) {
 #ifndef TTK_ENABLE_KAMIKAZE
   if(vertexId < 0 || vertexId >= scalars_->size) {
@@ -1173,9 +1196,12 @@ void FTMTree_MT::printTree2() {
   }
 }
 
-tuple<bool, bool> FTMTree_MT::propage(CurrentState &currentState, UF curUF) {
+template <class triangulationType>
+tuple<bool, bool> FTMTree_MT::propage(const triangulationType *mesh,
+                                      CurrentState &currentState,
+                                      UF curUF) {
   bool becameSaddle = false, isLast = false;
-  const auto nbNeigh = mesh_->getVertexNeighborNumber(currentState.vertex);
+  const auto nbNeigh = mesh->getVertexNeighborNumber(currentState.vertex);
   valence decr = 0;
 
   // once for all
@@ -1184,7 +1210,7 @@ tuple<bool, bool> FTMTree_MT::propage(CurrentState &currentState, UF curUF) {
   // propagation / is saddle
   for(valence n = 0; n < nbNeigh; ++n) {
     SimplexId neigh;
-    mesh_->getVertexNeighbor(currentState.vertex, n, neigh);
+    mesh->getVertexNeighbor(currentState.vertex, n, neigh);
 
     if(comp_.vertLower(neigh, currentState.vertex)) {
       UF neighUF = (*mt_data_.ufs)[neigh];
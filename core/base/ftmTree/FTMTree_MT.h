@@ -39,6 +39,7 @@
 #endif
 
 #include <Geometry.h>
+#include <OrderDisambiguation.h>
 #include <Triangulation.h>
 #include <Wrapper.h>
 
@@ -244,13 +245,27 @@ namespace ttk {
 
       virtual int leafSearch();
 
+      // the traversal kernels below receive the triangulation with its
+      // concrete type (see ttkTemplateMacro) to avoid virtual calls
+
+      template <class triangulationType>
+      void leafSearchChunk(const triangulationType *mesh,
+                           const SimplexId lowerBound,
+                           const SimplexId upperBound);
+
       // skeleton
 
       void leafGrowth();
 
-      void arcGrowth(const SimplexId startVert, const SimplexId orig);
+      template <class triangulationType>
+      void arcGrowth(const triangulationType *mesh,
+                     const SimplexId startVert,
+                     const SimplexId orig);
 
-      std::tuple<bool, bool> propage(CurrentState &currentState, UF curUF);
+      template <class triangulationType>
+      std::tuple<bool, bool> propage(const triangulationType *mesh,
+                                     CurrentState &currentState,
+                                     UF curUF);
 
       void closeAndMergeOnSaddle(SimplexId saddleVert);
 
@@ -364,6 +379,11 @@ namespace ttk {
         scalars_->offsets = (void *)sos;
       }
 
+      // precomputed vertex order (skips the sort step)
+      inline void setVertexOrder(const SimplexId *const order) {
+        scalars_->order = order;
+      }
+
       // arcs
 
       inline idSuperArc getNumberOfSuperArcs(void) const {
@@ -42,30 +42,6 @@ namespace ttk {
         sortedVect->clear();
       }
 
-      auto indirect_sort = [&](const size_t &a, const size_t &b) {
-        return isLower<scalarType, idType>(a, b);
-      };
-
-      sortedVect->resize(nbVertices, 0);
-      std::iota(sortedVect->begin(), sortedVect->end(), SimplexId{0});
-
-      // #pragma omp parallel
-      // #pragma omp single
-      //    scalars_->qsort<SimplexId>(sortedVect->data(), 0, scalars_->size -1,
-      //    indirect_sort);
-
-#ifdef TTK_ENABLE_OPENMP
-#ifdef __clang__
-      std::cout << "Caution, outside GCC, sequential sort" << std::endl;
-      std::sort(sortedVect->begin(), sortedVect->end(), indirect_sort);
-#else
-      __gnu_parallel::sort(
-        sortedVect->begin(), sortedVect->end(), indirect_sort);
-#endif
-#else
-      std::sort(sortedVect->begin(), sortedVect->end(), indirect_sort);
-#endif
-
       auto *mirrorVert = scalars_->mirrorVertices.get();
       if(mirrorVert == nullptr) {
         mirrorVert = new std::vector<SimplexId>(0);
@@ -74,10 +50,29 @@ namespace ttk {
         mirrorVert->clear();
       }
 
-      scalars_->mirrorVertices->resize(nbVertices);
+      sortedVect->resize(nbVertices, 0);
+      mirrorVert->resize(nbVertices);
+
+      if(scalars_->order != nullptr) {
+        // re-use the global vertex order shared by the other filters
+        const auto order = scalars_->order;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+        for(SimplexId i = 0; i < nbVertices; i++) {
+          (*mirrorVert)[i] = order[i];
+          (*sortedVect)[order[i]] = i;
+        }
+        return;
+      }
+
+      // parallel radix sort, ties broken by the SoS offsets
+      ttk::sortVertices(nbVertices, (scalarType *)scalars_->values,
+                        (idType *)scalars_->offsets, sortedVect->data(),
+                        threadNumber_);
 
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for
+#pragma omp parallel for num_threads(threadNumber_)
 #endif
       for(SimplexId i = 0; i < nbVertices; i++) {
         (*scalars_->mirrorVertices)[(*sortedVect)[i]] = i;
@@ -71,7 +71,10 @@ void ttk::ftm::FTMTree::build(void) {
     }
   }
 
+  const debug::TraceSpan span("FTMTree", "build");
+
   // Alloc / reserve
+  debug::TraceSpan allocSpan("FTMTree", "alloc");
   DebugTimer initTime;
   switch(params_->treeType) {
     case TreeType::Join:
@@ -93,10 +96,12 @@ void ttk::ftm::FTMTree::build(void) {
       break;
   }
   printTime(initTime, "[FTM] alloc", -1, 3);
+  allocSpan.end();
 
   DebugTimer startTime;
 
   // init values
+  debug::TraceSpan initSpan("FTMTree", "init");
   DebugTimer setTimer;
   switch(params_->treeType) {
     case TreeType::Join:
@@ -118,21 +123,26 @@ void ttk::ftm::FTMTree::build(void) {
       break;
   }
   printTime(setTimer, "[FTM] init", -1, 3);
+  initSpan.end();
 
   // for fast comparison
   // and regions / segmentation
+  debug::TraceSpan sortSpan("FTMTree", "sort");
   DebugTimer sortTime;
   initSoS<idType>();
   sortInput<scalarType, idType>();
   printTime(sortTime, "[FTM] sort step", -1, 3);
+  sortSpan.end();
 
   // -----
   // BUILD
   // -----
 
+  debug::TraceSpan buildSpan("FTMTree", "buildTree");
   DebugTimer buildTime;
   FTMTree_CT::build(params_->treeType);
   printTime(buildTime, "[FTM] build tree", -1, 3);
+  buildSpan.end();
 
   printTime(startTime, "[FTM] Total ", -1, 1);
 
@@ -142,6 +152,7 @@ void ttk::ftm::FTMTree::build(void) {
 
   // Build the list of regular vertices of the arc
   if(params_->segm) {
+    const debug::TraceSpan segmentationSpan("FTMTree", "segmentation");
     switch(params_->treeType) {
       case TreeType::Join:
         getJoinTree()->buildSegmentation();
@@ -167,6 +178,7 @@ void ttk::ftm::FTMTree::build(void) {
 
   // Normalization
   if(params_->normalize) {
+    const debug::TraceSpan normalizeSpan("FTMTree", "normalizeIds");
     switch(params_->treeType) {
       case TreeType::Join:
         getJoinTree()->normalizeIds();
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 
 // base code includes
 #include <AbstractTriangulation.h>
@@ -240,7 +241,7 @@ namespace ttk {
         return -1;
 #endif // !TTK_ENABLE_KAMIKAZE
 
-      switch(vertexPositions_[vertexId]) {
+      switch(getVertexPosition(vertexId)) {
         case VertexPosition::CENTER_3D:
           return 14;
         case VertexPosition::FRONT_FACE_3D:
@@ -346,6 +347,37 @@ namespace ttk {
                      const SimplexId &yDim,
                      const SimplexId &zDim);
 
+    /// Set the size (in bytes) of the per-simplex position tables above
+    /// which the positions and grid coordinates of the simplices are
+    /// computed at query time (compact mode) instead of being stored. Use 0
+    /// to always compute them on the fly. The default is a quarter of the
+    /// physical memory (no compact mode if it is unknown), so that compact
+    /// mode, which is slower, is only used when the tables would not fit.
+    ///
+    /// The tables cost 13 bytes per vertex, edge and triangle and 12 bytes
+    /// per tetrahedron (with 32-bit identifiers), i.e. about 0.7 GB on a
+    /// 128^3 grid and 45 GB on a 512^3 grid. On-the-fly computation involves
+    /// a few integer divisions, done once per simplex thanks to a per-thread
+    /// cache of the last queried vertex, edge and triangle.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int setCompactPositionsThreshold(const size_t &threshold);
+
+    /// Returns the size (in bytes) of the per-simplex position tables of the
+    /// grid, once they are all preconditioned.
+    size_t getPositionTablesSize() const;
+
+    /// Returns true if the positions and grid coordinates of the simplices
+    /// are computed at query time.
+    inline bool hasCompactPositions() const {
+      return compactPositions_;
+    }
+
+    /// Returns the number of vertices along the x, y and z axes (vertex v
+    /// has coordinates (x, y, z) if v = x + y * dimX + z * dimX * dimY).
+    inline const SimplexId *getVertexGridDimensions() const {
+      return dimensions_;
+    }
+
     int preconditionVerticesInternal();
     int preconditionVertexNeighborsInternal() override;
     int preconditionEdgesInternal() override;
@@ -588,6 +620,49 @@ namespace ttk {
     // for every tetrahedron, its coordinates on the grid
     std::vector<std::array<SimplexId, 3>> tetrahedronCoords_{};
 
+    // compact mode: the tables above are left empty and the positions and
+    // coordinates are computed at query time
+    bool compactPositions_{false};
+    size_t compactPositionsThreshold_{getDefaultCompactPositionsThreshold()};
+    static size_t getDefaultCompactPositionsThreshold();
+
+    // compact mode: identifier of the grid (unique among all the
+    // triangulations) and per-thread cache of the last queried vertex, edge
+    // and triangle, whose position is typically requested by every call of a
+    // loop over its neighbors
+    size_t gridId_{0};
+    struct CachedPosition {
+      size_t gridId{0};
+      SimplexId id{-1};
+      int position{};
+      std::array<SimplexId, 3> coords{};
+    };
+    inline const CachedPosition &
+      getCachedVertexPosition(const SimplexId v) const;
+    inline const CachedPosition &getCachedEdgePosition(const SimplexId e) const;
+    inline const CachedPosition &
+      getCachedTrianglePosition(const SimplexId t) const;
+
+    // accessors to the simplex positions and coordinates (table look-up or
+    // on-the-fly computation depending on the mode)
+    inline VertexPosition getVertexPosition(const SimplexId v) const;
+    inline std::array<SimplexId, 3> getVertexCoords(const SimplexId v) const;
+    inline EdgePosition getEdgePosition(const SimplexId e) const;
+    inline std::array<SimplexId, 3> getEdgeCoords(const SimplexId e) const;
+    inline TrianglePosition getTrianglePosition(const SimplexId t) const;
+    inline std::array<SimplexId, 3> getTriangleCoords(const SimplexId t) const;
+    inline std::array<SimplexId, 3>
+      getTetrahedronCoords(const SimplexId t) const;
+
+    // on-the-fly computation of the simplex positions (p receives the
+    // simplex coordinates on the grid)
+    inline VertexPosition computeVertexPosition(const SimplexId v,
+                                                SimplexId p[3]) const;
+    inline EdgePosition computeEdgePosition(const SimplexId e,
+                                            SimplexId p[3]) const;
+    inline TrianglePosition computeTrianglePosition(const SimplexId t,
+                                                    SimplexId p[3]) const;
+
     int dimensionality_; //
     float origin_[3]; //
     float spacing_[3]; //
@@ -967,7 +1042,7 @@ inline void
 inline void ttk::ImplicitTriangulation::edgeToPosition2d(const SimplexId edge,
                                                          const int k,
                                                          SimplexId p[2]) const {
-  const int e = (k) ? edge - esetshift_[k - 1] : edge;
+  const SimplexId e = (k) ? edge - esetshift_[k - 1] : edge;
   p[0] = e % eshift_[2 * k];
   p[1] = e / eshift_[2 * k];
 }
@@ -1514,7 +1589,7 @@ inline void ttk::ImplicitTriangulation::vertexToPosition(const SimplexId vertex,
 inline void ttk::ImplicitTriangulation::edgeToPosition(const SimplexId edge,
                                                        const int k,
                                                        SimplexId p[3]) const {
-  const int e = (k) ? edge - esetshift_[k - 1] : edge;
+  const SimplexId e = (k) ? edge - esetshift_[k - 1] : edge;
   p[0] = e % eshift_[2 * k];
   p[1] = (e % eshift_[2 * k + 1]) / eshift_[2 * k];
   p[2] = e / eshift_[2 * k + 1];
@@ -1536,6 +1611,393 @@ inline void
   p[2] = tetrahedron / tetshift_[1];
 }
 
+inline ttk::ImplicitTriangulation::VertexPosition
+  ttk::ImplicitTriangulation::computeVertexPosition(const SimplexId v,
+                                                    SimplexId p[3]) const {
+
+  if(dimensionality_ == 3) {
+    vertexToPosition(v, p);
+
+    if(0 < p[0] and p[0] < nbvoxels_[0]) {
+      if(0 < p[1] and p[1] < nbvoxels_[1]) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return VertexPosition::CENTER_3D;
+        else if(p[2] == 0)
+          return VertexPosition::FRONT_FACE_3D; // abcd
+        else
+          return VertexPosition::BACK_FACE_3D; // efgh
+      } else if(p[1] == 0) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return VertexPosition::TOP_FACE_3D; // abef
+        else if(p[2] == 0)
+          return VertexPosition::TOP_FRONT_EDGE_3D; // ab
+        else
+          return VertexPosition::TOP_BACK_EDGE_3D; // ef
+      } else {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return VertexPosition::BOTTOM_FACE_3D; // cdgh
+        else if(p[2] == 0)
+          return VertexPosition::BOTTOM_FRONT_EDGE_3D; // cd
+        else
+          return VertexPosition::BOTTOM_BACK_EDGE_3D; // gh
+      }
+    } else if(p[0] == 0) {
+      if(0 < p[1] and p[1] < nbvoxels_[1]) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return VertexPosition::LEFT_FACE_3D; // aceg
+        else if(p[2] == 0)
+          return VertexPosition::LEFT_FRONT_EDGE_3D; // ac
+        else
+          return VertexPosition::LEFT_BACK_EDGE_3D; // eg
+      } else if(p[1] == 0) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return VertexPosition::TOP_LEFT_EDGE_3D; // ae
+        else if(p[2] == 0)
+          return VertexPosition::TOP_LEFT_FRONT_CORNER_3D; // a
+        else
+          return VertexPosition::TOP_LEFT_BACK_CORNER_3D; // e
+      } else {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return VertexPosition::BOTTOM_LEFT_EDGE_3D; // cg
+        else if(p[2] == 0)
+          return VertexPosition::BOTTOM_LEFT_FRONT_CORNER_3D; // c
+        else
+          return VertexPosition::BOTTOM_LEFT_BACK_CORNER_3D; // g
+      }
+    } else {
+      if(0 < p[1] and p[1] < nbvoxels_[1]) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return VertexPosition::RIGHT_FACE_3D; // bdfh
+        else if(p[2] == 0)
+          return VertexPosition::RIGHT_FRONT_EDGE_3D; // bd
+        else
+          return VertexPosition::RIGHT_BACK_EDGE_3D; // fh
+      } else if(p[1] == 0) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return VertexPosition::TOP_RIGHT_EDGE_3D; // bf
+        else if(p[2] == 0)
+          return VertexPosition::TOP_RIGHT_FRONT_CORNER_3D; // b
+        else
+          return VertexPosition::TOP_RIGHT_BACK_CORNER_3D; // f
+      } else {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return VertexPosition::BOTTOM_RIGHT_EDGE_3D; // dh
+        else if(p[2] == 0)
+          return VertexPosition::BOTTOM_RIGHT_FRONT_CORNER_3D; // d
+        else
+          return VertexPosition::BOTTOM_RIGHT_BACK_CORNER_3D; // h
+      }
+    }
+
+  } else if(dimensionality_ == 2) {
+    vertexToPosition2d(v, p);
+
+    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
+      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
+        return VertexPosition::CENTER_2D;
+      else if(p[1] == 0)
+        return VertexPosition::TOP_EDGE_2D; // ab
+      else
+        return VertexPosition::BOTTOM_EDGE_2D; // cd
+    } else if(p[0] == 0) {
+      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
+        return VertexPosition::LEFT_EDGE_2D; // ac
+      else if(p[1] == 0)
+        return VertexPosition::TOP_LEFT_CORNER_2D; // a
+      else
+        return VertexPosition::BOTTOM_LEFT_CORNER_2D; // c
+    } else {
+      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
+        return VertexPosition::RIGHT_EDGE_2D; // bd
+      else if(p[1] == 0)
+        return VertexPosition::TOP_RIGHT_CORNER_2D; // b
+      else
+        return VertexPosition::BOTTOM_RIGHT_CORNER_2D; // d
+    }
+  }
+
+  // 1D
+  if(v == vertexNumber_ - 1)
+    return VertexPosition::RIGHT_CORNER_1D;
+  else if(v == 0)
+    return VertexPosition::LEFT_CORNER_1D;
+  return VertexPosition::CENTER_1D;
+}
+
+inline ttk::ImplicitTriangulation::EdgePosition
+  ttk::ImplicitTriangulation::computeEdgePosition(const SimplexId e,
+                                                  SimplexId p[3]) const {
+
+  if(dimensionality_ == 3) {
+    if(e < esetshift_[0]) {
+      edgeToPosition(e, 0, p);
+      if(p[1] > 0 and p[1] < nbvoxels_[1]) {
+        if(p[2] > 0 and p[2] < nbvoxels_[2])
+          return EdgePosition::L_xnn_3D;
+        else if(p[2] == 0)
+          return EdgePosition::L_xn0_3D;
+        else
+          return EdgePosition::L_xnN_3D;
+      } else if(p[1] == 0) {
+        if(p[2] > 0 and p[2] < nbvoxels_[2])
+          return EdgePosition::L_x0n_3D;
+        else if(p[2] == 0)
+          return EdgePosition::L_x00_3D;
+        else
+          return EdgePosition::L_x0N_3D;
+      } else {
+        if(p[2] > 0 and p[2] < nbvoxels_[2])
+          return EdgePosition::L_xNn_3D;
+        else if(p[2] == 0)
+          return EdgePosition::L_xN0_3D;
+        else
+          return EdgePosition::L_xNN_3D;
+      }
+
+    } else if(e < esetshift_[1]) {
+      edgeToPosition(e, 1, p);
+      if(p[0] > 0 and p[0] < nbvoxels_[0]) {
+        if(p[2] > 0 and p[2] < nbvoxels_[2])
+          return EdgePosition::H_nyn_3D;
+        else if(p[2] == 0)
+          return EdgePosition::H_ny0_3D;
+        else
+          return EdgePosition::H_nyN_3D;
+      } else if(p[0] == 0) {
+        if(p[2] > 0 and p[2] < nbvoxels_[2])
+          return EdgePosition::H_0yn_3D;
+        else if(p[2] == 0)
+          return EdgePosition::H_0y0_3D;
+        else
+          return EdgePosition::H_0yN_3D;
+      } else {
+        if(p[2] > 0 and p[2] < nbvoxels_[2])
+          return EdgePosition::H_Nyn_3D;
+        else if(p[2] == 0)
+          return EdgePosition::H_Ny0_3D;
+        else
+          return EdgePosition::H_NyN_3D;
+      }
+
+    } else if(e < esetshift_[2]) {
+      edgeToPosition(e, 2, p);
+      if(p[0] > 0 and p[0] < nbvoxels_[0]) {
+        if(p[1] > 0 and p[1] < nbvoxels_[1])
+          return EdgePosition::P_nnz_3D;
+        else if(p[1] == 0)
+          return EdgePosition::P_n0z_3D;
+        else
+          return EdgePosition::P_nNz_3D;
+      } else if(p[0] == 0) {
+        if(p[1] > 0 and p[1] < nbvoxels_[1])
+          return EdgePosition::P_0nz_3D;
+        else if(p[1] == 0)
+          return EdgePosition::P_00z_3D;
+        else
+          return EdgePosition::P_0Nz_3D;
+      } else {
+        if(p[1] > 0 and p[1] < nbvoxels_[1])
+          return EdgePosition::P_Nnz_3D;
+        else if(p[1] == 0)
+          return EdgePosition::P_N0z_3D;
+        else
+          return EdgePosition::P_NNz_3D;
+      }
+
+    } else if(e < esetshift_[3]) {
+      edgeToPosition(e, 3, p);
+      if(p[2] > 0 and p[2] < nbvoxels_[2])
+        return EdgePosition::D1_xyn_3D;
+      else if(p[2] == 0)
+        return EdgePosition::D1_xy0_3D;
+      else
+        return EdgePosition::D1_xyN_3D;
+
+    } else if(e < esetshift_[4]) {
+      edgeToPosition(e, 4, p);
+      if(p[0] > 0 and p[0] < nbvoxels_[0])
+        return EdgePosition::D2_nyz_3D;
+      else if(p[0] == 0)
+        return EdgePosition::D2_0yz_3D;
+      else
+        return EdgePosition::D2_Nyz_3D;
+
+    } else if(e < esetshift_[5]) {
+      edgeToPosition(e, 5, p);
+      if(p[1] > 0 and p[1] < nbvoxels_[1])
+        return EdgePosition::D3_xnz_3D;
+      else if(p[1] == 0)
+        return EdgePosition::D3_x0z_3D;
+      else
+        return EdgePosition::D3_xNz_3D;
+    }
+
+    edgeToPosition(e, 6, p);
+    return EdgePosition::D4_3D;
+
+  } else if(dimensionality_ == 2) {
+    if(e < esetshift_[0]) {
+      edgeToPosition2d(e, 0, p);
+      if(p[1] > 0 and p[1] < nbvoxels_[Dj_])
+        return EdgePosition::L_xn_2D;
+      else if(p[1] == 0)
+        return EdgePosition::L_x0_2D;
+      else
+        return EdgePosition::L_xN_2D;
+
+    } else if(e < esetshift_[1]) {
+      edgeToPosition2d(e, 1, p);
+      if(p[0] > 0 and p[0] < nbvoxels_[Di_])
+        return EdgePosition::H_ny_2D;
+      else if(p[0] == 0)
+        return EdgePosition::H_0y_2D;
+      else
+        return EdgePosition::H_Ny_2D;
+    }
+
+    edgeToPosition2d(e, 2, p);
+    return EdgePosition::D1_2D;
+  }
+
+  // 1D
+  if(e == edgeNumber_ - 1)
+    return EdgePosition::LAST_EDGE_1D;
+  else if(e == 0)
+    return EdgePosition::FIRST_EDGE_1D;
+  return EdgePosition::CENTER_1D;
+}
+
+inline ttk::ImplicitTriangulation::TrianglePosition
+  ttk::ImplicitTriangulation::computeTrianglePosition(const SimplexId t,
+                                                      SimplexId p[3]) const {
+
+  if(dimensionality_ == 3) {
+    if(t < tsetshift_[0]) {
+      triangleToPosition(t, 0, p);
+      return TrianglePosition::F_3D;
+    } else if(t < tsetshift_[1]) {
+      triangleToPosition(t, 1, p);
+      return TrianglePosition::H_3D;
+    } else if(t < tsetshift_[2]) {
+      triangleToPosition(t, 2, p);
+      return TrianglePosition::C_3D;
+    } else if(t < tsetshift_[3]) {
+      triangleToPosition(t, 3, p);
+      return TrianglePosition::D1_3D;
+    } else if(t < tsetshift_[4]) {
+      triangleToPosition(t, 4, p);
+      return TrianglePosition::D2_3D;
+    }
+    triangleToPosition(t, 5, p);
+    return TrianglePosition::D3_3D;
+  }
+
+  triangleToPosition2d(t, p);
+  if(t % 2 == 0) {
+    return TrianglePosition::TOP_2D;
+  }
+  return TrianglePosition::BOTTOM_2D;
+}
+
+inline const ttk::ImplicitTriangulation::CachedPosition &
+  ttk::ImplicitTriangulation::getCachedVertexPosition(
+    const SimplexId v) const {
+  static thread_local CachedPosition cache{};
+  if(cache.id != v || cache.gridId != gridId_) {
+    cache.gridId = gridId_;
+    cache.id = v;
+    cache.coords = {};
+    cache.position
+      = static_cast<int>(computeVertexPosition(v, cache.coords.data()));
+  }
+  return cache;
+}
+
+inline const ttk::ImplicitTriangulation::CachedPosition &
+  ttk::ImplicitTriangulation::getCachedEdgePosition(const SimplexId e) const {
+  static thread_local CachedPosition cache{};
+  if(cache.id != e || cache.gridId != gridId_) {
+    cache.gridId = gridId_;
+    cache.id = e;
+    cache.coords = {};
+    cache.position
+      = static_cast<int>(computeEdgePosition(e, cache.coords.data()));
+  }
+  return cache;
+}
+
+inline const ttk::ImplicitTriangulation::CachedPosition &
+  ttk::ImplicitTriangulation::getCachedTrianglePosition(
+    const SimplexId t) const {
+  static thread_local CachedPosition cache{};
+  if(cache.id != t || cache.gridId != gridId_) {
+    cache.gridId = gridId_;
+    cache.id = t;
+    cache.coords = {};
+    cache.position
+      = static_cast<int>(computeTrianglePosition(t, cache.coords.data()));
+  }
+  return cache;
+}
+
+inline ttk::ImplicitTriangulation::VertexPosition
+  ttk::ImplicitTriangulation::getVertexPosition(const SimplexId v) const {
+  if(!compactPositions_) {
+    return vertexPositions_[v];
+  }
+  return static_cast<VertexPosition>(getCachedVertexPosition(v).position);
+}
+
+inline std::array<ttk::SimplexId, 3>
+  ttk::ImplicitTriangulation::getVertexCoords(const SimplexId v) const {
+  if(!compactPositions_) {
+    return vertexCoords_[v];
+  }
+  return getCachedVertexPosition(v).coords;
+}
+
+inline ttk::ImplicitTriangulation::EdgePosition
+  ttk::ImplicitTriangulation::getEdgePosition(const SimplexId e) const {
+  if(!compactPositions_) {
+    return edgePositions_[e];
+  }
+  return static_cast<EdgePosition>(getCachedEdgePosition(e).position);
+}
+
+inline std::array<ttk::SimplexId, 3>
+  ttk::ImplicitTriangulation::getEdgeCoords(const SimplexId e) const {
+  if(!compactPositions_) {
+    return edgeCoords_[e];
+  }
+  return getCachedEdgePosition(e).coords;
+}
+
+inline ttk::ImplicitTriangulation::TrianglePosition
+  ttk::ImplicitTriangulation::getTrianglePosition(const SimplexId t) const {
+  if(!compactPositions_) {
+    return trianglePositions_[t];
+  }
+  return static_cast<TrianglePosition>(getCachedTrianglePosition(t).position);
+}
+
+inline std::array<ttk::SimplexId, 3>
+  ttk::ImplicitTriangulation::getTriangleCoords(const SimplexId t) const {
+  if(!compactPositions_) {
+    return triangleCoords_[t];
+  }
+  return getCachedTrianglePosition(t).coords;
+}
+
+inline std::array<ttk::SimplexId, 3>
+  ttk::ImplicitTriangulation::getTetrahedronCoords(const SimplexId t) const {
+  if(!compactPositions_) {
+    return tetrahedronCoords_[t];
+  }
+  std::array<SimplexId, 3> p{};
+  tetrahedronToPosition(t, p.data());
+  return p;
+}
+
 inline ttk::SimplexId
   ttk::ImplicitTriangulation::getVertexEdgeA(const SimplexId p[3],
                                              const int id) const {
@@ -20,6 +20,7 @@
 #include <Wrapper.h>
 
 // std includes
+#include <limits>
 #include <unordered_set>
 
 namespace ttk {
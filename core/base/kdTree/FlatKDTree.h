@@ -0,0 +1,419 @@
+/// \ingroup base
+/// \class ttk::FlatKDTree
+/// \date October 2026.
+///
+/// \brief TTK array-based KD-Tree.
+///
+/// This class builds the same tree as ttk::KDTree (median split along
+/// cycling axes) but stores it in a handful of contiguous arrays instead of
+/// one heap-allocated object per node.
+///
+/// Nodes are laid out in pre-order: the left child of a node immediately
+/// follows it and its right child follows its left subtree, so that no
+/// child pointer is stored (see getLeftChild() and getRightChild()).
+/// Coordinates and bounding boxes are stored axis by axis, weights weight
+/// index by weight index.
+///
+/// Points are referred to by their identifier (their position in the input
+/// array), both in the results of getKClosest() and to update their weights
+/// in place with updateWeight().
+///
+/// When looking for the closest points, the subtree on the side of the
+/// query point is visited first, which tightens the pruning bound much
+/// earlier than ttk::KDTree (always left first). The costs found are the
+/// same; only the choice between points of exactly equal cost may differ.
+///
+/// \sa ttk::KDTree
+/// \sa ttk::Auction
+
+#pragma once
+
+// base code includes
+#include <Debug.h>
+#include <Geometry.h> // for pow
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace ttk {
+
+  template <typename dataType>
+  class FlatKDTree : public Debug {
+
+  public:
+    FlatKDTree() = default;
+    explicit FlatKDTree(const int p) : p_{p} {
+    }
+
+    /**
+     * @brief Build the tree with null weights
+     *
+     * @param[in] coordinates Point coordinates (interleaved)
+     * @param[in] ptNumber Number of points
+     * @param[in] dimension Number of coordinates per point
+     * @param[in] weightNumber Number of weights per point
+     */
+    void build(const dataType *const coordinates,
+               const int ptNumber,
+               const int dimension,
+               const int weightNumber = 1);
+
+    /**
+     * @brief Build the tree with initial weights
+     *
+     * @param[in] coordinates Point coordinates (interleaved)
+     * @param[in] ptNumber Number of points
+     * @param[in] dimension Number of coordinates per point
+     * @param[in] weights For each weight index, the weight of each point
+     * @param[in] weightNumber Number of weights per point
+     */
+    void build(const dataType *const coordinates,
+               const int ptNumber,
+               const int dimension,
+               const std::vector<std::vector<dataType>> &weights,
+               const int weightNumber = 1);
+
+    /**
+     * @brief Find the k points of minimal cost (distance to the query point
+     * plus weight)
+     *
+     * The output is not sorted.
+     *
+     * @param[in] k Number of points
+     * @param[in] coordinates Query point coordinates
+     * @param[out] neighbours Identifiers of the closest points
+     * @param[out] costs Costs of the closest points
+     * @param[in] weightIndex Weight index
+     */
+    void getKClosest(const unsigned int k,
+                     const dataType *const coordinates,
+                     std::vector<int> &neighbours,
+                     std::vector<dataType> &costs,
+                     const int weightIndex = 0) const;
+
+    /**
+     * @brief Update the weight of a point (and the minimum weights of the
+     * subtrees containing it)
+     */
+    void updateWeight(const int pointId,
+                      const dataType weight,
+                      const int weightIndex = 0);
+
+    inline dataType getWeight(const int pointId,
+                              const int weightIndex = 0) const {
+      return weights_[weightIndex * nodeNumber_ + nodes_[pointId]];
+    }
+
+    inline dataType getMinSubWeight(const int pointId,
+                                    const int weightIndex = 0) const {
+      return minSubWeights_[weightIndex * nodeNumber_ + nodes_[pointId]];
+    }
+
+    inline int size() const {
+      return nodeNumber_;
+    }
+
+    inline int getDimension() const {
+      return dimension_;
+    }
+
+  protected:
+    void allocate(const int ptNumber,
+                  const int dimension,
+                  const int weightNumber);
+    void buildRecursive(const dataType *const coordinates,
+                        std::vector<int>::iterator begin,
+                        std::vector<int>::iterator end,
+                        const int node,
+                        const int parent,
+                        const int axis,
+                        const bool isLeft);
+    void recursiveGetKClosest(const int node,
+                              const int axis,
+                              const unsigned int k,
+                              const dataType *const coordinates,
+                              std::vector<int> &neighbours,
+                              std::vector<dataType> &costs,
+                              const int weightIndex) const;
+    void updateMinSubWeight(int node, const int weightIndex);
+
+    inline int getLeftChild(const int node) const {
+      return sizes_[node] > 2 ? node + 1 : -1;
+    }
+
+    inline int getRightChild(const int node) const {
+      return sizes_[node] > 1 ? node + 1 + (sizes_[node] - 1) / 2 : -1;
+    }
+
+    inline dataType cost(const int node,
+                         const dataType *const coordinates) const {
+      dataType res = 0;
+      for(int axis = 0; axis < dimension_; axis++) {
+        const dataType d
+          = coordinates[axis] - coordinates_[axis * nodeNumber_ + node];
+        res += Geometry::pow(d > 0 ? d : -d, p_);
+      }
+      return res;
+    }
+
+    inline dataType distanceToBox(const int node,
+                                  const dataType *const coordinates) const {
+      dataType d_min = 0;
+      for(int axis = 0; axis < dimension_; axis++) {
+        const dataType boxMin = boxMin_[axis * nodeNumber_ + node];
+        const dataType boxMax = boxMax_[axis * nodeNumber_ + node];
+        if(boxMin > coordinates[axis]) {
+          d_min += Geometry::pow(boxMin - coordinates[axis], p_);
+        } else if(boxMax < coordinates[axis]) {
+          d_min += Geometry::pow(coordinates[axis] - boxMax, p_);
+        }
+      }
+      return d_min;
+    }
+
+    // Power used for the computation of distances
+    int p_{2};
+    int dimension_{};
+    int nodeNumber_{};
+    int weightNumber_{};
+
+    // point identifier of each node
+    std::vector<int> ids_{};
+    // node of each point identifier
+    std::vector<int> nodes_{};
+    std::vector<int> parents_{};
+    // number of nodes in the subtree of each node
+    std::vector<int> sizes_{};
+    // [axis * nodeNumber_ + node]
+    std::vector<dataType> coordinates_{};
+    std::vector<dataType> boxMin_{};
+    std::vector<dataType> boxMax_{};
+    // [weightIndex * nodeNumber_ + node]
+    std::vector<dataType> weights_{};
+    std::vector<dataType> minSubWeights_{};
+  };
+
+  template <typename dataType>
+  void FlatKDTree<dataType>::allocate(const int ptNumber,
+                                      const int dimension,
+                                      const int weightNumber) {
+    dimension_ = dimension;
+    nodeNumber_ = ptNumber;
+    weightNumber_ = weightNumber;
+
+    ids_.resize(ptNumber);
+    nodes_.resize(ptNumber);
+    parents_.resize(ptNumber);
+    sizes_.resize(ptNumber);
+    coordinates_.resize(dimension * ptNumber);
+    boxMin_.resize(dimension * ptNumber);
+    boxMax_.resize(dimension * ptNumber);
+    weights_.assign(weightNumber * ptNumber, 0);
+    minSubWeights_.assign(weightNumber * ptNumber, 0);
+  }
+
+  template <typename dataType>
+  void FlatKDTree<dataType>::build(const dataType *const coordinates,
+                                   const int ptNumber,
+                                   const int dimension,
+                                   const int weightNumber) {
+    allocate(ptNumber, dimension, weightNumber);
+    if(ptNumber == 0) {
+      return;
+    }
+
+    std::vector<int> idx(ptNumber);
+    for(int i = 0; i < ptNumber; i++) {
+      idx[i] = i;
+    }
+    buildRecursive(coordinates, idx.begin(), idx.end(), 0, -1, 0, false);
+  }
+
+  template <typename dataType>
+  void FlatKDTree<dataType>::build(
+    const dataType *const coordinates,
+    const int ptNumber,
+    const int dimension,
+    const std::vector<std::vector<dataType>> &weights,
+    const int weightNumber) {
+    this->build(coordinates, ptNumber, dimension, weightNumber);
+
+    for(int w = 0; w < weightNumber; w++) {
+      dataType *const weight = &weights_[w * nodeNumber_];
+      dataType *const minSubWeight = &minSubWeights_[w * nodeNumber_];
+      for(int node = 0; node < nodeNumber_; node++) {
+        weight[node] = weights[w][ids_[node]];
+      }
+      // children are stored after their parent
+      for(int node = nodeNumber_ - 1; node >= 0; node--) {
+        minSubWeight[node] = weight[node];
+        const int left = getLeftChild(node);
+        const int right = getRightChild(node);
+        if(left != -1) {
+          minSubWeight[node]
+            = std::min(minSubWeight[node], minSubWeight[left]);
+        }
+        if(right != -1) {
+          minSubWeight[node]
+            = std::min(minSubWeight[node], minSubWeight[right]);
+        }
+      }
+    }
+  }
+
+  template <typename dataType>
+  void FlatKDTree<dataType>::buildRecursive(const dataType *const data,
+                                            std::vector<int>::iterator begin,
+                                            std::vector<int>::iterator end,
+                                            const int node,
+                                            const int parent,
+                                            const int axis,
+                                            const bool isLeft) {
+    const int size = end - begin;
+
+    // same argsort as ttk::KDTree, for the same median on ties
+    std::sort(begin, end, [&](int i1, int i2) {
+      return data[dimension_ * i1 + axis] < data[dimension_ * i2 + axis];
+    });
+    const int median_loc = (size - 1) / 2;
+    const int median_idx = *(begin + median_loc);
+
+    ids_[node] = median_idx;
+    nodes_[median_idx] = node;
+    parents_[node] = parent;
+    sizes_[node] = size;
+    for(int a = 0; a < dimension_; a++) {
+      coordinates_[a * nodeNumber_ + node] = data[dimension_ * median_idx + a];
+    }
+
+    // bounding box: the box of the parent, cut by its splitting plane
+    for(int a = 0; a < dimension_; a++) {
+      const size_t i = a * nodeNumber_ + node;
+      if(parent == -1) {
+        boxMin_[i] = std::numeric_limits<dataType>::lowest();
+        boxMax_[i] = std::numeric_limits<dataType>::max();
+      } else {
+        boxMin_[i] = boxMin_[a * nodeNumber_ + parent];
+        boxMax_[i] = boxMax_[a * nodeNumber_ + parent];
+      }
+    }
+    if(parent != -1) {
+      const int parentAxis = (axis + dimension_ - 1) % dimension_;
+      const size_t i = parentAxis * nodeNumber_;
+      if(isLeft) {
+        boxMax_[i + node] = coordinates_[i + parent];
+      } else {
+        boxMin_[i + node] = coordinates_[i + parent];
+      }
+    }
+
+    const int nextAxis = (axis + 1) % dimension_;
+    if(size > 2) {
+      buildRecursive(
+        data, begin, begin + median_loc, node + 1, node, nextAxis, true);
+    }
+    if(size > 1) {
+      buildRecursive(data, begin + median_loc + 1, end,
+                     node + 1 + median_loc, node, nextAxis, false);
+    }
+  }
+
+  template <typename dataType>
+  void FlatKDTree<dataType>::getKClosest(const unsigned int k,
+                                         const dataType *const coordinates,
+                                         std::vector<int> &neighbours,
+                                         std::vector<dataType> &costs,
+                                         const int weightIndex) const {
+    if(nodeNumber_ == 0) {
+      return;
+    }
+    this->recursiveGetKClosest(
+      0, 0, k, coordinates, neighbours, costs, weightIndex);
+  }
+
+  template <typename dataType>
+  void FlatKDTree<dataType>::recursiveGetKClosest(
+    const int node,
+    const int axis,
+    const unsigned int k,
+    const dataType *const coordinates,
+    std::vector<int> &neighbours,
+    std::vector<dataType> &costs,
+    const int weightIndex) const {
+
+    const dataType *const minSubWeight
+      = &minSubWeights_[weightIndex * nodeNumber_];
+
+    // 1- Look whether or not to include the current point in the nearest
+    // neighbours
+    const dataType cost = this->cost(node, coordinates)
+                          + weights_[weightIndex * nodeNumber_ + node];
+
+    if(costs.size() < k) {
+      neighbours.push_back(ids_[node]);
+      costs.push_back(cost);
+    } else {
+      // replace the most costly neighbour (the first one on ties)
+      const auto maxCost = std::max_element(costs.begin(), costs.end());
+      if(cost < *maxCost) {
+        neighbours[maxCost - costs.begin()] = ids_[node];
+        *maxCost = cost;
+      }
+    }
+
+    // 2- Recursively visit the subtrees that are worth it, starting with
+    // the one on the side of the query point to lower the bound early
+    int first = getLeftChild(node);
+    int second = getRightChild(node);
+    if(coordinates[axis] >= coordinates_[axis * nodeNumber_ + node]) {
+      std::swap(first, second);
+    }
+    const int nextAxis = (axis + 1) % dimension_;
+    for(const int child : {first, second}) {
+      if(child == -1) {
+        continue;
+      }
+      const dataType maxCost = *std::max_element(costs.begin(), costs.end());
+      const dataType d_min = this->distanceToBox(child, coordinates);
+      if(costs.size() < k || d_min + minSubWeight[child] < maxCost) {
+        this->recursiveGetKClosest(
+          child, nextAxis, k, coordinates, neighbours, costs, weightIndex);
+      }
+    }
+  }
+
+  template <typename dataType>
+  void FlatKDTree<dataType>::updateWeight(const int pointId,
+                                          const dataType weight,
+                                          const int weightIndex) {
+    const int node = nodes_[pointId];
+    weights_[weightIndex * nodeNumber_ + node] = weight;
+    updateMinSubWeight(node, weightIndex);
+  }
+
+  template <typename dataType>
+  void FlatKDTree<dataType>::updateMinSubWeight(int node,
+                                                const int weightIndex) {
+    const dataType *const weight = &weights_[weightIndex * nodeNumber_];
+    dataType *const minSubWeight = &minSubWeights_[weightIndex * nodeNumber_];
+
+    while(node != -1) {
+      dataType newMinSubWeight = weight[node];
+      const int left = getLeftChild(node);
+      const int right = getRightChild(node);
+      if(left != -1) {
+        newMinSubWeight = std::min(newMinSubWeight, minSubWeight[left]);
+      }
+      if(right != -1) {
+        newMinSubWeight = std::min(newMinSubWeight, minSubWeight[right]);
+      }
+      if(newMinSubWeight == minSubWeight[node]) {
+        break;
+      }
+      minSubWeight[node] = newMinSubWeight;
+      node = parents_[node];
+    }
+  }
+
+} // namespace ttk
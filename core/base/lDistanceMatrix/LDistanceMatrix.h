@@ -2,12 +2,25 @@
 /// \class ttk::LDistanceMatrix
 /// \author Pierre Guillou <pierre.guillou@lip6.fr>
 /// \date May 2020
+///
+/// \brief Distance matrix (Ln or Linf norm) between the scalar fields of an
+/// ensemble.
+///
+/// The matrix is computed by tiles: the vertices are split in blocks of
+/// VerticesPerTile vertices and the members in blocks of MembersPerTile
+/// members. For each pair of member blocks, a block of vertices of all the
+/// members of the pair is loaded once (and kept in cache) to compute the
+/// partial sums of all the member pairs of the tile, with vectorized inner
+/// loops. Tiles are processed in parallel, each thread accumulating its
+/// partial sums in its own buffer.
 
 #pragma once
 
-#include <LDistance.h>
+#include <Geometry.h>
 #include <Wrapper.h>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -20,12 +33,22 @@ namespace ttk {
       DistanceType = val;
     }
 
+    /// Returns the distance matrix (empty on error).
     template <typename T>
     std::vector<std::vector<double>> execute(const std::vector<void *> &inputs,
                                              const size_t nPoints) const;
 
+    /// Computes the distance matrix in a flat, row-major (and symmetric)
+    /// buffer of inputs.size() * inputs.size() entries.
+    template <typename T>
+    int computeDistanceMatrix(std::vector<double> &distMatrix,
+                              const std::vector<void *> &inputs,
+                              const size_t nPoints) const;
+
   protected:
     std::string DistanceType{};
+    size_t MembersPerTile{8};
+    size_t VerticesPerTile{4096};
   };
 } // namespace ttk
 
@@ -35,38 +58,151 @@ std::vector<std::vector<double>>
                                 const size_t nPoints) const {
 
   const auto nInputs = inputs.size();
-  std::vector<std::vector<double>> distMatrix(nInputs);
+  std::vector<double> flat{};
+  std::vector<std::vector<double>> distMatrix{};
 
-  LDistance worker{};
-  worker.setNumberOfPoints(nPoints);
-  worker.setThreadNumber(this->threadNumber_);
+  if(this->computeDistanceMatrix<T>(flat, inputs, nPoints) != 0)
+    return distMatrix;
 
-  // compute matrix upper triangle
-  // (some parallelism inside the LDistance computation)
-  for(size_t i = 0; i < nInputs; ++i) {
-    auto &distCol = distMatrix[i];
-    distCol.resize(nInputs);
-    // get pointer to scalar field of input i
-    worker.setInputDataPointer1(static_cast<T *>(inputs[i]));
-    for(size_t j = i + 1; j < nInputs; ++j) {
-      // get pointer to scalar field of input jc
-      worker.setInputDataPointer2(static_cast<T *>(inputs[j]));
-      // call execute
-      worker.execute<T>(this->DistanceType);
-      // store result
-      distMatrix[i][j] = worker.getResult();
+  distMatrix.resize(nInputs);
+  for(size_t i = 0; i < nInputs; ++i)
+    distMatrix[i].assign(
+      flat.begin() + i * nInputs, flat.begin() + (i + 1) * nInputs);
+
+  return distMatrix;
+}
+
+template <typename T>
+int ttk::LDistanceMatrix::computeDistanceMatrix(
+  std::vector<double> &distMatrix,
+  const std::vector<void *> &inputs,
+  const size_t nPoints) const {
+
+  const size_t nInputs = inputs.size();
+  distMatrix.assign(nInputs * nInputs, 0.0);
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  for(const auto input : inputs) {
+    if(input == nullptr) {
+      this->printErr("Null input scalar field");
+      return -1;
+    }
+  }
+#endif // TTK_ENABLE_KAMIKAZE
+
+  const bool isInf = this->DistanceType == "inf";
+  const int n = isInf ? 0 : std::stoi(this->DistanceType);
+  if(!isInf && n < 1) {
+    this->printErr("Invalid distance type " + this->DistanceType);
+    return -4;
+  }
+
+  if(nInputs < 2 || nPoints == 0)
+    return 0;
+
+  // upper triangle of the pairs of member blocks
+  const size_t tileMembers = std::max<size_t>(this->MembersPerTile, 1);
+  const size_t tileVertices = std::max<size_t>(this->VerticesPerTile, 1);
+  const size_t nMemberBlocks = (nInputs + tileMembers - 1) / tileMembers;
+  const size_t nVertexBlocks = (nPoints + tileVertices - 1) / tileVertices;
+  std::vector<std::pair<size_t, size_t>> blockPairs{};
+  for(size_t bi = 0; bi < nMemberBlocks; ++bi)
+    for(size_t bj = bi; bj < nMemberBlocks; ++bj)
+      blockPairs.emplace_back(bi, bj);
+  const size_t nTiles = blockPairs.size() * nVertexBlocks;
+
+  // partial sum (or max) of a pair of members on a block of vertices
+  const auto partial = [isInf, n](const T *const a, const T *const b,
+                                  const size_t size) {
+    double res = 0.0;
+    if(isInf) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd reduction(max : res)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t k = 0; k < size; ++k) {
+        const double diff = std::abs(static_cast<double>(a[k])
+                                     - static_cast<double>(b[k]));
+        res = std::max(res, diff);
+      }
+    } else if(n == 1) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd reduction(+ : res)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t k = 0; k < size; ++k)
+        res += std::abs(static_cast<double>(a[k]) - static_cast<double>(b[k]));
+    } else if(n == 2) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd reduction(+ : res)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t k = 0; k < size; ++k) {
+        const double diff
+          = static_cast<double>(a[k]) - static_cast<double>(b[k]);
+        res += diff * diff;
+      }
+    } else {
+      for(size_t k = 0; k < size; ++k) {
+        const double diff = std::abs(static_cast<double>(a[k])
+                                     - static_cast<double>(b[k]));
+        res += Geometry::powInt(diff, n);
+      }
+    }
+    return res;
+  };
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  {
+    // per-thread partial sums (upper triangle)
+    std::vector<double> sums(nInputs * nInputs, 0.0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t t = 0; t < nTiles; ++t) {
+      // consecutive tiles share the same vertex block
+      const auto &bp = blockPairs[t % blockPairs.size()];
+      const size_t v0 = (t / blockPairs.size()) * tileVertices;
+      const size_t size = std::min(tileVertices, nPoints - v0);
+      const size_t iEnd = std::min((bp.first + 1) * tileMembers, nInputs);
+      const size_t jEnd = std::min((bp.second + 1) * tileMembers, nInputs);
+
+      for(size_t i = bp.first * tileMembers; i < iEnd; ++i) {
+        const T *const a = static_cast<const T *>(inputs[i]) + v0;
+        const size_t jBegin = std::max(bp.second * tileMembers, i + 1);
+        for(size_t j = jBegin; j < jEnd; ++j) {
+          const T *const b = static_cast<const T *>(inputs[j]) + v0;
+          const double res = partial(a, b, size);
+          double &sum = sums[i * nInputs + j];
+          sum = isInf ? std::max(sum, res) : sum + res;
+        }
+      }
+    }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp critical
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < nInputs; ++i) {
+      for(size_t j = i + 1; j < nInputs; ++j) {
+        double &dist = distMatrix[i * nInputs + j];
+        dist = isInf ? std::max(dist, sums[i * nInputs + j])
+                     : dist + sums[i * nInputs + j];
+      }
     }
   }
 
-  // distance matrix is symmetric
+  // norms, and the distance matrix is symmetric
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif // TTK_ENABLE_OPENMP
   for(size_t i = 0; i < nInputs; ++i) {
     for(size_t j = i + 1; j < nInputs; ++j) {
-      distMatrix[j][i] = distMatrix[i][j];
+      double &dist = distMatrix[i * nInputs + j];
+      if(!isInf && n > 1)
+        dist = std::pow(dist, 1.0 / n);
+      distMatrix[j * nInputs + i] = dist;
     }
   }
 
-  return distMatrix;
+  return 0;
 }
@@ -318,6 +318,16 @@ namespace ttk {
       return 0;
     }
 
+    inline int setInputVertexOrder(const SimplexId *const order) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!abstractMorseSmaleComplex_) {
+        return -1;
+      }
+#endif
+      abstractMorseSmaleComplex_->setInputVertexOrder(order);
+      return 0;
+    }
+
     inline int setOutputCriticalPoints(
       SimplexId *const criticalPoints_numberOfPoints,
       std::vector<float> *const criticalPoints_points,
@@ -64,6 +64,7 @@ int ttk::MorseSmaleComplex2D::execute() {
     return -1;
   }
 #endif
+  const debug::TraceSpan span("MorseSmaleComplex2D", "execute");
   Timer t;
 
   // nullptr_t is implicitly convertible and comparable to any pointer type
@@ -623,6 +623,7 @@ int ttk::MorseSmaleComplex3D::execute() {
     return -1;
   }
 #endif
+  const debug::TraceSpan span("MorseSmaleComplex3D", "execute");
   Timer t;
 
   // nullptr_t is implicitly convertible and comparable to any pointer type
@@ -637,6 +638,8 @@ int ttk::MorseSmaleComplex3D::execute() {
   discreteGradient_.setThreadNumber(threadNumber_);
   discreteGradient_.setDebugLevel(debugLevel_);
   {
+    const debug::TraceSpan gradientSpan(
+      "MorseSmaleComplex3D", "discreteGradient");
     Timer tmp;
     discreteGradient_.buildGradient<dataType, idType>();
 
@@ -660,6 +663,8 @@ int ttk::MorseSmaleComplex3D::execute() {
 
   // 1-separatrices
   if(ComputeDescendingSeparatrices1) {
+    const debug::TraceSpan phaseSpan(
+      "MorseSmaleComplex3D", "descendingSeparatrices1");
     Timer tmp;
     separatrices1.emplace_back();
     separatricesGeometry1.emplace_back();
@@ -676,6 +681,8 @@ int ttk::MorseSmaleComplex3D::execute() {
   }
 
   if(ComputeAscendingSeparatrices1) {
+    const debug::TraceSpan phaseSpan(
+      "MorseSmaleComplex3D", "ascendingSeparatrices1");
     Timer tmp;
     separatrices1.emplace_back();
     separatricesGeometry1.emplace_back();
@@ -693,6 +700,7 @@ int ttk::MorseSmaleComplex3D::execute() {
 
   // saddle-connectors
   if(ComputeSaddleConnectors) {
+    const debug::TraceSpan phaseSpan("MorseSmaleComplex3D", "saddleConnectors");
     Timer tmp;
     separatrices1.emplace_back();
     separatricesGeometry1.emplace_back();
@@ -710,6 +718,7 @@ int ttk::MorseSmaleComplex3D::execute() {
 
   if(ComputeDescendingSeparatrices1 || ComputeAscendingSeparatrices1
      || ComputeSaddleConnectors) {
+    const debug::TraceSpan phaseSpan("MorseSmaleComplex3D", "setSeparatrices1");
     Timer tmp{};
 
     flattenSeparatricesVectors(separatrices1, separatricesGeometry1);
@@ -725,6 +734,8 @@ int ttk::MorseSmaleComplex3D::execute() {
 
   // 2-separatrices
   if(ComputeDescendingSeparatrices2) {
+    const debug::TraceSpan phaseSpan(
+      "MorseSmaleComplex3D", "descendingSeparatrices2");
     Timer tmp;
     std::vector<Separatrix> separatrices;
     std::vector<std::vector<dcg::Cell>> separatricesGeometry;
@@ -743,6 +754,8 @@ int ttk::MorseSmaleComplex3D::execute() {
   }
 
   if(ComputeAscendingSeparatrices2) {
+    const debug::TraceSpan phaseSpan(
+      "MorseSmaleComplex3D", "ascendingSeparatrices2");
     Timer tmp;
     std::vector<Separatrix> separatrices;
     std::vector<std::vector<dcg::Cell>> separatricesGeometry;
@@ -762,6 +775,7 @@ int ttk::MorseSmaleComplex3D::execute() {
 
   std::vector<SimplexId> maxSeeds;
   {
+    const debug::TraceSpan phaseSpan("MorseSmaleComplex3D", "segmentation");
     Timer tmp;
 
     SimplexId numberOfMaxima{};
@@ -819,6 +833,8 @@ int ttk::MorseSmaleComplex3D::computePersistencePairs(
 
   const dataType *scalars = static_cast<const dataType *>(inputScalarField_);
 
+  const debug::TraceSpan span("MorseSmaleComplex3D", "persistencePairs");
+
   std::vector<std::array<dcg::Cell, 2>> dmt_pairs;
   {
     // simplify to be PL-conformant
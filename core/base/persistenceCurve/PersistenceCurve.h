@@ -71,6 +71,11 @@ namespace ttk {
       return 0;
     }
 
+    inline int setInputVertexOrder(const SimplexId *const order) {
+      inputVertexOrder_ = order;
+      return 0;
+    }
+
     inline int setOutputJTPlot(void *data) {
       JTPlot_ = data;
       return 0;
@@ -97,6 +102,7 @@ namespace ttk {
     Triangulation *triangulation_;
     void *inputScalars_;
     void *inputOffsets_;
+    const SimplexId *inputVertexOrder_{};
     void *JTPlot_;
     void *MSCPlot_;
     void *STPlot_;
@@ -148,6 +154,7 @@ int ttk::PersistenceCurve::execute() const {
   contourTree.setVertexScalars(inputScalars_);
   contourTree.setTreeType(ftm::TreeType::Join_Split);
   contourTree.setVertexSoSoffsets(voffsets.data());
+  contourTree.setVertexOrder(inputVertexOrder_);
   contourTree.setSegmentation(false);
   contourTree.setThreadNumber(threadNumber_);
   contourTree.build<scalarType, idType>();
@@ -182,6 +189,7 @@ int ttk::PersistenceCurve::execute() const {
     morseSmaleComplex.setupTriangulation(triangulation_);
     morseSmaleComplex.setInputScalarField(inputScalars_);
     morseSmaleComplex.setInputOffsets(inputOffsets_);
+    morseSmaleComplex.setInputVertexOrder(inputVertexOrder_);
     morseSmaleComplex.computePersistencePairs<scalarType, idType>(
       pl_saddleSaddlePairs);
 
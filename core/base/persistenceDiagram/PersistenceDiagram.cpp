@@ -6,7 +6,7 @@ using namespace ttk;
 using namespace ftm;
 
 PersistenceDiagram::PersistenceDiagram()
-  : ComputeSaddleConnectors{},
+  : ComputeSaddleConnectors{}, FusedPipeline{}, PairsOnly{true},
 
     triangulation_{}, inputScalars_{}, CTDiagram_{} {
 }
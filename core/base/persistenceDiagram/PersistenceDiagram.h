@@ -20,6 +20,13 @@
 /// thresholds for topological simplification or for fast similarity
 /// estimations for instance.
 ///
+/// In the fused pipeline (see setFusedPipeline()), the vertex order is
+/// computed once and shared by all the diagram dimensions. With the pairs
+/// only option (see setPairsOnly()), the extremum-saddle pairs are then
+/// obtained with two union-find sweeps of this order (Elder rule) instead of
+/// the contour tree, whose arcs and segmentation are not needed for the
+/// diagram.
+///
 /// \b Related \b publication \n
 /// "Computational Topology: An Introduction" \n
 /// Herbert Edelsbrunner and John Harer \n
@@ -33,6 +40,7 @@
 // base code includes
 #include <FTMTreePP.h>
 #include <MorseSmaleComplex3D.h>
+#include <OrderDisambiguation.h>
 #include <Triangulation.h>
 #include <Wrapper.h>
 
@@ -53,6 +61,16 @@ namespace ttk {
       return 0;
     }
 
+    inline int setFusedPipeline(bool state) {
+      FusedPipeline = state;
+      return 0;
+    }
+
+    inline int setPairsOnly(bool state) {
+      PairsOnly = state;
+      return 0;
+    }
+
     ttk::CriticalType getNodeType(ftm::FTMTree_MT *tree,
                                   ftm::TreeType treeType,
                                   const SimplexId vertexId) const;
@@ -80,9 +98,23 @@ namespace ttk {
                              ttk::SimplexId>> &diagram,
       scalarType *scalars) const;
 
+    template <typename scalarType>
+    int computeMergePairs(
+      std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>>
+        &pairs,
+      const SimplexId *sortedVertices,
+      const SimplexId *vertexOrder,
+      const scalarType *scalars,
+      const bool jt,
+      std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>>
+        *essentialPairs = nullptr) const;
+
     template <class scalarType, typename idType>
     int execute() const;
 
+    template <class scalarType, typename idType>
+    int executeFused(const SimplexId *vertexOrder) const;
+
     inline int
       setDMTPairs(std::vector<std::tuple<dcg::Cell, dcg::Cell>> *data) {
       dmt_pairs = data;
@@ -110,6 +142,11 @@ namespace ttk {
       return 0;
     }
 
+    inline int setInputVertexOrder(const SimplexId *const order) {
+      inputVertexOrder_ = order;
+      return 0;
+    }
+
     inline int setOutputCTDiagram(void *data) {
       CTDiagram_ = data;
       return 0;
@@ -119,10 +156,13 @@ namespace ttk {
     std::vector<std::tuple<dcg::Cell, dcg::Cell>> *dmt_pairs;
 
     bool ComputeSaddleConnectors;
+    bool FusedPipeline;
+    bool PairsOnly;
 
     Triangulation *triangulation_;
     void *inputScalars_;
     void *inputOffsets_;
+    const SimplexId *inputVertexOrder_{};
     void *CTDiagram_;
   };
 } // namespace ttk
@@ -205,9 +245,114 @@ int ttk::PersistenceDiagram::computeCTPersistenceDiagram(
   return 0;
 }
 
+template <typename scalarType>
+int ttk::PersistenceDiagram::computeMergePairs(
+  std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>> &pairs,
+  const SimplexId *sortedVertices,
+  const SimplexId *vertexOrder,
+  const scalarType *scalars,
+  const bool jt,
+  std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>>
+    *essentialPairs) const {
+
+  // sweep of the vertices by increasing (join) or decreasing (split) order,
+  // the components of the sub-level (or super-level) sets being maintained
+  // with a union-find (path halving)
+  const SimplexId numberOfVertices = triangulation_->getNumberOfVertices();
+  std::vector<SimplexId> parent(numberOfVertices, -1);
+  // extremum and last visited vertex of each component (on its root)
+  std::vector<SimplexId> extremum(numberOfVertices, -1);
+  std::vector<SimplexId> last(numberOfVertices, -1);
+  std::vector<SimplexId> roots;
+
+  auto find = [&parent](SimplexId v) {
+    while(parent[v] != v) {
+      parent[v] = parent[parent[v]];
+      v = parent[v];
+    }
+    return v;
+  };
+  auto persistence = [scalars](const SimplexId a, const SimplexId b) {
+    return scalars[a] < scalars[b] ? scalars[b] - scalars[a]
+                                   : scalars[a] - scalars[b];
+  };
+
+  pairs.clear();
+
+  for(SimplexId i = 0; i < numberOfVertices; ++i) {
+    const SimplexId v
+      = jt ? sortedVertices[i] : sortedVertices[numberOfVertices - 1 - i];
+
+    // components of the already visited neighbors
+    roots.clear();
+    const SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(v);
+    for(SimplexId j = 0; j < neighborNumber; ++j) {
+      SimplexId n{-1};
+      triangulation_->getVertexNeighbor(v, j, n);
+      if(parent[n] == -1)
+        continue;
+      const SimplexId r = find(n);
+      if(std::find(roots.begin(), roots.end(), r) == roots.end())
+        roots.emplace_back(r);
+    }
+
+    if(roots.empty()) {
+      // local extremum: new component
+      parent[v] = v;
+      extremum[v] = v;
+      last[v] = v;
+      continue;
+    }
+
+    // Elder rule: the component of the oldest extremum survives
+    SimplexId survivor = roots[0];
+    for(const auto r : roots) {
+      if(jt ? vertexOrder[extremum[r]] < vertexOrder[extremum[survivor]]
+            : vertexOrder[extremum[r]] > vertexOrder[extremum[survivor]])
+        survivor = r;
+    }
+    for(const auto r : roots) {
+      if(r != survivor) {
+        pairs.emplace_back(extremum[r], v, persistence(extremum[r], v));
+        parent[r] = survivor;
+      }
+    }
+    parent[v] = survivor;
+    last[survivor] = v;
+  }
+
+  // the extremum of each remaining component dies with its last vertex
+  // (global extrema pair)
+  if(essentialPairs) {
+    essentialPairs->clear();
+    for(SimplexId v = 0; v < numberOfVertices; ++v) {
+      if(parent[v] == v)
+        essentialPairs->emplace_back(
+          extremum[v], last[v], persistence(extremum[v], last[v]));
+    }
+  }
+
+  return 0;
+}
+
 template <typename scalarType, typename idType>
 int ttk::PersistenceDiagram::execute() const {
 
+  // fused pipeline: the vertex order is computed once and shared by the
+  // contour tree (or the merge sweeps) and the discrete gradient
+  std::vector<SimplexId> localOrder;
+  const SimplexId *vertexOrder = inputVertexOrder_;
+  if(FusedPipeline and !vertexOrder) {
+    localOrder.resize(triangulation_->getNumberOfVertices());
+    preconditionOrderArray(localOrder.size(),
+                           static_cast<scalarType *>(inputScalars_),
+                           static_cast<SimplexId *>(inputOffsets_),
+                           localOrder.data(), threadNumber_);
+    vertexOrder = localOrder.data();
+  }
+  if(FusedPipeline and PairsOnly)
+    return executeFused<scalarType, idType>(vertexOrder);
+
   // get data
   std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
                          ttk::CriticalType, scalarType, ttk::SimplexId>>
@@ -229,6 +374,7 @@ int ttk::PersistenceDiagram::execute() const {
   contourTree.setVertexScalars(inputScalars_);
   contourTree.setTreeType(ftm::TreeType::Join_Split);
   contourTree.setVertexSoSoffsets(voffsets.data());
+  contourTree.setVertexOrder(vertexOrder);
   contourTree.setThreadNumber(threadNumber_);
   contourTree.setDebugLevel(debugLevel_);
   contourTree.setSegmentation(false);
@@ -280,6 +426,7 @@ int ttk::PersistenceDiagram::execute() const {
     morseSmaleComplex.setupTriangulation(triangulation_);
     morseSmaleComplex.setInputScalarField(inputScalars_);
     morseSmaleComplex.setInputOffsets(inputOffsets_);
+    morseSmaleComplex.setInputVertexOrder(vertexOrder);
     morseSmaleComplex.computePersistencePairs<scalarType, idType>(
       pl_saddleSaddlePairs);
   }
@@ -316,4 +463,103 @@ int ttk::PersistenceDiagram::execute() const {
   return 0;
 }
 
+template <typename scalarType, typename idType>
+int ttk::PersistenceDiagram::executeFused(const SimplexId *vertexOrder) const {
+
+  Timer t;
+
+  // get data
+  std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
+                         ttk::CriticalType, scalarType, ttk::SimplexId>>
+    &CTDiagram = *static_cast<
+      std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
+                             ttk::CriticalType, scalarType, ttk::SimplexId>> *>(
+      CTDiagram_);
+  scalarType *scalars = static_cast<scalarType *>(inputScalars_);
+  SimplexId *offsets = static_cast<SimplexId *>(inputOffsets_);
+
+  const ttk::SimplexId numberOfVertices = triangulation_->getNumberOfVertices();
+
+  std::vector<SimplexId> sortedVertices(numberOfVertices);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId i = 0; i < numberOfVertices; ++i)
+    sortedVertices[vertexOrder[i]] = i;
+
+  // extremum-saddle pairs, with one sweep per direction
+  std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>> JTPairs;
+  std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>> STPairs;
+  std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>>
+    globalPairs;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel sections num_threads(std::min(threadNumber_, 2))
+#endif // TTK_ENABLE_OPENMP
+  {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp section
+#endif // TTK_ENABLE_OPENMP
+    computeMergePairs<scalarType>(JTPairs, sortedVertices.data(), vertexOrder,
+                                  scalars, true, &globalPairs);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp section
+#endif // TTK_ENABLE_OPENMP
+    computeMergePairs<scalarType>(
+      STPairs, sortedVertices.data(), vertexOrder, scalars, false);
+  }
+
+  // saddle-saddle pairs, from a discrete gradient built on the same order
+  std::vector<std::tuple<SimplexId, SimplexId, scalarType>>
+    pl_saddleSaddlePairs;
+  if(triangulation_->getDimensionality() == 3 and ComputeSaddleConnectors) {
+    MorseSmaleComplex3D morseSmaleComplex;
+    morseSmaleComplex.setDebugLevel(debugLevel_);
+    morseSmaleComplex.setThreadNumber(threadNumber_);
+    morseSmaleComplex.setupTriangulation(triangulation_);
+    morseSmaleComplex.setInputScalarField(inputScalars_);
+    morseSmaleComplex.setInputOffsets(inputOffsets_);
+    morseSmaleComplex.setInputVertexOrder(vertexOrder);
+    morseSmaleComplex.computePersistencePairs<scalarType, idType>(
+      pl_saddleSaddlePairs);
+  }
+
+  // get persistence diagram
+  CTDiagram.clear();
+  CTDiagram.reserve(JTPairs.size() + globalPairs.size() + STPairs.size()
+                    + pl_saddleSaddlePairs.size());
+  for(const auto &p : JTPairs) {
+    CTDiagram.emplace_back(std::get<0>(p), CriticalType::Local_minimum,
+                           std::get<1>(p), CriticalType::Saddle1,
+                           std::get<2>(p), 0);
+  }
+  for(const auto &p : globalPairs) {
+    CTDiagram.emplace_back(std::get<0>(p), CriticalType::Local_minimum,
+                           std::get<1>(p), CriticalType::Local_maximum,
+                           std::get<2>(p), 0);
+  }
+  for(const auto &p : STPairs) {
+    CTDiagram.emplace_back(std::get<1>(p), CriticalType::Saddle2,
+                           std::get<0>(p), CriticalType::Local_maximum,
+                           std::get<2>(p), 2);
+  }
+  for(const auto &p : pl_saddleSaddlePairs) {
+    CTDiagram.emplace_back(std::get<0>(p), CriticalType::Saddle1,
+                           std::get<1>(p), CriticalType::Saddle2,
+                           std::get<2>(p), 1);
+  }
+
+  // finally sort the diagram
+  sortPersistenceDiagram(CTDiagram, scalars, offsets);
+
+  {
+    std::stringstream msg;
+    msg << "[PersistenceDiagram] Diagram (" << CTDiagram.size()
+        << " pairs) computed in " << t.getElapsedTime() << " s."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
 #endif // PERSISTENCEDIAGRAM_H
@@ -17,7 +17,7 @@
 
 #include <Auction.h>
 //
-#include <KDTree.h>
+#include <FlatKDTree.h>
 //
 #include <limits>
 //
@@ -68,15 +68,12 @@ namespace ttk {
     dataType getMaxPersistence();
     dataType getLowestPersistence();
     dataType getMinimalPrice(int i);
-    using KDTreePair = std::pair<typename KDTree<dataType>::KDTreeRoot,
-                                 typename KDTree<dataType>::KDTreeMap>;
-    KDTreePair getKDTree() const;
+    FlatKDTree<dataType> getKDTree() const;
 
     void runMatching(dataType *total_cost,
                      dataType epsilon,
                      std::vector<int> sizes,
-                     KDTree<dataType> &kdt,
-                     std::vector<KDTree<dataType> *> &correspondance_kdt_map,
+                     FlatKDTree<dataType> &kdt,
                      std::vector<dataType> *min_diag_price,
                      std::vector<dataType> *min_price,
                      std::vector<std::vector<matchingTuple>> *all_matchings,
@@ -86,8 +83,7 @@ namespace ttk {
     void runMatchingAuction(
       dataType *total_cost,
       std::vector<int> sizes,
-      KDTree<dataType> &kdt,
-      std::vector<KDTree<dataType> *> &correspondance_kdt_map,
+      FlatKDTree<dataType> &kdt,
       std::vector<dataType> *min_diag_price,
       std::vector<std::vector<matchingTuple>> *all_matchings,
       bool use_kdt);
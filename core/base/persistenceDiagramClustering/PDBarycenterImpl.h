@@ -50,8 +50,7 @@ void PDBarycenter<dataType>::runMatching(
   dataType *total_cost,
   dataType epsilon,
   std::vector<int> sizes,
-  KDTree<dataType> &kdt,
-  std::vector<KDTree<dataType> *> &correspondance_kdt_map,
+  FlatKDTree<dataType> &kdt,
   std::vector<dataType> *min_diag_price,
   std::vector<dataType> *min_price,
   std::vector<std::vector<matchingTuple>> *all_matchings,
@@ -68,8 +67,8 @@ void PDBarycenter<dataType>::runMatching(
     // "<<barycenter_goods_.size()<<" "<<min_diag_price->size()<<endl;
     Auction<dataType> auction = Auction<dataType>(
       current_bidder_diagrams_[i], barycenter_goods_[i], wasserstein_,
-      geometrical_factor_, lambda_, 0.01, kdt, correspondance_kdt_map, epsilon,
-      min_diag_price->at(i), use_kdt);
+      geometrical_factor_, lambda_, 0.01, kdt, epsilon, min_diag_price->at(i),
+      use_kdt);
     // cout<<"\n RUN MATCHINGS : "<<i<<endl;
     // cout<<use_kdt<<endl;
     // cout<<epsilon<<endl;
@@ -130,8 +129,7 @@ template <typename dataType>
 void PDBarycenter<dataType>::runMatchingAuction(
   dataType *total_cost,
   std::vector<int> sizes,
-  KDTree<dataType> &kdt,
-  std::vector<KDTree<dataType> *> &correspondance_kdt_map,
+  FlatKDTree<dataType> &kdt,
   std::vector<dataType> *min_diag_price,
   std::vector<std::vector<matchingTuple>> *all_matchings,
   bool use_kdt) {
@@ -142,8 +140,8 @@ void PDBarycenter<dataType>::runMatchingAuction(
   for(int i = 0; i < numberOfInputs_; i++) {
     Auction<dataType> auction = Auction<dataType>(
       current_bidder_diagrams_[i], barycenter_goods_[i], wasserstein_,
-      geometrical_factor_, lambda_, 0.01, kdt, correspondance_kdt_map,
-      (*min_diag_price)[i], use_kdt);
+      geometrical_factor_, lambda_, 0.01, kdt, (*min_diag_price)[i],
+      use_kdt);
     std::vector<matchingTuple> matchings;
     dataType cost = auction.run(&matchings);
     all_matchings->at(i) = matchings;
@@ -652,11 +650,9 @@ void PDBarycenter<dataType>::setInitialBarycenter(dataType min_persistence) {
 }
 
 template <typename dataType>
-typename PDBarycenter<dataType>::KDTreePair
-  PDBarycenter<dataType>::getKDTree() const {
+FlatKDTree<dataType> PDBarycenter<dataType>::getKDTree() const {
   Timer tm;
-  auto kdt = std::unique_ptr<KDTree<dataType>>(
-    new KDTree<dataType>{true, wasserstein_});
+  FlatKDTree<dataType> kdt{wasserstein_};
 
   const int dimension = geometrical_factor_ >= 1 ? 2 : 5;
 
@@ -682,15 +678,12 @@ typename PDBarycenter<dataType>::KDTreePair
       weights[idx].push_back(g.getPrice());
     }
   }
-  // Correspondance map : position in barycenter_goods_ --> KDT node
-
-  auto correspondance_kdt_map
-    = kdt->build(coordinates.data(), barycenter_goods_[0].size(), dimension,
-                 weights, barycenter_goods_.size());
+  kdt.build(coordinates.data(), barycenter_goods_[0].size(), dimension,
+            weights, barycenter_goods_.size());
   if(debugLevel_ > 3)
     std::cout << "[Building KD-Tree] Time elapsed : " << tm.getElapsedTime()
               << " s." << std::endl;
-  return std::make_pair(std::move(kdt), correspondance_kdt_map);
+  return kdt;
 }
 
 // template <typename dataType>
@@ -844,14 +837,12 @@ std::vector<std::vector<matchingTuple>>
 
     n_iterations += 1;
 
-    std::pair<std::unique_ptr<KDTree<dataType>>,
-              std::vector<KDTree<dataType> *>>
-      pair;
+    FlatKDTree<dataType> kdt;
     bool use_kdt = false;
     // If the barycenter is empty, do not compute the kdt (or it will crash :/)
     // TODO Fix KDTree to handle empty inputs...
     if(barycenter_goods_[0].size() > 0) {
-      pair = this->getKDTree();
+      kdt = this->getKDTree();
       use_kdt = true;
     }
 
@@ -872,8 +863,8 @@ std::vector<std::vector<matchingTuple>>
       barycenter.push_back(t);
     }
 
-    runMatchingAuction(&total_cost, sizes, *pair.first, pair.second,
-                       &min_diag_price, &all_matchings, use_kdt);
+    runMatchingAuction(
+      &total_cost, sizes, kdt, &min_diag_price, &all_matchings, use_kdt);
 
     std::cout << "[PersistenceDiagramsBarycenter] Barycenter cost : "
               << total_cost << std::endl;
@@ -17,7 +17,7 @@
 
 #include <Auction.h>
 //
-#include <KDTree.h>
+#include <FlatKDTree.h>
 //
 #include <array>
 #include <limits>
@@ -188,6 +188,12 @@ namespace ttk {
       use_accelerated_ = use_accelerated;
     }
 
+    /// Parallel (Jacobi) rounds for the auctions of computeDistance(),
+    /// which are called outside of any parallel loop.
+    inline void setUseParallelAuctionRounds(const bool useParallelRounds) {
+      use_parallel_rounds_ = useParallelRounds;
+    }
+
     inline void setTimeLimit(const double time_limit) {
       time_limit_ = time_limit;
     }
@@ -285,6 +291,7 @@ namespace ttk {
     int threadNumber_;
     bool use_progressive_;
     bool use_accelerated_;
+    bool use_parallel_rounds_{false};
     bool use_kmeanspp_;
     bool use_kdtree_;
     double time_limit_;
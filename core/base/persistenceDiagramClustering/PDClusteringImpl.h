@@ -972,6 +972,8 @@ dataType
   const auto D2_bis = centroidWithZeroPrices(D2);
   Auction<dataType> auction(
     wasserstein_, geometrical_factor_, lambda_, delta_lim, use_kdtree_);
+  auction.setThreadNumber(threadNumber_);
+  auction.setUseParallelRounds(use_parallel_rounds_);
   auction.BuildAuctionDiagrams(&D1, &D2_bis);
   dataType cost = auction.run(&matchings);
   return cost;
@@ -985,6 +987,8 @@ dataType
   std::vector<matchingTuple> matchings;
   Auction<dataType> auction(
     wasserstein_, geometrical_factor_, lambda_, delta_lim, use_kdtree_);
+  auction.setThreadNumber(threadNumber_);
+  auction.setUseParallelRounds(use_parallel_rounds_);
   int size1 = D1->size();
   auction.BuildAuctionDiagrams(D1, D2);
   dataType cost = auction.run(&matchings);
@@ -1845,9 +1849,6 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
       dataType total_cost = 0;
       dataType wasserstein_shift = 0;
 
-      using KDTreePair = std::pair<typename KDTree<dataType>::KDTreeRoot,
-                                   typename KDTree<dataType>::KDTreeMap>;
-
       if(do_min_) {
         std::vector<std::vector<matchingTuple>> all_matchings;
         // cout<<"do_min"<<endl;
@@ -1904,10 +1905,10 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         //     min_price[i] = 0;
         // }
         // cout << "min diag prices and all done" << endl;
-        KDTreePair pair;
+        FlatKDTree<dataType> kdt;
         bool use_kdt = false;
         if(barycenter_computer_min_[c].getCurrentBarycenter()[0].size() > 0) {
-          pair = barycenter_computer_min_[c].getKDTree();
+          kdt = barycenter_computer_min_[c].getKDTree();
           use_kdt = true;
         }
 
@@ -1918,9 +1919,8 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         // "<<time_preprocess_bary.getElapsedTime()<<endl; cout<<"time_matchings
         // min "; cout<<"run matchings "<<endl;
         barycenter_computer_min_[c].runMatching(
-          &total_cost, epsilon_[0], sizes, *pair.first, pair.second,
-          &(min_diag_price->at(0)), &(min_price->at(0)), &(all_matchings),
-          use_kdt, only_matchings);
+          &total_cost, epsilon_[0], sizes, kdt, &(min_diag_price->at(0)),
+          &(min_price->at(0)), &(all_matchings), use_kdt, only_matchings);
         for(unsigned int ii = 0; ii < all_matchings.size(); ii++) {
           all_matchings_per_type_and_cluster[c][0][ii].resize(
             all_matchings[ii].size());
@@ -2027,18 +2027,17 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         //     min_price[i] = 0;
         // }
 
-        KDTreePair pair;
+        FlatKDTree<dataType> kdt;
         bool use_kdt = false;
         if(barycenter_computer_sad_[c].getCurrentBarycenter()[0].size() > 0) {
-          pair = barycenter_computer_sad_[c].getKDTree();
+          kdt = barycenter_computer_sad_[c].getKDTree();
           use_kdt = true;
         }
 
         // std::cout<<"sad : run matchings"<<std::endl;
         barycenter_computer_sad_[c].runMatching(
-          &total_cost, epsilon_[1], sizes, *pair.first, pair.second,
-          &(min_diag_price->at(1)), &(min_price->at(1)), &(all_matchings),
-          use_kdt, only_matchings);
+          &total_cost, epsilon_[1], sizes, kdt, &(min_diag_price->at(1)),
+          &(min_price->at(1)), &(all_matchings), use_kdt, only_matchings);
         for(unsigned int ii = 0; ii < all_matchings.size(); ii++) {
           all_matchings_per_type_and_cluster[c][1][ii].resize(
             all_matchings[ii].size());
@@ -2137,10 +2136,10 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         // "<<centroids_with_price_max.size()<<"
         // "<<centroids_with_price_max[0].size()<<endl;
 
-        KDTreePair pair;
+        FlatKDTree<dataType> kdt;
         bool use_kdt = false;
         if(barycenter_computer_max_[c].getCurrentBarycenter()[0].size() > 0) {
-          pair = barycenter_computer_max_[c].getKDTree();
+          kdt = barycenter_computer_max_[c].getKDTree();
           use_kdt = true;
         }
 
@@ -2190,9 +2189,8 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         // // cout<<"running matchings max"<<endl;
         // cout<<"size centroid "<<centroids_with_price_max[c].size()<<endl;
         barycenter_computer_max_[c].runMatching(
-          &total_cost, epsilon_[2], sizes, *pair.first, pair.second,
-          &(min_diag_price->at(2)), &(min_price->at(2)), &(all_matchings),
-          use_kdt, only_matchings);
+          &total_cost, epsilon_[2], sizes, kdt, &(min_diag_price->at(2)),
+          &(min_price->at(2)), &(all_matchings), use_kdt, only_matchings);
         for(unsigned int ii = 0; ii < all_matchings.size(); ii++) {
           all_matchings_per_type_and_cluster[c][2][ii].resize(
             all_matchings[ii].size());
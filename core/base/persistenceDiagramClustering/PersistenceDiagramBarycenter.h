@@ -38,7 +38,7 @@
 //
 #include <Auction.h>
 //
-#include <KDTree.h>
+#include <FlatKDTree.h>
 //
 #include <limits>
 //
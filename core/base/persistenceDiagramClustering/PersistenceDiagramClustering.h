@@ -60,6 +60,7 @@ namespace ttk {
       use_progressive_ = 1;
       use_kmeanspp_ = 0;
       use_accelerated_ = 0;
+      use_parallel_rounds_ = false;
       numberOfInputs_ = 0;
       threadNumber_ = 1;
     };
@@ -113,6 +114,10 @@ namespace ttk {
       use_accelerated_ = UseAccelerated;
     }
 
+    inline void setUseParallelAuctionRounds(const bool useParallelRounds) {
+      use_parallel_rounds_ = useParallelRounds;
+    }
+
     inline void setNumberOfClusters(const int NumberOfClusters) {
       n_clusters_ = NumberOfClusters;
     }
@@ -159,6 +164,7 @@ namespace ttk {
     int threadNumber_;
     bool use_progressive_;
     bool use_accelerated_;
+    bool use_parallel_rounds_;
     bool use_kmeanspp_;
     double alpha_;
     double lambda_;
@@ -273,6 +279,7 @@ namespace ttk {
     KMeans.setNumberOfInputs(numberOfInputs_);
     KMeans.setUseProgressive(use_progressive_);
     KMeans.setAccelerated(use_accelerated_);
+    KMeans.setUseParallelAuctionRounds(use_parallel_rounds_);
     KMeans.setUseKDTree(true);
     KMeans.setTimeLimit(time_limit_);
     KMeans.setGeometricalFactor(alpha_);
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <functional>
 
 #include <PersistenceDiagramDistanceMatrix.h>
 
@@ -154,21 +155,111 @@ double PersistenceDiagramDistanceMatrix::getMostPersistent(
   return max_persistence;
 }
 
+void PersistenceDiagramDistanceMatrix::setAuctionDiagrams(
+  const std::vector<BidderDiagram<double>> &bidder_diags,
+  std::vector<AuctionDiagram> &auction_diags) const {
+
+  auction_diags.resize(bidder_diags.size());
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(this->threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < bidder_diags.size(); ++i) {
+    const auto &D = bidder_diags[i];
+    auto &AD = auction_diags[i];
+    AD.bidders = &D;
+    AD.persistences.resize(D.size());
+
+    for(int j = 0; j < D.size(); j++) {
+      const Bidder<double> &b = D.get(j);
+      Good<double> g(b.x_, b.y_, b.isDiagonal(), AD.goods.size());
+      g.SetCriticalCoordinates(b.coords_x_, b.coords_y_, b.coords_z_);
+      g.setPrice(0);
+      AD.goods.addGood(g);
+      AD.persistences[j] = b.getPersistence();
+      // as in Auction::getMatchingsAndDistance()
+      AD.diagonalCost
+        += 2 * Geometry::pow(std::abs((b.y_ - b.x_) / 2), this->Wasserstein);
+    }
+
+    std::sort(AD.persistences.begin(), AD.persistences.end(),
+              std::greater<double>());
+    AD.kdt = FlatKDTree<double>(this->Wasserstein);
+    Auction<double>::buildGoodsKDTree(AD.kdt, AD.goods, this->Alpha);
+  }
+}
+
+double PersistenceDiagramDistanceMatrix::getLowerBound(
+  const AuctionDiagram &D1, const AuctionDiagram &D2) const {
+
+  // 1. Matching two pairs costs at least 2 * (|pers1 - pers2| / 2)^p (the
+  // diagonal having a null persistence): the optimal 1D transport between
+  // the sorted persistences (padded with zeros) bounds the distance below
+  const auto &p1 = D1.persistences;
+  const auto &p2 = D2.persistences;
+  double bound{};
+  for(size_t i = 0; i < std::max(p1.size(), p2.size()); ++i) {
+    const double pers1 = i < p1.size() ? p1[i] : 0.0;
+    const double pers2 = i < p2.size() ? p2[i] : 0.0;
+    bound += 2 * Geometry::pow(std::abs(pers1 - pers2) / 2, this->Wasserstein);
+  }
+  bound *= this->Alpha;
+
+  if(this->Alpha != 1.0) {
+    // the KD-tree costs differ from the matching costs
+    return bound;
+  }
+
+  // 2. Every pair of a diagram is matched either to a pair of the other
+  // diagram or to the diagonal, hence costs at least the minimum of both
+  const auto nearestBound
+    = [this](const AuctionDiagram &D, const AuctionDiagram &other) {
+        std::vector<int> neighbours;
+        std::vector<double> costs;
+        double res{};
+        for(int i = 0; i < D.goods.size(); ++i) {
+          const Good<double> &g = D.goods.get(i);
+          double cost
+            = 2 * Geometry::pow(std::abs((g.y_ - g.x_) / 2), this->Wasserstein);
+          neighbours.clear();
+          costs.clear();
+          const std::array<double, 2> coordinates{g.x_, g.y_};
+          other.kdt.getKClosest(1, coordinates.data(), neighbours, costs);
+          if(!costs.empty()) {
+            cost = std::min(cost, costs[0]);
+          }
+          res += cost;
+        }
+        return res;
+      };
+
+  return std::max({bound, nearestBound(D1, D2), nearestBound(D2, D1)});
+}
+
 double PersistenceDiagramDistanceMatrix::computeDistance(
-  const BidderDiagram<double> &D1, const BidderDiagram<double> &D2) const {
-
-  GoodDiagram<double> D2_bis{};
-  for(int i = 0; i < D2.size(); i++) {
-    const Bidder<double> &b = D2.get(i);
-    Good<double> g(b.x_, b.y_, b.isDiagonal(), D2_bis.size());
-    g.SetCriticalCoordinates(b.coords_x_, b.coords_y_, b.coords_z_);
-    g.setPrice(0);
-    D2_bis.addGood(g);
+  const AuctionDiagram &D1, const AuctionDiagram &D2) const {
+
+  // both the lower bound and the diagonal matching need Wasserstein >= 1
+  const double lowerBound
+    = this->Wasserstein >= 1 ? this->getLowerBound(D1, D2) : 0.0;
+  const double upperBound = D1.diagonalCost + D2.diagonalCost;
+
+  // skip the auction when matching everything to the diagonal is already
+  // within the requested relative precision
+  if(this->Wasserstein >= 1
+     && upperBound
+          <= Geometry::pow(1.0 + this->DeltaLim, this->Wasserstein)
+               * lowerBound) {
+    return upperBound;
   }
 
   Auction<double> auction(
     this->Wasserstein, this->Alpha, this->Lambda, this->DeltaLim, true);
-  auction.BuildAuctionDiagrams(&D1, &D2_bis);
+  auction.setThreadNumber(this->threadNumber_);
+  auction.setUseParallelRounds(this->UseParallelAuctionRounds);
+  auction.BuildAuctionDiagrams(D1.bidders, &D2.goods, &D2.kdt);
+  // early-terminate the epsilon-scaling iterations
+  auction.setLowerBound(lowerBound);
   return auction.run();
 }
 
@@ -180,44 +271,81 @@ void PersistenceDiagramDistanceMatrix::getDiagramsDistMat(
   const std::vector<BidderDiagram<double>> &diags_max) const {
 
   distanceMatrix.resize(nInputs);
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for schedule(dynamic) num_threads(this->threadNumber_)
-#endif // TTK_ENABLE_OPENMP
   for(size_t i = 0; i < nInputs; ++i) {
     distanceMatrix[i].resize(nInputs);
-
     // matrix diagonal
     distanceMatrix[i][i] = 0.0;
+  }
 
-    for(size_t j = i + 1; j < nInputs; ++j) {
-      double distance{};
-
-      if(this->do_min_) {
-        auto &dimin = diags_min[i];
-        auto &djmin = diags_min[j];
-        distance += computeDistance(dimin, djmin);
-      }
-      if(this->do_sad_) {
-        auto &disad = diags_sad[i];
-        auto &djsad = diags_sad[j];
-        distance += computeDistance(disad, djsad);
-      }
-      if(this->do_max_) {
-        auto &dimax = diags_max[i];
-        auto &djmax = diags_max[j];
-        distance += computeDistance(dimax, djmax);
-      }
+  if(nInputs < 2) {
+    // no pair to compute
+    return;
+  }
 
-      distanceMatrix[i][j] = distance;
-    }
+  // 1. preprocess every diagram once (goods, KD-tree, bounds)
+  std::vector<AuctionDiagram> auction_diags_min{};
+  std::vector<AuctionDiagram> auction_diags_sad{};
+  std::vector<AuctionDiagram> auction_diags_max{};
+  if(this->do_min_) {
+    setAuctionDiagrams(diags_min, auction_diags_min);
+  }
+  if(this->do_sad_) {
+    setAuctionDiagrams(diags_sad, auction_diags_sad);
+  }
+  if(this->do_max_) {
+    setAuctionDiagrams(diags_max, auction_diags_max);
   }
 
-  // distance matrix is symmetric
+  // 2. schedule the N(N-1)/2 pairs, largest first, so that the threads
+  // taking the pairs on demand end up with balanced workloads
+  std::vector<std::pair<size_t, size_t>> pairs{};
+  pairs.reserve(nInputs * (nInputs - 1) / 2);
+  std::vector<size_t> diagSizes(nInputs, 0);
   for(size_t i = 0; i < nInputs; ++i) {
+    if(this->do_min_) {
+      diagSizes[i] += diags_min[i].size();
+    }
+    if(this->do_sad_) {
+      diagSizes[i] += diags_sad[i].size();
+    }
+    if(this->do_max_) {
+      diagSizes[i] += diags_max[i].size();
+    }
     for(size_t j = i + 1; j < nInputs; ++j) {
-      distanceMatrix[j][i] = distanceMatrix[i][j];
+      pairs.emplace_back(i, j);
+    }
+  }
+  std::stable_sort(
+    pairs.begin(), pairs.end(),
+    [&diagSizes](const std::pair<size_t, size_t> &a,
+                 const std::pair<size_t, size_t> &b) {
+      return diagSizes[a.first] + diagSizes[a.second]
+             > diagSizes[b.first] + diagSizes[b.second];
+    });
+
+  // with parallel auction rounds, the threads go to each auction instead
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(this->threadNumber_) \
+  if(!this->UseParallelAuctionRounds)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t k = 0; k < pairs.size(); ++k) {
+    const size_t i = pairs[k].first;
+    const size_t j = pairs[k].second;
+    double distance{};
+
+    if(this->do_min_) {
+      distance += computeDistance(auction_diags_min[i], auction_diags_min[j]);
+    }
+    if(this->do_sad_) {
+      distance += computeDistance(auction_diags_sad[i], auction_diags_sad[j]);
     }
+    if(this->do_max_) {
+      distance += computeDistance(auction_diags_max[i], auction_diags_max[j]);
+    }
+
+    // distance matrix is symmetric
+    distanceMatrix[i][j] = distance;
+    distanceMatrix[j][i] = distance;
   }
 }
 
@@ -83,6 +83,12 @@ namespace ttk {
     inline void setMinPersistence(const double data) {
       MinPersistence = data;
     }
+    /// Run each auction with parallel (Jacobi) rounds, one diagram pair
+    /// after the other, instead of computing several pairs in parallel.
+    /// Pays off for a few large diagrams.
+    inline void setUseParallelAuctionRounds(const bool data) {
+      UseParallelAuctionRounds = data;
+    }
     inline void setConstraint(const int data) {
       if(data == 0) {
         this->Constraint = ConstraintType::FULL_DIAGRAMS;
@@ -98,10 +104,26 @@ namespace ttk {
     }
 
   protected:
+    // auction data of a diagram, computed once and shared by all its pairs
+    struct AuctionDiagram {
+      const BidderDiagram<double> *bidders{};
+      GoodDiagram<double> goods{};
+      FlatKDTree<double> kdt{};
+      // pair persistences, in decreasing order (distance lower bound)
+      std::vector<double> persistences{};
+      // cost of matching every pair to the diagonal (distance upper bound)
+      double diagonalCost{};
+    };
+
     double getMostPersistent(
       const std::vector<BidderDiagram<double>> &bidder_diags) const;
-    double computeDistance(const BidderDiagram<double> &D1,
-                           const BidderDiagram<double> &D2) const;
+    void setAuctionDiagrams(
+      const std::vector<BidderDiagram<double>> &bidder_diags,
+      std::vector<AuctionDiagram> &auction_diags) const;
+    double getLowerBound(const AuctionDiagram &D1,
+                         const AuctionDiagram &D2) const;
+    double computeDistance(const AuctionDiagram &D1,
+                           const AuctionDiagram &D2) const;
     void getDiagramsDistMat(
       const size_t nInputs,
       std::vector<std::vector<double>> &distanceMatrix,
@@ -128,6 +150,7 @@ namespace ttk {
     double Lambda;
     size_t MaxNumberOfPairs{20};
     double MinPersistence{0.1};
+    bool UseParallelAuctionRounds{false};
     bool do_min_{true}, do_sad_{true}, do_max_{true};
 
     enum class ConstraintType {
@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <map>
 
 // base code includes
@@ -69,6 +71,28 @@ namespace ttk {
                          const std::vector<std::pair<SimplexId, SimplexId>>
                            &vertexLinkEdgeList) const;
 
+    /// Critical type of a vertex, given the number of connected components
+    /// of its lower and upper links.
+    char getCriticalTypeFromValences(const SimplexId downValence,
+                                     const SimplexId upValence) const;
+
+    /// Computes the critical type of every vertex of the triangulation.
+    template <class dataType, class triangulationType>
+    int classifyVertices(std::vector<char> &vertexTypes,
+                         const dataType *scalarValues,
+                         const triangulationType *triangulation) const;
+
+    /// Fast path for regular grids: the links of the interior vertices all
+    /// have the same combinatorics, hence the critical type of a vertex only
+    /// depends on which of its neighbors are lower. This pattern is encoded
+    /// as a bitmask (computed row by row), and looked up in a table of the
+    /// critical types of all the possible patterns. Boundary vertices go
+    /// through the generic path.
+    template <class dataType>
+    int classifyVertices(std::vector<char> &vertexTypes,
+                         const dataType *scalarValues,
+                         const ImplicitTriangulation *triangulation) const;
+
     template <class dataType>
     static bool isSosHigherThan(const SimplexId &offset0,
                                 const dataType &value0,
@@ -203,13 +227,7 @@ int ttk::ScalarFieldCriticalPoints::execute(
   std::vector<char> vertexTypes(vertexNumber_);
 
   if(triangulation) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-    for(SimplexId i = 0; i < (SimplexId)vertexNumber_; i++) {
-
-      vertexTypes[i] = getCriticalType(i, scalarValues, triangulation);
-    }
+    classifyVertices(vertexTypes, scalarValues, triangulation);
   } else if(vertexLinkEdgeLists_) {
     // legacy implementation
 #ifdef TTK_ENABLE_OPENMP
@@ -309,6 +327,201 @@ int ttk::ScalarFieldCriticalPoints::execute(
   return 0;
 }
 
+template <class dataType, class triangulationType>
+int ttk::ScalarFieldCriticalPoints::classifyVertices(
+  std::vector<char> &vertexTypes,
+  const dataType *scalarValues,
+  const triangulationType *triangulation) const {
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < (SimplexId)vertexNumber_; i++) {
+
+    vertexTypes[i] = getCriticalType(i, scalarValues, triangulation);
+  }
+
+  return 0;
+}
+
+template <class dataType>
+int ttk::ScalarFieldCriticalPoints::classifyVertices(
+  std::vector<char> &vertexTypes,
+  const dataType *scalarValues,
+  const ImplicitTriangulation *triangulation) const {
+
+  // grid axes with more than one vertex (the first one has stride 1)
+  const SimplexId *dimensions = triangulation->getVertexGridDimensions();
+  const SimplexId strides[3]
+    = {1, dimensions[0], dimensions[0] * dimensions[1]};
+  std::vector<int> axes;
+  bool isThick = true;
+  for(int i = 0; i < 3; i++) {
+    if(dimensions[i] > 1) {
+      axes.emplace_back(i);
+      // at least one interior vertex per axis
+      isThick = isThick && dimensions[i] > 2;
+    }
+  }
+
+  // number of neighbors of the interior vertices
+  const int neighborNumber = (dimension_ == 3) ? 14 : 6;
+
+  // reference interior vertex
+  SimplexId center = 0;
+  for(const auto axis : axes)
+    center += (dimensions[axis] / 2) * strides[axis];
+
+  if((dimension_ != 2 && dimension_ != 3) || (int)axes.size() != dimension_
+     || !isThick
+     || triangulation->getVertexNeighborNumber(center) != neighborNumber) {
+    // generic path
+    return classifyVertices<dataType, ImplicitTriangulation>(
+      vertexTypes, scalarValues, triangulation);
+  }
+
+  // neighbor offsets (identical for all the interior vertices)
+  std::vector<SimplexId> neighborShifts(neighborNumber);
+  for(int k = 0; k < neighborNumber; k++) {
+    SimplexId neighborId = -1;
+    triangulation->getVertexNeighbor(center, k, neighborId);
+    neighborShifts[k] = neighborId - center;
+  }
+  const auto neighborIndex = [&neighborShifts](const SimplexId shift) {
+    return std::find(neighborShifts.begin(), neighborShifts.end(), shift)
+           - neighborShifts.begin();
+  };
+
+  // link edges, in terms of neighbor indices
+  std::vector<std::pair<int, int>> linkEdges;
+  const SimplexId starNumber = triangulation->getVertexStarNumber(center);
+  for(SimplexId i = 0; i < starNumber; i++) {
+    SimplexId cellId = -1;
+    triangulation->getVertexStar(center, i, cellId);
+    std::vector<int> link;
+    for(int j = 0; j <= dimension_; j++) {
+      SimplexId vertexId = -1;
+      triangulation->getCellVertex(cellId, j, vertexId);
+      if(vertexId != center)
+        link.emplace_back(neighborIndex(vertexId - center));
+    }
+    for(size_t j = 0; j < link.size(); j++)
+      for(size_t k = j + 1; k < link.size(); k++)
+        linkEdges.emplace_back(
+          std::min(link[j], link[k]), std::max(link[j], link[k]));
+  }
+  std::sort(linkEdges.begin(), linkEdges.end());
+  linkEdges.erase(
+    std::unique(linkEdges.begin(), linkEdges.end()), linkEdges.end());
+
+  // critical type of each lower link pattern (bit k: neighbor k is lower)
+  const int patternNumber = 1 << neighborNumber;
+  std::vector<char> typeTable(patternNumber);
+  for(int pattern = 0; pattern < patternNumber; pattern++) {
+    int parents[14];
+    for(int k = 0; k < neighborNumber; k++)
+      parents[k] = k;
+    const auto findRoot = [&parents](int k) {
+      while(parents[k] != k)
+        k = parents[k] = parents[parents[k]];
+      return k;
+    };
+    for(const auto &e : linkEdges) {
+      // both lower or both upper
+      if(((pattern >> e.first) & 1) == ((pattern >> e.second) & 1))
+        parents[findRoot(e.first)] = findRoot(e.second);
+    }
+    SimplexId downValence = 0, upValence = 0;
+    for(int k = 0; k < neighborNumber; k++) {
+      if(findRoot(k) == k) {
+        if((pattern >> k) & 1)
+          downValence++;
+        else
+          upValence++;
+      }
+    }
+    typeTable[pattern] = getCriticalTypeFromValences(downValence, upValence);
+  }
+
+  const SimplexId *offsets = sosOffsets_->data();
+  const uint16_t allNeighbors = patternNumber - 1;
+
+  // the grid is processed by rows along the first axis
+  const SimplexId rowLength = dimensions[axes[0]];
+  const SimplexId rowNumber1 = dimensions[axes[1]];
+  const SimplexId rowNumber2 = (dimension_ == 3) ? dimensions[axes[2]] : 1;
+  const SimplexId rowStride1 = strides[axes[1]];
+  const SimplexId rowStride2 = (dimension_ == 3) ? strides[axes[2]] : 0;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    std::vector<uint16_t> lowerPatterns(rowLength), upperPatterns(rowLength);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for(SimplexId r = 0; r < rowNumber1 * rowNumber2; r++) {
+      const SimplexId r1 = r % rowNumber1;
+      const SimplexId r2 = r / rowNumber1;
+      const SimplexId first = r1 * rowStride1 + r2 * rowStride2;
+
+      if(r1 == 0 || r1 == rowNumber1 - 1
+         || (dimension_ == 3 && (r2 == 0 || r2 == rowNumber2 - 1))) {
+        // boundary row
+        for(SimplexId x = 0; x < rowLength; x++)
+          vertexTypes[first + x]
+            = getCriticalType(first + x, scalarValues, triangulation);
+        continue;
+      }
+
+      vertexTypes[first] = getCriticalType(first, scalarValues, triangulation);
+      vertexTypes[first + rowLength - 1] = getCriticalType(
+        first + rowLength - 1, scalarValues, triangulation);
+
+      const dataType *values = scalarValues + first;
+      const SimplexId *rowOffsets = offsets + first;
+      uint16_t *lower = lowerPatterns.data();
+      uint16_t *upper = upperPatterns.data();
+      std::fill(lowerPatterns.begin(), lowerPatterns.end(), 0);
+      std::fill(upperPatterns.begin(), upperPatterns.end(), 0);
+
+      // one neighbor at a time, for all the interior vertices of the row
+      for(int k = 0; k < neighborNumber; k++) {
+        const SimplexId shift = neighborShifts[k];
+        for(SimplexId x = 1; x < rowLength - 1; x++) {
+          const dataType value = values[x];
+          const dataType neighborValue = values[x + shift];
+          const SimplexId offset = rowOffsets[x];
+          const SimplexId neighborOffset = rowOffsets[x + shift];
+          // isSosLowerThan() and isSosHigherThan(), without branches
+          const uint16_t isLower
+            = (neighborValue < value)
+              | ((neighborValue == value) & (neighborOffset < offset));
+          const uint16_t isHigher
+            = (neighborValue > value)
+              | ((neighborValue == value) & (neighborOffset > offset));
+          lower[x] |= isLower << k;
+          upper[x] |= isHigher << k;
+        }
+      }
+
+      for(SimplexId x = 1; x < rowLength - 1; x++) {
+        if((lower[x] | upper[x]) == allNeighbors) {
+          vertexTypes[first + x] = typeTable[lower[x]];
+        } else {
+          // neighbors with the same value and offset
+          vertexTypes[first + x]
+            = getCriticalType(first + x, scalarValues, triangulation);
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
 template <class dataType, class triangulationType>
 std::pair<ttk::SimplexId, ttk::SimplexId>
   ttk::ScalarFieldCriticalPoints::getNumberOfLowerUpperComponents(
@@ -461,6 +674,12 @@ char ttk::ScalarFieldCriticalPoints::getCriticalType(
   std::tie(downValence, upValence) = getNumberOfLowerUpperComponents<dataType>(
     vertexId, scalarValues, triangulation);
 
+  return getCriticalTypeFromValences(downValence, upValence);
+}
+
+inline char ttk::ScalarFieldCriticalPoints::getCriticalTypeFromValences(
+  const SimplexId downValence, const SimplexId upValence) const {
+
   if(downValence == 0 && upValence == 1) {
     return (char)(CriticalType::Local_minimum);
   } else if(downValence == 1 && upValence == 0) {
@@ -133,7 +133,6 @@ template <typename dataType>
 int ttk::TopologicalCompression::ReadPersistenceGeometry(FILE *fm) {
   using ttk::TopologicalCompression;
 
-  int sqMethod = sqMethodInt_;
   bool zfpOnly = zfpOnly_;
   double zfpBitBudget = zfpBitBudget_;
   int *dataExtent = dataExtent_;
@@ -166,40 +165,7 @@ int ttk::TopologicalCompression::ReadPersistenceGeometry(FILE *fm) {
   if(zfpBitBudget > 64.0 || zfpBitBudget < 1) {
 
     // 2.a. (2.) Affect values to points thanks to topology indices.
-    for(int i = 0; i < vertexNumber; ++i) {
-      int seg = segmentation_[i];
-      auto end = mapping_.end();
-      auto it = std::lower_bound(
-        mapping_.begin(), mapping_.end(), std::make_tuple(0, seg), cmp);
-      if(it != end) {
-        std::tuple<double, int> tt = *it;
-        double value = std::get<0>(tt);
-        int sseg = std::get<1>(tt);
-        if(seg != sseg) {
-          std::stringstream msg;
-          msg << "Decompression mismatch (" << seg << ", " << sseg << ")"
-              << std::endl;
-          dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
-        }
-        decompressedData_[i] = value;
-      } else {
-        {
-          std::stringstream msg;
-          msg << "Could not find " << seg << " index." << std::endl;
-          dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
-        }
-        std::tuple<double, int> tt = *it;
-        double value = std::get<0>(tt);
-        decompressedData_[i] = value;
-      }
-    }
-
-    {
-      std::stringstream msg;
-      msg << "[TopologicalCompression] Successfully affected geomap."
-          << std::endl;
-      dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
-    }
+    AffectSegmentValues<double>();
 
   } else {
 #ifdef TTK_ENABLE_ZFP
@@ -224,12 +190,85 @@ int ttk::TopologicalCompression::ReadPersistenceGeometry(FILE *fm) {
 #endif
   }
 
+  rawFileLength += numberOfBytesRead;
+
+  return ReconstructPersistenceGeometry<double>(
+    mappingsSortedPerValue, min, max, nbConstraints, nullptr);
+}
+
+template <typename dataType>
+int ttk::TopologicalCompression::AffectSegmentValues() {
+  const int vertexNumber = decompressedData_.size();
+
+  for(int i = 0; i < vertexNumber; ++i) {
+    int seg = segmentation_[i];
+    auto end = mapping_.end();
+    auto it = std::lower_bound(
+      mapping_.begin(), mapping_.end(), std::make_tuple(0, seg), cmp);
+    if(it != end) {
+      std::tuple<double, int> tt = *it;
+      double value = std::get<0>(tt);
+      int sseg = std::get<1>(tt);
+      if(seg != sseg) {
+        std::stringstream msg;
+        msg << "Decompression mismatch (" << seg << ", " << sseg << ")"
+            << std::endl;
+        dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+      }
+      decompressedData_[i] = value;
+    } else {
+      {
+        std::stringstream msg;
+        msg << "Could not find " << seg << " index." << std::endl;
+        dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+      }
+      std::tuple<double, int> tt = *it;
+      double value = std::get<0>(tt);
+      decompressedData_[i] = value;
+    }
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[TopologicalCompression] Successfully affected geomap."
+        << std::endl;
+    dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+  }
+
+  return 0;
+}
+
+template <typename dataType>
+int ttk::TopologicalCompression::ReconstructPersistenceGeometry(
+  std::vector<std::tuple<double, int>> &mappingsSortedPerValue,
+  double min,
+  double max,
+  int nbConstraints,
+  const int *roi) {
+  int sqMethod = sqMethodInt_;
+  bool zfpOnly = zfpOnly_;
+  const int vertexNumber = decompressedData_.size();
+  const int nx = 1 + dataExtent_[1] - dataExtent_[0];
+  const int ny = 1 + dataExtent_[3] - dataExtent_[2];
+
   // No SQ.
   if(sqMethod == 0 || sqMethod == 3) {
     for(int i = 0; i < (int)criticalConstraints_.size(); ++i) {
       std::tuple<int, double, int> t = criticalConstraints_[i];
       int id = std::get<0>(t);
       double val = std::get<1>(t);
+      if(roi != nullptr) {
+        // Global vertex id to region of interest.
+        const int x = id % nx;
+        const int y = (id / nx) % ny;
+        const int z = id / (nx * ny);
+        if(x < roi[0] || x > roi[1] || y < roi[2] || y > roi[3] || z < roi[4]
+           || z > roi[5])
+          continue;
+        const int rnx = 1 + roi[1] - roi[0];
+        const int rny = 1 + roi[3] - roi[2];
+        id = (x - roi[0]) + rnx * ((y - roi[2]) + rny * (z - roi[4]));
+      }
       decompressedData_[id] = val;
     }
   }
@@ -259,6 +298,17 @@ int ttk::TopologicalCompression::ReadPersistenceGeometry(FILE *fm) {
     dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
   }
 
+  if(roi != nullptr) {
+    // The simplification needs the whole domain: values of a region of
+    // interest are only guaranteed to lie in their topological intervals.
+    std::stringstream msg;
+    msg << "[TopologicalCompression] Region of interest: skipped "
+           "simplification."
+        << std::endl;
+    dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+    return 0;
+  }
+
   // 2.b. (4.) Apply topological simplification with min/max constraints
   PerformSimplification<double>(criticalConstraints_, nbConstraints,
                                 vertexNumber, decompressedData_.data());
@@ -269,11 +319,360 @@ int ttk::TopologicalCompression::ReadPersistenceGeometry(FILE *fm) {
     dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
   }
 
-  rawFileLength += numberOfBytesRead;
+  return 0;
+}
+
+template <typename dataType>
+int ttk::TopologicalCompression::WritePersistenceBricks(FILE *fp,
+                                                        int *dataExtent,
+                                                        bool zfpOnly,
+                                                        double zfpBitBudget,
+                                                        double *toCompress) {
+  // Bricked layout, after the metadata and the zlib flag:
+  //   global chunk (segment values and critical constraints),
+  //   brick number, then (chunk size, raw size) per brick,
+  //   brick chunks (compact segmentation, then ZFP stream).
+  // The topological index is computed and stored for the whole domain, so
+  // the guarantees do not depend on the brick boundaries.
+  const bool useZFP = zfpBitBudget <= 64.0 && zfpBitBudget > 0;
+#ifndef TTK_ENABLE_ZFP
+  if(useZFP) {
+    std::stringstream msg;
+    msg << "[TopologicalCompression] Attempted to write with ZFP but ZFP is "
+           "not installed."
+        << std::endl;
+    dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+    return -5;
+  }
+#endif
+
+  const int numberOfSegments = getNbSegments();
+  if(!zfpOnly && numberOfSegments < 1)
+    return -1;
+
+  const int nx = 1 + dataExtent[1] - dataExtent[0];
+  const int ny = 1 + dataExtent[3] - dataExtent[2];
+  const int nz = 1 + dataExtent[5] - dataExtent[4];
+
+  std::vector<int> bx, by, bz;
+  GetBrickBounds(nx, brickSize_, bx);
+  GetBrickBounds(ny, brickSize_, by);
+  GetBrickBounds(nz, brickSize_, bz);
+  const int nbx = bx.size() - 1;
+  const int nby = by.size() - 1;
+  const int nbz = bz.size() - 1;
+  const int brickNumber = nbx * nby * nbz;
+
+  // 1. Global chunk.
+  std::vector<unsigned char> raw, chunk;
+  {
+    char *buffer;
+    size_t length;
+    FILE *fm = OpenWriteStream(&buffer, &length);
+    if(fm == nullptr)
+      return -6;
+    if(!zfpOnly)
+      WritePersistenceIndex(fm, mapping_, criticalConstraints_);
+    CloseWriteStream(fm, &buffer, &length, raw);
+  }
+  EncodeChunk(raw, chunk);
+
+  // 2. Brick chunks.
+  std::vector<std::vector<unsigned char>> brickChunks(brickNumber);
+  std::vector<unsigned long> brickRawSizes(brickNumber);
+  std::vector<int> brickStatus(brickNumber, 0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+  for(int b = 0; b < brickNumber; ++b) {
+    const int i = b % nbx;
+    const int j = (b / nbx) % nby;
+    const int k = b / (nbx * nby);
+    const int bnx = bx[i + 1] - bx[i];
+    const int bny = by[j + 1] - by[j];
+    const int bnz = bz[k + 1] - bz[k];
+    const int bnv = bnx * bny * bnz;
+
+    // padded (see WriteCompactSegmentation)
+    std::vector<int> segmentation(zfpOnly ? 0 : bnv + 32, 0);
+    std::vector<double> values(useZFP ? bnv : 0);
+    int l = 0;
+    for(int z = bz[k]; z < bz[k + 1]; ++z) {
+      for(int y = by[j]; y < by[j + 1]; ++y) {
+        for(int x = bx[i]; x < bx[i + 1]; ++x, ++l) {
+          const int id = x + nx * (y + ny * z);
+          if(!zfpOnly)
+            segmentation[l] = segmentation_[id];
+          if(useZFP)
+            values[l] = toCompress[id];
+        }
+      }
+    }
+
+    char *buffer;
+    size_t length;
+    FILE *fm = OpenWriteStream(&buffer, &length);
+    if(fm == nullptr) {
+      brickStatus[b] = -6;
+      continue;
+    }
+    if(!zfpOnly) {
+      WriteInt(fm, bnv);
+      WriteInt(fm, numberOfSegments);
+      WriteCompactSegmentation(fm, segmentation, bnv, numberOfSegments);
+    }
+#ifdef TTK_ENABLE_ZFP
+    if(useZFP)
+      CompressWithZFP(fm, false, values, bnx, bny, bnz, zfpBitBudget);
+#endif
+    std::vector<unsigned char> brickRaw;
+    CloseWriteStream(fm, &buffer, &length, brickRaw);
+    brickRawSizes[b] = brickRaw.size();
+    EncodeChunk(brickRaw, brickChunks[b]);
+  }
+
+  for(int b = 0; b < brickNumber; ++b) {
+    if(brickStatus[b] != 0)
+      return brickStatus[b];
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[TopologicalCompression] Encoded " << brickNumber << " brick(s)."
+        << std::endl;
+    dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+  }
+
+  // 3. [->fp] Write chunks and brick index.
+  WriteUnsignedLong(fp, chunk.size());
+  WriteUnsignedLong(fp, raw.size());
+  if(!chunk.empty())
+    WriteUnsignedCharArray(fp, chunk.data(), chunk.size());
+
+  WriteInt(fp, brickNumber);
+  for(int b = 0; b < brickNumber; ++b) {
+    WriteUnsignedLong(fp, brickChunks[b].size());
+    WriteUnsignedLong(fp, brickRawSizes[b]);
+  }
+  for(int b = 0; b < brickNumber; ++b) {
+    if(!brickChunks[b].empty())
+      WriteUnsignedCharArray(
+        fp, brickChunks[b].data(), brickChunks[b].size());
+  }
 
   return 0;
 }
 
+template <typename dataType>
+int ttk::TopologicalCompression::ReadPersistenceBricks(
+  FILE *fp,
+  bool useZlib,
+  const unsigned char *mapped,
+  size_t mappedLength) {
+  const bool useZFP = !(zfpBitBudget_ > 64.0 || zfpBitBudget_ < 1);
+#ifndef TTK_ENABLE_ZFP
+  if(useZFP) {
+    std::stringstream msg;
+    msg << "[TopologicalCompression] Attempted to read "
+        << "a ZFP block but ZFP is not installed." << std::endl;
+    dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+    return -5;
+  }
+#endif
+#ifndef TTK_ENABLE_ZLIB
+  if(useZlib) {
+    std::stringstream msg;
+    msg << "[TopologicalCompression] File compressed but ZLIB not installed! "
+           "Aborting."
+        << std::endl;
+    dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+    return -4;
+  }
+#endif
+
+  const int nx = 1 + dataExtent_[1] - dataExtent_[0];
+  const int ny = 1 + dataExtent_[3] - dataExtent_[2];
+  const int nz = 1 + dataExtent_[5] - dataExtent_[4];
+
+  std::vector<int> bx, by, bz;
+  GetBrickBounds(nx, brickSize_, bx);
+  GetBrickBounds(ny, brickSize_, by);
+  GetBrickBounds(nz, brickSize_, bz);
+  const int nbx = bx.size() - 1;
+  const int nby = by.size() - 1;
+  const int nbz = bz.size() - 1;
+
+  int roi[6];
+  const int roiType = getLocalRegionOfInterest(roi);
+  if(roiType < 0) {
+    std::stringstream msg;
+    msg << "[TopologicalCompression] Empty region of interest." << std::endl;
+    dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+    return -7;
+  }
+  const int rnx = 1 + roi[1] - roi[0];
+  const int rny = 1 + roi[3] - roi[2];
+  const int rnz = 1 + roi[5] - roi[4];
+
+  // 1. [fp->] Global chunk.
+  std::vector<std::tuple<double, int>> mappingsSortedPerValue;
+  double min = 0;
+  double max = 0;
+  int nbConstraints = 0;
+  {
+    const unsigned long chunkSize = ReadUnsignedLong(fp);
+    const unsigned long rawSize = ReadUnsignedLong(fp);
+    std::vector<unsigned char> chunk(chunkSize), buffer;
+    if(chunkSize > 0)
+      ReadUnsignedCharArray(fp, chunk.data(), chunkSize);
+    const unsigned char *raw
+      = DecodeChunk(useZlib, chunk.data(), chunkSize, rawSize, buffer);
+    if(raw == nullptr)
+      return -5;
+    if(!zfpOnly_) {
+      FILE *fm = OpenMemoryStream(raw, rawSize);
+      if(fm == nullptr)
+        return -5;
+      ReadPersistenceIndex(fm, mapping_, mappingsSortedPerValue,
+                           criticalConstraints_, min, max, nbConstraints);
+      fclose(fm);
+    }
+  }
+
+  // 2. [fp->] Brick index.
+  const int brickNumber = ReadInt(fp);
+  if(brickNumber != nbx * nby * nbz) {
+    std::stringstream msg;
+    msg << "[TopologicalCompression] Inconsistent brick number ("
+        << brickNumber << " vs " << nbx * nby * nbz << ")." << std::endl;
+    dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+    return -8;
+  }
+  std::vector<unsigned long> chunkSizes(brickNumber), rawSizes(brickNumber);
+  std::vector<unsigned long> chunkOffsets(brickNumber + 1, 0);
+  for(int b = 0; b < brickNumber; ++b) {
+    chunkSizes[b] = ReadUnsignedLong(fp);
+    rawSizes[b] = ReadUnsignedLong(fp);
+    chunkOffsets[b + 1] = chunkOffsets[b] + chunkSizes[b];
+  }
+  const long base = ftell(fp);
+
+  // Bricks intersecting the region of interest.
+  std::vector<int> bricks;
+  for(int b = 0; b < brickNumber; ++b) {
+    const int i = b % nbx;
+    const int j = (b / nbx) % nby;
+    const int k = b / (nbx * nby);
+    if(bx[i] <= roi[1] && bx[i + 1] > roi[0] && by[j] <= roi[3]
+       && by[j + 1] > roi[2] && bz[k] <= roi[5] && bz[k + 1] > roi[4])
+      bricks.push_back(b);
+  }
+
+  // 3. [fp->] Brick chunks, in place in the file mapping if possible.
+  const bool inPlace = mapped != nullptr && base >= 0
+                       && base + chunkOffsets[brickNumber] <= mappedLength;
+  std::vector<std::vector<unsigned char>> chunks(inPlace ? 0 : brickNumber);
+  if(!inPlace) {
+    for(const auto b : bricks) {
+      chunks[b].resize(chunkSizes[b]);
+      fseek(fp, base + chunkOffsets[b], SEEK_SET);
+      if(chunkSizes[b] > 0)
+        ReadUnsignedCharArray(fp, chunks[b].data(), chunkSizes[b]);
+    }
+  }
+
+  // 4. Decode bricks into the region of interest.
+  const int vertexNumber = rnx * rny * rnz;
+  if(!zfpOnly_)
+    segmentation_.assign(vertexNumber, 0);
+  decompressedData_.assign(vertexNumber, 0.0);
+  std::vector<int> brickStatus(bricks.size(), 0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+  for(size_t n = 0; n < bricks.size(); ++n) {
+    const int b = bricks[n];
+    const int i = b % nbx;
+    const int j = (b / nbx) % nby;
+    const int k = b / (nbx * nby);
+    const int bnx = bx[i + 1] - bx[i];
+    const int bny = by[j + 1] - by[j];
+    const int bnz = bz[k + 1] - bz[k];
+    const int bnv = bnx * bny * bnz;
+
+    const unsigned char *source
+      = inPlace ? mapped + base + chunkOffsets[b] : chunks[b].data();
+    std::vector<unsigned char> buffer;
+    const unsigned char *raw
+      = DecodeChunk(useZlib, source, chunkSizes[b], rawSizes[b], buffer);
+    FILE *fm = raw != nullptr ? OpenMemoryStream(raw, rawSizes[b]) : nullptr;
+    if(fm == nullptr) {
+      brickStatus[n] = -5;
+      continue;
+    }
+
+    std::vector<int> segmentation;
+    std::vector<double> values;
+    if(!zfpOnly_) {
+      int numberOfVertices = 0;
+      int numberOfSegments = 0;
+      const int ret = ReadCompactSegmentation(
+        fm, segmentation, numberOfVertices, numberOfSegments);
+      if(ret < 0 || numberOfVertices != bnv) {
+        fclose(fm);
+        brickStatus[n] = -8;
+        continue;
+      }
+    }
+#ifdef TTK_ENABLE_ZFP
+    if(useZFP) {
+      values.resize(bnv);
+      CompressWithZFP(fm, true, values, bnx, bny, bnz, zfpBitBudget_);
+    }
+#endif
+    fclose(fm);
+
+    for(int z = std::max(bz[k], roi[4]); z < std::min(bz[k + 1], roi[5] + 1);
+        ++z) {
+      for(int y = std::max(by[j], roi[2]);
+          y < std::min(by[j + 1], roi[3] + 1); ++y) {
+        for(int x = std::max(bx[i], roi[0]);
+            x < std::min(bx[i + 1], roi[1] + 1); ++x) {
+          const int l = (x - bx[i]) + bnx * ((y - by[j]) + bny * (z - bz[k]));
+          const int id
+            = (x - roi[0]) + rnx * ((y - roi[2]) + rny * (z - roi[4]));
+          if(!zfpOnly_)
+            segmentation_[id] = segmentation[l];
+          if(useZFP)
+            decompressedData_[id] = values[l];
+        }
+      }
+    }
+  }
+
+  for(size_t n = 0; n < bricks.size(); ++n) {
+    if(brickStatus[n] != 0)
+      return brickStatus[n];
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[TopologicalCompression] Decoded " << bricks.size() << "/"
+        << brickNumber << " brick(s)." << std::endl;
+    dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+  }
+
+  // 5. Same reconstruction as the single stream format.
+  if(!useZFP)
+    AffectSegmentValues<double>();
+
+  return ReconstructPersistenceGeometry<double>(
+    mappingsSortedPerValue, min, max, nbConstraints,
+    roiType == 1 ? roi : nullptr);
+}
+
 template <typename dataType>
 int ttk::TopologicalCompression::PerformSimplification(
   const std::vector<std::tuple<int, double, int>> &constraints,
@@ -1,5 +1,11 @@
 #include "TopologicalCompression.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 // General.
 ttk::TopologicalCompression::TopologicalCompression() {
   inputData_ = nullptr;
@@ -10,7 +16,7 @@ ttk::TopologicalCompression::TopologicalCompression() {
   nbVertices = 0;
   rawFileLength = 0;
   magicBytes_ = "TTKCompressedFileFormat";
-  formatVersion_ = 1;
+  formatVersion_ = 2;
 }
 
 ttk::TopologicalCompression::~TopologicalCompression() {
@@ -155,6 +161,176 @@ unsigned int ttk::TopologicalCompression::log2(int val) {
 
 // IO.
 
+FILE *ttk::TopologicalCompression::OpenMemoryStream(
+  const unsigned char *buffer, size_t length) {
+  FILE *fm = nullptr;
+#if defined(__unix__) || defined(__APPLE__)
+  // read-only stream directly on the buffer
+  if(length > 0)
+    fm = fmemopen(const_cast<unsigned char *>(buffer), length, "rb");
+#endif
+  if(fm == nullptr) {
+    // anonymous temporary file (unique, removed when closed)
+    fm = tmpfile();
+    if(fm == nullptr)
+      return nullptr;
+    std::fwrite(buffer, sizeof(unsigned char), length, fm);
+    std::rewind(fm);
+  }
+  return fm;
+}
+
+FILE *ttk::TopologicalCompression::OpenWriteStream(char **buffer,
+                                                  size_t *length) {
+  *buffer = nullptr;
+  *length = 0;
+#if defined(__unix__) || defined(__APPLE__)
+  FILE *fm = open_memstream(buffer, length);
+  if(fm != nullptr)
+    return fm;
+#endif
+  // anonymous temporary file (unique, removed when closed)
+  return tmpfile();
+}
+
+void ttk::TopologicalCompression::CloseWriteStream(
+  FILE *fm,
+  char **buffer,
+  size_t *length,
+  std::vector<unsigned char> &content) {
+  // updates buffer and length for memory streams
+  std::fflush(fm);
+  if(*buffer != nullptr) {
+    content.assign(*buffer, *buffer + *length);
+    std::fclose(fm);
+    free(*buffer);
+    *buffer = nullptr;
+    return;
+  }
+  const long size = std::ftell(fm);
+  content.resize(size > 0 ? size : 0);
+  std::rewind(fm);
+  if(!content.empty())
+    ReadUnsignedCharArray(fm, content.data(), content.size());
+  std::fclose(fm);
+}
+
+void ttk::TopologicalCompression::GetBrickBounds(int n,
+                                                 int brickSize,
+                                                 std::vector<int> &bounds) {
+  // the remainder is spread over the bricks, so that none of them is
+  // degenerate (ZFP does not support one-dimensional arrays)
+  const int brickNumber = std::max(1, n / std::max(brickSize, 1));
+  bounds.resize(brickNumber + 1);
+  for(int i = 0; i <= brickNumber; ++i)
+    bounds[i] = (int)(((long long)i * n) / brickNumber);
+}
+
+void ttk::TopologicalCompression::EncodeChunk(
+  const std::vector<unsigned char> &raw, std::vector<unsigned char> &chunk) {
+#ifdef TTK_ENABLE_ZLIB
+  uLongf destLen = compressBound(raw.size());
+  chunk.resize(destLen);
+  CompressWithZlib(false, chunk.data(), &destLen, raw.data(), raw.size());
+  chunk.resize(destLen);
+#else
+  chunk = raw;
+#endif
+}
+
+const unsigned char *
+  ttk::TopologicalCompression::DecodeChunk(bool useZlib,
+                                           const unsigned char *source,
+                                           unsigned long sourceLength,
+                                           unsigned long rawLength,
+                                           std::vector<unsigned char> &buffer) {
+  if(!useZlib)
+    return sourceLength == rawLength ? source : nullptr;
+#ifdef TTK_ENABLE_ZLIB
+  buffer.resize(rawLength);
+  uLongf destLen = rawLength;
+  CompressWithZlib(true, buffer.data(), &destLen, source, sourceLength);
+  return destLen == rawLength ? buffer.data() : nullptr;
+#else
+  return nullptr;
+#endif
+}
+
+int ttk::TopologicalCompression::getLocalRegionOfInterest(int *roi) const {
+  int whole = 1;
+  for(int i = 0; i < 3; ++i) {
+    const int n = 1 + dataExtent_[2 * i + 1] - dataExtent_[2 * i];
+    roi[2 * i] = 0;
+    roi[2 * i + 1] = n - 1;
+    if(useRegionOfInterest_) {
+      roi[2 * i]
+        = std::max(roi[2 * i], regionOfInterest_[2 * i] - dataExtent_[2 * i]);
+      roi[2 * i + 1] = std::min(
+        roi[2 * i + 1], regionOfInterest_[2 * i + 1] - dataExtent_[2 * i]);
+    }
+    if(roi[2 * i] > roi[2 * i + 1])
+      return -1;
+    whole &= roi[2 * i] == 0 && roi[2 * i + 1] == n - 1;
+  }
+  return whole ? 0 : 1;
+}
+
+int ttk::TopologicalCompression::ExtractRegionOfInterest() {
+  int roi[6];
+  const int roiType = getLocalRegionOfInterest(roi);
+  if(roiType <= 0)
+    return roiType;
+
+  const int nx = 1 + dataExtent_[1] - dataExtent_[0];
+  const int ny = 1 + dataExtent_[3] - dataExtent_[2];
+  const int vertexNumber = decompressedData_.size();
+  const bool hasOffsets = (int)decompressedOffsets_.size() == vertexNumber;
+
+  // in place, the region of interest comes first in memory order
+  int n = 0;
+  for(int k = roi[4]; k <= roi[5]; ++k) {
+    for(int j = roi[2]; j <= roi[3]; ++j) {
+      for(int i = roi[0]; i <= roi[1]; ++i, ++n) {
+        const int id = i + nx * (j + ny * k);
+        decompressedData_[n] = decompressedData_[id];
+        if(hasOffsets)
+          decompressedOffsets_[n] = decompressedOffsets_[id];
+      }
+    }
+  }
+  decompressedData_.resize(n);
+  if(hasOffsets)
+    decompressedOffsets_.resize(n);
+
+  return 0;
+}
+
+const unsigned char *ttk::TopologicalCompression::MapFile(FILE *fp,
+                                                         size_t &length) {
+  length = 0;
+#if defined(__unix__) || defined(__APPLE__)
+  const int fd = fileno(fp);
+  struct stat st {};
+  if(fd < 0 || fstat(fd, &st) != 0 || st.st_size <= 0)
+    return nullptr;
+  void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(data == MAP_FAILED)
+    return nullptr;
+  length = st.st_size;
+  return static_cast<const unsigned char *>(data);
+#else
+  return nullptr;
+#endif
+}
+
+void ttk::TopologicalCompression::UnmapFile(const unsigned char *data,
+                                            size_t length) {
+#if defined(__unix__) || defined(__APPLE__)
+  if(data != nullptr)
+    munmap(const_cast<unsigned char *>(data), length);
+#endif
+}
+
 bool ttk::TopologicalCompression::ReadBool(FILE *fm) {
   bool b;
   int ret = (int)std::fread(&b, sizeof(bool), 1, fm);
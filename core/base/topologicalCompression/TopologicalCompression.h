@@ -132,6 +132,18 @@ namespace ttk {
       return 0;
     }
 
+    inline int setBrickSize(int brickSize) {
+      brickSize_ = brickSize;
+      return 0;
+    }
+
+    inline int setRegionOfInterest(const int *regionOfInterest) {
+      useRegionOfInterest_ = regionOfInterest != nullptr;
+      if(useRegionOfInterest_)
+        std::copy(regionOfInterest, regionOfInterest + 6, regionOfInterest_);
+      return 0;
+    }
+
     inline int setupTriangulation(Triangulation *triangulation) {
       triangulation_ = triangulation;
       if(triangulation_)
@@ -195,6 +207,15 @@ namespace ttk {
       return zfpOnly_;
     }
 
+    inline int getBrickSize() {
+      return brickSize_;
+    }
+
+    // Region of interest in local vertex coordinates (0-based, inclusive
+    // bounds), clipped to the data extent. Returns 1 if it is a strict
+    // sub-region, 0 for the whole grid and -1 if it is empty.
+    int getLocalRegionOfInterest(int *roi) const;
+
     inline const std::vector<char> &getDataArrayName() const {
       return dataArrayName_;
     }
@@ -241,6 +262,34 @@ namespace ttk {
       double &min,
       double &max,
       int &nbConstraints);
+    // Read-only stream over a memory buffer (no file on disk whenever
+    // possible), to parse the decompressed data.
+    static FILE *OpenMemoryStream(const unsigned char *buffer, size_t length);
+    // Read-only memory mapping of a whole file (nullptr if not supported).
+    static const unsigned char *MapFile(FILE *fp, size_t &length);
+    static void UnmapFile(const unsigned char *data, size_t length);
+    // Write stream into a growing memory buffer (temporary file if not
+    // supported), whose content is retrieved by CloseWriteStream.
+    static FILE *OpenWriteStream(char **buffer, size_t *length);
+    static void CloseWriteStream(FILE *fm,
+                                 char **buffer,
+                                 size_t *length,
+                                 std::vector<unsigned char> &content);
+    // Bounds [begin, end) of the bricks along an axis of n vertices (bricks
+    // of at least brickSize vertices, except if n < brickSize).
+    static void
+      GetBrickBounds(int n, int brickSize, std::vector<int> &bounds);
+    // Chunk of the bricked format (zlib-compressed if available).
+    static void EncodeChunk(const std::vector<unsigned char> &raw,
+                            std::vector<unsigned char> &chunk);
+    // Raw content of a chunk, either decompressed into buffer or pointing
+    // to source (nullptr on failure).
+    static const unsigned char *
+      DecodeChunk(bool useZlib,
+                  const unsigned char *source,
+                  unsigned long sourceLength,
+                  unsigned long rawLength,
+                  std::vector<unsigned char> &buffer);
     template <typename dataType>
     int ReadMetaData(FILE *fm);
     template <typename dataType>
@@ -350,6 +399,21 @@ namespace ttk {
     int ReadPersistenceGeometry(FILE *fm);
     template <typename dataType>
     int ReadOtherGeometry(FILE *fm);
+    template <typename dataType>
+    int ReadPersistenceBricks(FILE *fp,
+                              bool useZlib,
+                              const unsigned char *mapped,
+                              size_t mappedLength);
+    template <typename dataType>
+    int AffectSegmentValues();
+    template <typename dataType>
+    int ReconstructPersistenceGeometry(
+      std::vector<std::tuple<double, int>> &mappingsSortedPerValue,
+      double min,
+      double max,
+      int nbConstraints,
+      const int *roi);
+    int ExtractRegionOfInterest();
 
     template <typename dataType>
     int WritePersistenceTopology(FILE *fm);
@@ -363,6 +427,12 @@ namespace ttk {
                                  double *toCompress);
     template <typename dataType>
     int WriteOtherGeometry(FILE *fm);
+    template <typename dataType>
+    int WritePersistenceBricks(FILE *fp,
+                               int *dataExtent,
+                               bool zfpOnly,
+                               double zfpBitBudget,
+                               double *toCompress);
 
     template <typename dataType>
     int PerformSimplification(
@@ -405,6 +475,11 @@ namespace ttk {
     bool dontSubdivide_;
     bool useTopologicalSimplification_;
     std::vector<char> dataArrayName_{};
+    // Bricked format (segmentation and ZFP payloads split in independent
+    // bricks of brickSize_^3 vertices), 0 for a single stream.
+    int brickSize_{0};
+    bool useRegionOfInterest_{false};
+    int regionOfInterest_[6];
 
     // Persistence compression.
     std::vector<int> segmentation_;
@@ -500,6 +575,15 @@ int ttk::TopologicalCompression::WriteToFile(FILE *fp,
     numberOfVertices *= (1 + dataExtent[2 * i + 1] - dataExtent[2 * i]);
   nbVertices = numberOfVertices;
 
+  if(usePersistence && brickSize_ > 0) {
+    // [->fp] Encode and write bricks in parallel.
+    const int status = WritePersistenceBricks<double>(
+      fp, dataExtent, zfpOnly, zfpBitBudget, data);
+    fflush(fp);
+    fclose(fp);
+    return status;
+  }
+
   int totalSize = usePersistence
                     ? ComputeTotalSizeForPersistenceDiagram<double>(
                       getMapping(), getCriticalConstraints(), zfpOnly,
@@ -687,6 +771,11 @@ int ttk::TopologicalCompression::WriteMetaData(
   // 7. Array name (as unsigned chars)
   WriteConstCharArray(fp, dataArrayName.c_str(), dataArrayName.size());
 
+  // 8. Brick size (0: single stream, only for persistence compression)
+  const bool usePersistence
+    = compressionType == (int)ttk::CompressionType::PersistenceDiagram;
+  WriteInt(fp, usePersistence ? std::max(brickSize_, 0) : 0);
+
   {
     std::stringstream msg;
     msg << "[ttkCompressionWriter] Metadata successfully written." << std::endl;
@@ -718,6 +807,39 @@ int ttk::TopologicalCompression::ReadFromFile(FILE *fp) {
   std::vector<unsigned char> ddest;
   unsigned long destLen;
 
+  // Map the file to read its payload in place (nullptr if not available).
+  size_t mappedLength = 0;
+  const unsigned char *mapped = MapFile(fp, mappedLength);
+  // Payload of the given length at the current position of fp, either in
+  // the file mapping or read into ppayload.
+  std::vector<unsigned char> ppayload;
+  const auto readPayload
+    = [&](const unsigned long length) -> const unsigned char * {
+        const long offset = ftell(fp);
+        if(mapped != nullptr && offset >= 0
+           && (size_t)offset + length <= mappedLength) {
+          return mapped + offset;
+        }
+        ppayload.resize(length);
+        ReadUnsignedCharArray(fp, ppayload.data(), length);
+        return ppayload.data();
+      };
+
+  if(brickSize_ > 0) {
+    // [fp->] Decode the bricks (of the region of interest) in parallel.
+    const int status
+      = ReadPersistenceBricks<double>(fp, useZlib, mapped, mappedLength);
+    UnmapFile(mapped, mappedLength);
+    fclose(fp);
+    if(status != 0) {
+      std::stringstream msg;
+      msg << "[TopologicalCompression] Failed to read bricks!" << std::endl;
+      msg << "[TopologicalCompression] File may be corrupted!" << std::endl;
+      dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+    }
+    return status;
+  }
+
 #ifdef TTK_ENABLE_ZLIB
   if(useZlib) {
     // [fp->ff] Read compressed data.
@@ -726,9 +848,7 @@ int ttk::TopologicalCompression::ReadFromFile(FILE *fp) {
 
     unsigned long sourceLen = (uLongf)sl;
     destLen = dl;
-    std::vector<Bytef> ssource(sl);
-    Bytef *source = ssource.data();
-    ReadUnsignedCharArray(fp, source, sl);
+    const Bytef *source = readPayload(sl);
     {
       std::stringstream msg;
       msg << "[TopologicalCompression] Successfully read compressed data."
@@ -757,10 +877,9 @@ int ttk::TopologicalCompression::ReadFromFile(FILE *fp) {
     ReadUnsignedLong(fp); // Compressed size...
     unsigned long dl = ReadUnsignedLong(fp); // Uncompressed size...
 
+    // parsed in place (read-only stream)
     destLen = dl;
-    ddest.resize(destLen);
-    dest = ddest.data();
-    ReadUnsignedCharArray(fp, dest, destLen);
+    dest = const_cast<unsigned char *>(readPayload(destLen));
   }
 #else
   if(useZlib) {
@@ -771,6 +890,7 @@ int ttk::TopologicalCompression::ReadFromFile(FILE *fp) {
           << std::endl;
       dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
     }
+    UnmapFile(mapped, mappedLength);
     return -4;
   } else {
     {
@@ -784,28 +904,22 @@ int ttk::TopologicalCompression::ReadFromFile(FILE *fp) {
     ReadUnsignedLong(fp); // Compressed size...
     unsigned long dl = ReadUnsignedLong(fp); // Uncompressed size...
 
+    // parsed in place (read-only stream)
     destLen = dl;
-    ddest.resize(destLen);
-    dest = ddest.data();
-    ReadUnsignedCharArray(fp, dest, destLen);
+    dest = const_cast<unsigned char *>(readPayload(destLen));
   }
 #endif
 
-  // [fm->] Read data.
-  char *buf = reinterpret_cast<char *>(dest);
-
-  //#ifndef _MSC_VER
-  // FILE *fm = fmemopen(buf, destLen, "r+");
-  //#else
-  std::stringstream str;
-  str << fileName << ".temp";
-  const std::string s = str.str();
-  const char *ffn = s.c_str();
-  FILE *ftemp = fopen(ffn, "wb");
-  fwrite(buf, destLen, sizeof(char), ftemp);
-  fclose(ftemp);
-  FILE *fm = fopen(ffn, "rb");
-  //#endif
+  // [fm->] Read data, directly from memory.
+  FILE *fm = OpenMemoryStream(dest, destLen);
+  if(fm == nullptr) {
+    std::stringstream msg;
+    msg << "[TopologicalCompression] Could not open the decompressed data."
+        << std::endl;
+    dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
+    UnmapFile(mapped, mappedLength);
+    return -5;
+  }
 
   // Do read topology.
   if(!(zfpOnly_)) {
@@ -830,11 +944,12 @@ int ttk::TopologicalCompression::ReadFromFile(FILE *fp) {
     status = ReadOtherGeometry<double>(fm);
 
   fclose(fm);
-  // #ifdef _MSC_VER
-  remove(ffn);
-  // #endif
+  UnmapFile(mapped, mappedLength);
   fclose(fp);
 
+  if(status == 0)
+    status = ExtractRegionOfInterest();
+
   if(status == 0) {
     {
       std::stringstream msg;
@@ -915,6 +1030,7 @@ int ttk::TopologicalCompression::ReadMetaData(FILE *fm) {
 
   if(version == 0) {
     // Pre-v1 format has no scalar field array name
+    brickSize_ = 0;
     return 0;
   }
 
@@ -926,6 +1042,9 @@ int ttk::TopologicalCompression::ReadMetaData(FILE *fm) {
   dataArrayName_[dataArrayNameLength] = '\0'; // NULL-termination
   ReadCharArray(fm, dataArrayName_.data(), dataArrayNameLength);
 
+  // 8. Brick size (since v2)
+  brickSize_ = version >= 2 ? ReadInt(fm) : 0;
+
   return 0;
 }
 
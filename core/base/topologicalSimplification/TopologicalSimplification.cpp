@@ -8,9 +8,10 @@ TopologicalSimplification::TopologicalSimplification()
     inputScalarFieldPointer_{}, vertexIdentifierScalarFieldPointer_{},
     inputOffsetScalarFieldPointer_{}, considerIdentifierAsBlackList_{},
     addPerturbation_{}, outputScalarFieldPointer_{},
-    outputOffsetScalarFieldPointer_{} {
+    outputOffsetScalarFieldPointer_{}, useLegacySweeps_{} {
   considerIdentifierAsBlackList_ = false;
   addPerturbation_ = false;
+  useLegacySweeps_ = false;
 }
 
 TopologicalSimplification::~TopologicalSimplification() {
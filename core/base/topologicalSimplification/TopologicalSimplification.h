@@ -28,10 +28,12 @@
 #include <Wrapper.h>
 
 #include <Triangulation.h>
+#include <algorithm>
 #include <cmath>
 #include <set>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 namespace ttk {
 
@@ -55,14 +57,19 @@ namespace ttk {
     bool
       operator()(const std::tuple<dataType, SimplexId, SimplexId> &v0,
                  const std::tuple<dataType, SimplexId, SimplexId> &v1) const {
+      // (vertex identifiers only break the ties of duplicate offsets)
       if(isIncreasingOrder_) {
         return (std::get<0>(v0) < std::get<0>(v1)
                 or (std::get<0>(v0) == std::get<0>(v1)
-                    and std::get<1>(v0) < std::get<1>(v1)));
+                    and (std::get<1>(v0) < std::get<1>(v1)
+                         or (std::get<1>(v0) == std::get<1>(v1)
+                             and std::get<2>(v0) < std::get<2>(v1)))));
       } else {
         return (std::get<0>(v0) > std::get<0>(v1)
                 or (std::get<0>(v0) == std::get<0>(v1)
-                    and std::get<1>(v0) > std::get<1>(v1)));
+                    and (std::get<1>(v0) > std::get<1>(v1)
+                         or (std::get<1>(v0) == std::get<1>(v1)
+                             and std::get<2>(v0) > std::get<2>(v1)))));
       }
     };
   };
@@ -110,6 +117,44 @@ namespace ttk {
     template <typename dataType, typename idType>
     int execute() const;
 
+    /// Original implementation: both sweeps of an iteration process the
+    /// whole domain with a std::set front, and the convergence is tested by
+    /// extracting all the extrema of the field.
+    template <typename dataType>
+    int simplifyLegacy(dataType *scalars,
+                       SimplexId *offsets,
+                       std::vector<bool> &extrema,
+                       int &iteration) const;
+
+    /// Default implementation: the connected components of the domain are
+    /// swept independently (and concurrently), with binary heaps and
+    /// buffers allocated once. The critical types are only updated around
+    /// the vertices whose order changed during an iteration, and converged
+    /// components are not swept anymore.
+    template <typename dataType>
+    int simplifyHeap(dataType *scalars,
+                     SimplexId *offsets,
+                     std::vector<bool> &extrema,
+                     int &iteration) const;
+
+    /// Sweeps a connected component in increasing (from its minima) or
+    /// decreasing (from its maxima) order and flattens the scalars that
+    /// break the sweep order. The vertices of the component are stored in
+    /// the sweep order in sequence[first, first + size), and the vertices
+    /// whose order changed are flagged in modified.
+    template <typename dataType>
+    int sweepComponent(
+      dataType *scalars,
+      SimplexId *offsets,
+      const std::vector<SimplexId> &seeds,
+      const bool isIncreasingOrder,
+      const SimplexId first,
+      const SimplexId size,
+      std::vector<std::tuple<dataType, SimplexId, SimplexId>> &heap,
+      std::vector<char> &visited,
+      std::vector<SimplexId> &sequence,
+      std::vector<char> &modified) const;
+
     inline int setupTriangulation(Triangulation *triangulation) {
       triangulation_ = triangulation;
       if(triangulation_) {
@@ -164,6 +209,11 @@ namespace ttk {
       return 0;
     }
 
+    inline int setUseLegacySweeps(bool onOff) {
+      useLegacySweeps_ = onOff;
+      return 0;
+    }
+
   protected:
     Triangulation *triangulation_;
     SimplexId vertexNumber_;
@@ -175,6 +225,7 @@ namespace ttk {
     bool addPerturbation_;
     void *outputScalarFieldPointer_;
     void *outputOffsetScalarFieldPointer_;
+    bool useLegacySweeps_;
   };
 } // namespace ttk
 
@@ -348,6 +399,31 @@ int ttk::TopologicalSimplification::execute() const {
       extrema[identifierId] = true;
   }
 
+  int iteration{};
+  const int status
+    = useLegacySweeps_
+        ? simplifyLegacy<dataType>(scalars, offsets, extrema, iteration)
+        : simplifyHeap<dataType>(scalars, offsets, extrema, iteration);
+  if(status)
+    return status;
+
+  {
+    std::stringstream msg;
+    msg << "[TopologicalSimplification] Scalar field simplified"
+        << " in " << t.getElapsedTime() << " s. (" << threadNumber_
+        << " threads(s), " << iteration << " ite.)." << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+template <typename dataType>
+int ttk::TopologicalSimplification::simplifyLegacy(dataType *scalars,
+                                                   SimplexId *offsets,
+                                                   std::vector<bool> &extrema,
+                                                   int &iteration) const {
+
   std::vector<SimplexId> authorizedMinima;
   std::vector<SimplexId> authorizedMaxima;
   std::vector<bool> authorizedExtrema(vertexNumber_, false);
@@ -367,7 +443,6 @@ int ttk::TopologicalSimplification::execute() const {
   SweepCmp cmp;
 
   // processing
-  int iteration{};
   for(SimplexId i = 0; i < vertexNumber_; ++i) {
 
     {
@@ -492,12 +567,300 @@ int ttk::TopologicalSimplification::execute() const {
       break;
   }
 
+  return 0;
+}
+
+template <typename dataType>
+int ttk::TopologicalSimplification::sweepComponent(
+  dataType *scalars,
+  SimplexId *offsets,
+  const std::vector<SimplexId> &seeds,
+  const bool isIncreasingOrder,
+  const SimplexId first,
+  const SimplexId size,
+  std::vector<std::tuple<dataType, SimplexId, SimplexId>> &heap,
+  std::vector<char> &visited,
+  std::vector<SimplexId> &sequence,
+  std::vector<char> &modified) const {
+
+  // the top of the heap is the lowest (resp. highest) vertex
+  const SweepCmp cmp(!isIncreasingOrder);
+
+  heap.clear();
+  for(SimplexId k : seeds) {
+    heap.emplace_back(scalars[k], offsets[k], k);
+    visited[k] = true;
+  }
+  std::make_heap(heap.begin(), heap.end(), cmp);
+
+  // growth by neighborhood of the seeds
+  SimplexId adjustmentPos = first;
+  while(!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), cmp);
+    const SimplexId vertexId = std::get<2>(heap.back());
+    heap.pop_back();
+
+    SimplexId neighborNumber
+      = triangulation_->getVertexNeighborNumber(vertexId);
+    for(SimplexId k = 0; k < neighborNumber; ++k) {
+      SimplexId neighbor;
+      triangulation_->getVertexNeighbor(vertexId, k, neighbor);
+      if(!visited[neighbor]) {
+        heap.emplace_back(scalars[neighbor], offsets[neighbor], neighbor);
+        std::push_heap(heap.begin(), heap.end(), cmp);
+        visited[neighbor] = true;
+      }
+    }
+    sequence[adjustmentPos] = vertexId;
+    ++adjustmentPos;
+  }
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(adjustmentPos != first + size)
+    return -1;
+#endif
+
+  // save offsets and rearrange scalars (the component gets the offsets
+  // first + 1 to first + size)
+  for(SimplexId k = first; k < first + size; ++k) {
+    const SimplexId vertexId = sequence[k];
+    visited[vertexId] = false;
+
+    if(k > first) {
+      const dataType previous = scalars[sequence[k - 1]];
+      if((isIncreasingOrder and scalars[vertexId] <= previous)
+         or (!isIncreasingOrder and scalars[vertexId] >= previous)) {
+        scalars[vertexId] = previous;
+        modified[vertexId] = true;
+      }
+    }
+    offsets[vertexId]
+      = isIncreasingOrder ? k + 1 : first + size - (k - first);
+  }
+
+  return 0;
+}
+
+template <typename dataType>
+int ttk::TopologicalSimplification::simplifyHeap(dataType *scalars,
+                                                 SimplexId *offsets,
+                                                 std::vector<bool> &extrema,
+                                                 int &iteration) const {
+
+  // critical types of all the vertices (updated incrementally)
+  std::vector<char> types(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < vertexNumber_; ++k)
+    types[k] = getCriticalType<dataType>(k, scalars, offsets);
+
+  // connected components of the domain: the vertices of a component are
+  // stored in the range [componentFirst[c], componentFirst[c + 1]) of the
+  // sweep sequence
+  std::vector<SimplexId> component(vertexNumber_, -1);
+  std::vector<SimplexId> componentFirst{0};
+  std::vector<SimplexId> sequence(vertexNumber_);
+  {
+    SimplexId visitedNumber = 0;
+    for(SimplexId k = 0; k < vertexNumber_; ++k) {
+      if(component[k] != -1)
+        continue;
+      const SimplexId c = componentFirst.size() - 1;
+      component[k] = c;
+      SimplexId queuePos = visitedNumber;
+      sequence[visitedNumber++] = k;
+      while(queuePos < visitedNumber) {
+        const SimplexId vertexId = sequence[queuePos++];
+        SimplexId neighborNumber
+          = triangulation_->getVertexNeighborNumber(vertexId);
+        for(SimplexId i = 0; i < neighborNumber; ++i) {
+          SimplexId neighbor;
+          triangulation_->getVertexNeighbor(vertexId, i, neighbor);
+          if(component[neighbor] == -1) {
+            component[neighbor] = c;
+            sequence[visitedNumber++] = neighbor;
+          }
+        }
+      }
+      componentFirst.emplace_back(visitedNumber);
+    }
+  }
+  const SimplexId componentNumber = componentFirst.size() - 1;
+
+  // seeds and number of unauthorized extrema per component
+  std::vector<bool> authorizedExtrema(vertexNumber_, false);
+  std::vector<std::vector<SimplexId>> authorizedMinima(componentNumber);
+  std::vector<std::vector<SimplexId>> authorizedMaxima(componentNumber);
+  std::vector<SimplexId> unauthorizedNumber(componentNumber, 0);
+  SimplexId minimumNumber = 0, maximumNumber = 0;
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    if(!types[k])
+      continue;
+    if(considerIdentifierAsBlackList_ xor extrema[k]) {
+      authorizedExtrema[k] = true;
+      if(types[k] < 0) {
+        authorizedMinima[component[k]].emplace_back(k);
+        minimumNumber++;
+      } else {
+        authorizedMaxima[component[k]].emplace_back(k);
+        maximumNumber++;
+      }
+    } else {
+      unauthorizedNumber[component[k]]++;
+    }
+  }
+
   {
     std::stringstream msg;
-    msg << "[TopologicalSimplification] Scalar field simplified"
-        << " in " << t.getElapsedTime() << " s. (" << threadNumber_
-        << " threads(s), " << iteration << " ite.)." << std::endl;
-    dMsg(std::cout, msg.str(), timeMsg);
+    msg << "[TopologicalSimplification] Maintaining " << constraintNumber_
+        << " constraints (" << minimumNumber << " minima and "
+        << maximumNumber << " maxima, " << componentNumber
+        << " component(s))." << std::endl;
+    dMsg(std::cout, msg.str(), advancedInfoMsg);
+  }
+
+  if(!minimumNumber or !maximumNumber)
+    return -1;
+
+  // components without seeds cannot be simplified: their offsets are only
+  // renumbered (in the range of the component), without changing the order
+  std::vector<SimplexId> activeComponents;
+  for(SimplexId c = 0; c < componentNumber; ++c) {
+    if(!authorizedMinima[c].empty() and !authorizedMaxima[c].empty()) {
+      activeComponents.emplace_back(c);
+      continue;
+    }
+    if(unauthorizedNumber[c]) {
+      std::stringstream msg;
+      msg << "[TopologicalSimplification] Component #" << c
+          << " has no constraint, skipping it." << std::endl;
+      dMsg(std::cerr, msg.str(), infoMsg);
+    }
+    std::sort(sequence.begin() + componentFirst[c],
+              sequence.begin() + componentFirst[c + 1],
+              [&scalars, &offsets](const SimplexId a, const SimplexId b) {
+                return scalars[a] < scalars[b]
+                       or (scalars[a] == scalars[b] and offsets[a] < offsets[b])
+                       or (scalars[a] == scalars[b] and offsets[a] == offsets[b]
+                           and a < b);
+              });
+    for(SimplexId k = componentFirst[c]; k < componentFirst[c + 1]; ++k)
+      offsets[sequence[k]] = k + 1;
+  }
+
+  // buffers reused by all the sweeps
+  std::vector<char> visited(vertexNumber_, false);
+  std::vector<char> modified(vertexNumber_, false);
+  std::vector<char> dirty(vertexNumber_, false);
+  std::vector<std::vector<std::tuple<dataType, SimplexId, SimplexId>>> heaps(
+    std::max(threadNumber_, 1));
+
+  int status = 0;
+
+  // processing
+  for(SimplexId i = 0; i < vertexNumber_; ++i) {
+
+    {
+      std::stringstream msg;
+      msg << "[TopologicalSimplification] Starting simplifying iteration #" << i
+          << " (" << activeComponents.size() << " component(s))..."
+          << std::endl;
+      dMsg(std::cout, msg.str(), advancedInfoMsg);
+    }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threadNumber_)
+#endif
+    for(size_t j = 0; j < activeComponents.size(); ++j) {
+      const SimplexId c = activeComponents[j];
+      const SimplexId first = componentFirst[c];
+      const SimplexId size = componentFirst[c + 1] - first;
+#ifdef TTK_ENABLE_OPENMP
+      auto &heap = heaps[omp_get_thread_num()];
+#else
+      auto &heap = heaps[0];
+#endif
+
+      if(sweepComponent<dataType>(scalars, offsets, authorizedMinima[c], true,
+                                  first, size, heap, visited, sequence,
+                                  modified)
+         or sweepComponent<dataType>(scalars, offsets, authorizedMaxima[c],
+                                     false, first, size, heap, visited,
+                                     sequence, modified)) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic write
+#endif
+        status = -1;
+        continue;
+      }
+
+      // the order of two vertices can only change if one of them has been
+      // modified: update the types of the modified vertices and of their
+      // neighbors
+      std::vector<SimplexId> dirtyVertices;
+      for(SimplexId k = first; k < first + size; ++k) {
+        const SimplexId vertexId = sequence[k];
+        if(!modified[vertexId])
+          continue;
+        modified[vertexId] = false;
+        if(!dirty[vertexId]) {
+          dirty[vertexId] = true;
+          dirtyVertices.emplace_back(vertexId);
+        }
+        SimplexId neighborNumber
+          = triangulation_->getVertexNeighborNumber(vertexId);
+        for(SimplexId l = 0; l < neighborNumber; ++l) {
+          SimplexId neighbor;
+          triangulation_->getVertexNeighbor(vertexId, l, neighbor);
+          if(!dirty[neighbor]) {
+            dirty[neighbor] = true;
+            dirtyVertices.emplace_back(neighbor);
+          }
+        }
+      }
+
+      for(SimplexId vertexId : dirtyVertices) {
+        dirty[vertexId] = false;
+        const bool wasUnauthorized
+          = types[vertexId] and !authorizedExtrema[vertexId];
+        types[vertexId]
+          = getCriticalType<dataType>(vertexId, scalars, offsets);
+        const bool isUnauthorized
+          = types[vertexId] and !authorizedExtrema[vertexId];
+        unauthorizedNumber[c] += (SimplexId)isUnauthorized - wasUnauthorized;
+      }
+    }
+
+    if(status)
+      return status;
+
+    // optional adding of perturbation
+    if(addPerturbation_)
+      addPerturbation<dataType>(scalars, offsets);
+
+    ++iteration;
+
+    // test convergence
+    SimplexId remainingNumber = 0;
+    std::vector<SimplexId> nextComponents;
+    for(SimplexId c : activeComponents) {
+      if(unauthorizedNumber[c]) {
+        remainingNumber += unauthorizedNumber[c];
+        nextComponents.emplace_back(c);
+      }
+    }
+    activeComponents.swap(nextComponents);
+
+    {
+      std::stringstream msg;
+      msg << "[TopologicalSimplification] Current status: " << remainingNumber
+          << " extrema to remove." << std::endl;
+      dMsg(std::cout, msg.str(), advancedInfoMsg);
+    }
+
+    if(activeComponents.empty())
+      break;
   }
 
   return 0;
@@ -1 +1,161 @@
-// This file needs to exist for the Mac compiler
\ No newline at end of file
+#include <TrackingFromOverlap.h>
+
+// =============================================================================
+// Track Nodes
+// =============================================================================
+int ttk::TrackingFromOverlap::computeOverlap(const SortedPoints &sortedPoints0,
+                                             const SortedPoints &sortedPoints1,
+
+                                             Edges &edges) const {
+  dMsg(cout, "[ttkTrackingFromOverlap] Tracking .............. ", timeMsg);
+  Timer t;
+
+  const size_t nPoints0 = sortedPoints0.size();
+  const size_t nPoints1 = sortedPoints1.size();
+  const auto &points0 = sortedPoints0.points;
+  const auto &points1 = sortedPoints1.points;
+
+  // An edge (nodeIndex0, nodeIndex1) is encoded by a single key
+  const size_t nNodes1 = sortedPoints1.nNodes;
+
+  // -------------------------------------------------------------------------
+  // Split the first point set into chunks (without splitting points with
+  // equal coordinates) and find where each chunk starts in the second set
+  // -------------------------------------------------------------------------
+  const size_t nChunks = std::max(
+    (size_t)1, std::min((size_t)std::max(threadNumber_, 1) * 4, nPoints0));
+
+  vector<size_t> chunkBegin0(nChunks + 1, nPoints0);
+  vector<size_t> chunkBegin1(nChunks + 1, nPoints1);
+  chunkBegin0[0] = 0;
+  chunkBegin1[0] = 0;
+  for(size_t c = 1; c < nChunks; c++) {
+    size_t i = std::max(chunkBegin0[c - 1], c * nPoints0 / nChunks);
+    while(i > 0 && i < nPoints0
+          && compareCoordinates(points0[i], points0[i - 1]) == 0)
+      i++;
+    chunkBegin0[c] = i;
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(size_t c = 1; c < nChunks; c++) {
+    const size_t i = chunkBegin0[c];
+    if(i == nPoints0)
+      continue;
+    // first point of the second set that is not in front of point i
+    size_t low = 0, high = nPoints1;
+    while(low < high) {
+      const size_t mid = low + (high - low) / 2;
+      if(compareCoordinates(points1[mid], points0[i]) < 0)
+        low = mid + 1;
+      else
+        high = mid;
+    }
+    chunkBegin1[c] = low;
+  }
+
+  // -------------------------------------------------------------------------
+  // Merge the chunks: overlapping points emit their (key, count) edge into a
+  // per-chunk buffer, which is then sorted and reduced
+  // -------------------------------------------------------------------------
+  vector<vector<pair<size_t, size_t>>> chunkEdges(nChunks);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threadNumber_)
+#endif
+  for(size_t c = 0; c < nChunks; c++) {
+    auto &buffer = chunkEdges[c];
+
+    size_t i = chunkBegin0[c]; // iterator for 0
+    size_t j = chunkBegin1[c]; // iterator for 1
+    const size_t iEnd = chunkBegin0[c + 1];
+
+    // Iterate over both point sets synchronously using comparison function
+    while(i < iEnd && j < nPoints1) {
+      const int cmp = compareCoordinates(points0[i], points1[j]);
+
+      if(cmp == 0) { // Points have same coordinates -> track
+        const size_t key
+          = (size_t)points0[i].nodeIndex * nNodes1 + points1[j].nodeIndex;
+
+        // Neighboring points mostly belong to the same edge
+        if(!buffer.empty() && buffer.back().first == key)
+          buffer.back().second++;
+        else
+          buffer.emplace_back(key, 1);
+
+        i++;
+        j++;
+      } else if(cmp < 0) { // p1 in front of p0 -> let p0 catch up
+        i++;
+      } else { // p0 in front of p1 -> let p1 catch up
+        j++;
+      }
+    }
+
+    // Reduce the buffer
+    if(!buffer.empty()) {
+      sort(buffer.begin(), buffer.end());
+      size_t q = 0;
+      for(size_t k = 1; k < buffer.size(); k++) {
+        if(buffer[k].first == buffer[q].first)
+          buffer[q].second += buffer[k].second;
+        else
+          buffer[++q] = buffer[k];
+      }
+      buffer.resize(q + 1);
+    }
+  }
+
+  // -------------------------------------------------------------------------
+  // Reduce the chunk buffers
+  // -------------------------------------------------------------------------
+  vector<pair<size_t, size_t>> allEdges;
+  {
+    size_t nChunkEdges = 0;
+    for(const auto &buffer : chunkEdges)
+      nChunkEdges += buffer.size();
+    allEdges.reserve(nChunkEdges);
+    for(auto &buffer : chunkEdges) {
+      allEdges.insert(allEdges.end(), buffer.begin(), buffer.end());
+      vector<pair<size_t, size_t>>().swap(buffer);
+    }
+  }
+  PSORT(allEdges.begin(), allEdges.end());
+
+  size_t nEdges = 0;
+  for(size_t k = 0; k < allEdges.size(); k++) {
+    if(nEdges > 0 && allEdges[nEdges - 1].first == allEdges[k].first)
+      allEdges[nEdges - 1].second += allEdges[k].second;
+    else
+      allEdges[nEdges++] = allEdges[k];
+  }
+
+  // -------------------------------------------------------------------------
+  // Pack Output
+  // -------------------------------------------------------------------------
+  {
+    edges.resize(nEdges * 4);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(size_t k = 0; k < nEdges; k++) {
+      edges[k * 4] = allEdges[k].first / nNodes1;
+      edges[k * 4 + 1] = allEdges[k].first % nNodes1;
+      edges[k * 4 + 2] = allEdges[k].second;
+      edges[k * 4 + 3] = -1;
+    }
+  }
+
+  // Print Status
+  {
+    stringstream msg;
+    msg << "done (#" << nEdges << " in " << t.getElapsedTime() << " s)."
+        << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 1;
+}
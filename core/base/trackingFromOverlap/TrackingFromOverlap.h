@@ -22,8 +22,10 @@
 
 #include <algorithm>
 #include <boost/variant.hpp>
-#include <map>
-#include <unordered_map>
+
+#if defined(__GNUC__) && !defined(__clang__)
+#include <parallel/algorithm>
+#endif
 
 // base code includes
 #include <Wrapper.h>
@@ -65,47 +67,57 @@ struct Node {
 using Edges = vector<idType>; // [index0, index1, overlap, branch,...]
 using Nodes = vector<Node>;
 
-struct CoordinateComparator {
-  const float *coordinates;
+// Point of a labeled point set (16 bytes, to keep sorting cache friendly)
+struct LabeledPoint {
+  float x{};
+  float y{};
+  float z{};
+  unsigned int nodeIndex{};
+};
 
-  CoordinateComparator(const float *coords) : coordinates(coords){};
+// Labeled point set sorted by x, y, and then z coordinate (and node index)
+struct SortedPoints {
+  vector<LabeledPoint> points{};
+  size_t nNodes{0};
 
-  inline bool operator()(const size_t &i, const size_t &j) {
-    size_t ic = i * 3;
-    size_t jc = j * 3;
-    return coordinates[ic] == coordinates[jc]
-             ? coordinates[ic + 1] == coordinates[jc + 1]
-                 ? coordinates[ic + 2] < coordinates[jc + 2]
-                 : coordinates[ic + 1] < coordinates[jc + 1]
-             : coordinates[ic] < coordinates[jc];
+  inline size_t size() const {
+    return points.size();
   }
 };
 
+/* Function that determines configuration of point p0 and p1:
+    0: p0Coords = p1Coords
+   <0: p0Coords < p1Coords
+   >0: p0Coords > p1Coords
+*/
+inline int compareCoordinates(const LabeledPoint &p0, const LabeledPoint &p1) {
+  return p0.x == p1.x ? p0.y == p1.y ? p0.z == p1.z ? 0 : p0.z < p1.z ? -1 : 1
+                                     : p0.y < p1.y ? -1 : 1
+                      : p0.x < p1.x ? -1 : 1;
+}
+
 namespace ttk {
+#if defined(_GLIBCXX_PARALLEL_FEATURES_H) && defined(TTK_ENABLE_OPENMP)
+#define PSORT                               \
+  omp_set_num_threads(this->threadNumber_); \
+  __gnu_parallel::sort
+#else
+#define PSORT std::sort
+#endif // _GLIBCXX_PARALLEL_FEATURES_H && TTK_ENABLE_OPENMP
+
   class TrackingFromOverlap : public Debug {
   public:
     TrackingFromOverlap(){};
     ~TrackingFromOverlap(){};
 
-    // This function sorts points based on their x, y, and then z coordinate
-    int sortCoordinates(const float *pointCoordinates,
-                        const size_t nPoints,
-                        vector<size_t> &sortedIndicies) const {
-      dMsg(cout, "[ttkTrackingFromOverlap] Sorting coordinates ... ", timeMsg);
-      Timer t;
-
-      sortedIndicies.resize(nPoints);
-      for(size_t i = 0; i < nPoints; i++)
-        sortedIndicies[i] = i;
-      CoordinateComparator c = CoordinateComparator(pointCoordinates);
-      sort(sortedIndicies.begin(), sortedIndicies.end(), c);
-
-      stringstream msg;
-      msg << "done (" << t.getElapsedTime() << " s)." << endl;
-      dMsg(cout, msg.str(), timeMsg);
-
-      return 1;
-    }
+    // This function sorts a labeled point set based on the x, y, and then z
+    // coordinate of its points. The result can be reused for all overlap
+    // computations involving this point set.
+    template <typename labelType>
+    int sortPoints(const float *pointCoordinates,
+                   const labelType *pointLabels,
+                   const size_t nPoints,
+                   SortedPoints &sortedPoints) const;
 
     int computeBranches(vector<Edges> &timeEdgesMap,
                         vector<Nodes> &timeNodesMap) const {
@@ -205,12 +217,13 @@ namespace ttk {
       return 1;
     }
 
-    // This function sorts all unique lables of a point set and then maps these
-    // lables to their respective index in the sorted list
+    // This function sorts all unique labels of a point set and then maps the
+    // label of each point to its respective index in the sorted list
     template <typename labelType>
-    int computeLabelIndexMap(const labelType *pointLabels,
-                             const size_t nPoints,
-                             map<labelType, size_t> &labelIndexMap) const;
+    int computeNodeIndices(const labelType *pointLabels,
+                           const size_t nPoints,
+                           vector<idType> &nodeIndices,
+                           size_t &nNodes) const;
 
     // This function computes all nodes and their properties based on a labeled
     // point set
@@ -220,6 +233,13 @@ namespace ttk {
                      const size_t nPoints,
                      Nodes &nodes) const;
 
+    // This function computes the overlap between two sorted labeled point
+    // sets (edges are ordered by node index of the first, then second set)
+    int computeOverlap(const SortedPoints &sortedPoints0,
+                       const SortedPoints &sortedPoints1,
+
+                       Edges &edges) const;
+
     // This function computes the overlap between two labeled point sets
     template <typename labelType>
     int computeOverlap(const float *pointCoordinates0,
@@ -236,18 +256,75 @@ namespace ttk {
 } // namespace ttk
 
 // =============================================================================
-// Compute LabelIndexMap
+// Compute NodeIndices
 // =============================================================================
 template <typename labelType>
-int ttk::TrackingFromOverlap::computeLabelIndexMap(
-  const labelType *pointLabels,
-  const size_t nPoints,
-  map<labelType, size_t> &labelIndexMap) const {
+int ttk::TrackingFromOverlap::computeNodeIndices(const labelType *pointLabels,
+                                                 const size_t nPoints,
+                                                 vector<idType> &nodeIndices,
+                                                 size_t &nNodes) const {
+  // Neighboring points mostly have the same label
+  vector<labelType> labels;
   for(size_t i = 0; i < nPoints; i++)
-    labelIndexMap[pointLabels[i]] = 0;
-  size_t i = 0;
-  for(auto &it : labelIndexMap)
-    it.second = i++;
+    if(i == 0 || !(pointLabels[i] == pointLabels[i - 1]))
+      labels.push_back(pointLabels[i]);
+  PSORT(labels.begin(), labels.end());
+  labels.erase(unique(labels.begin(), labels.end()), labels.end());
+  nNodes = labels.size();
+
+  nodeIndices.resize(nPoints);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(size_t i = 0; i < nPoints; i++)
+    nodeIndices[i]
+      = lower_bound(labels.begin(), labels.end(), pointLabels[i])
+        - labels.begin();
+
+  return 1;
+}
+
+// =============================================================================
+// Sort Points
+// =============================================================================
+template <typename labelType>
+int ttk::TrackingFromOverlap::sortPoints(const float *pointCoordinates,
+                                         const labelType *pointLabels,
+                                         const size_t nPoints,
+                                         SortedPoints &sortedPoints) const {
+  dMsg(cout, "[ttkTrackingFromOverlap] Sorting coordinates ... ", timeMsg);
+  Timer t;
+
+  vector<idType> nodeIndices;
+  this->computeNodeIndices<labelType>(
+    pointLabels, nPoints, nodeIndices, sortedPoints.nNodes);
+
+  // Points are sorted by value (not through an index list) to keep the
+  // comparisons cache friendly
+  auto &points = sortedPoints.points;
+  points.resize(nPoints);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(size_t i = 0; i < nPoints; i++) {
+    points[i].x = pointCoordinates[i * 3];
+    points[i].y = pointCoordinates[i * 3 + 1];
+    points[i].z = pointCoordinates[i * 3 + 2];
+    points[i].nodeIndex = nodeIndices[i];
+  }
+
+  // Points with equal coordinates are ordered by node index so that the
+  // overlap does not depend on the sorting algorithm
+  PSORT(points.begin(), points.end(),
+        [](const LabeledPoint &p0, const LabeledPoint &p1) {
+          const int c = compareCoordinates(p0, p1);
+          return c == 0 ? p0.nodeIndex < p1.nodeIndex : c < 0;
+        });
+
+  stringstream msg;
+  msg << "done (" << t.getElapsedTime() << " s)." << endl;
+  dMsg(cout, msg.str(), timeMsg);
+
   return 1;
 }
 
@@ -263,15 +340,14 @@ int ttk::TrackingFromOverlap::computeNodes(const float *pointCoordinates,
 
   Timer t;
 
-  map<labelType, size_t> labelIndexMap;
-  this->computeLabelIndexMap(pointLabels, nPoints, labelIndexMap);
-
-  size_t nNodes = labelIndexMap.size();
+  vector<idType> nodeIndices;
+  size_t nNodes = 0;
+  this->computeNodeIndices(pointLabels, nPoints, nodeIndices, nNodes);
 
   nodes.resize(nNodes);
   for(size_t i = 0, q = 0; i < nPoints; i++) {
     labelType label = pointLabels[i];
-    Node &n = nodes[labelIndexMap[label]];
+    Node &n = nodes[nodeIndices[i]];
     n.label = label;
     n.size++;
     n.x += pointCoordinates[q++];
@@ -310,124 +386,12 @@ int ttk::TrackingFromOverlap::computeOverlap(const float *pointCoordinates0,
                                              const size_t nPoints1,
 
                                              Edges &edges) const {
-  // -------------------------------------------------------------------------
-  // Compute labelIndexMaps
-  // -------------------------------------------------------------------------
-  map<labelType, size_t> labelIndexMap0;
-  map<labelType, size_t> labelIndexMap1;
-  this->computeLabelIndexMap<labelType>(pointLabels0, nPoints0, labelIndexMap0);
-  this->computeLabelIndexMap<labelType>(pointLabels1, nPoints1, labelIndexMap1);
-
-  // -------------------------------------------------------------------------
-  // Sort coordinates
-  // -------------------------------------------------------------------------
-  vector<size_t> sortedIndicies0;
-  vector<size_t> sortedIndicies1;
-  this->sortCoordinates(pointCoordinates0, nPoints0, sortedIndicies0);
-  this->sortCoordinates(pointCoordinates1, nPoints1, sortedIndicies1);
-
-  // -------------------------------------------------------------------------
-  // Track Nodes
-  // -------------------------------------------------------------------------
-  dMsg(cout, "[ttkTrackingFromOverlap] Tracking .............. ", timeMsg);
-  Timer t;
-
-  /* Function that determines configuration of point p0 and p1:
-      0: p0Coords = p1Coords
-     >0: p0Coords < p1Coords
-     <0: p0Coords > p1Coords
-  */
-  auto compare = [&](size_t p0, size_t p1) {
-    size_t p0CoordIndex = p0 * 3;
-    size_t p1CoordIndex = p1 * 3;
-
-    float p0_X = pointCoordinates0[p0CoordIndex++];
-    float p0_Y = pointCoordinates0[p0CoordIndex++];
-    float p0_Z = pointCoordinates0[p0CoordIndex];
-
-    float p1_X = pointCoordinates1[p1CoordIndex++];
-    float p1_Y = pointCoordinates1[p1CoordIndex++];
-    float p1_Z = pointCoordinates1[p1CoordIndex];
-
-    return p0_X == p1_X ? p0_Y == p1_Y ? p0_Z == p1_Z ? 0 : p0_Z < p1_Z ? -1 : 1
-                                       : p0_Y < p1_Y ? -1 : 1
-                        : p0_X < p1_X ? -1 : 1;
-  };
-
-  size_t i = 0; // iterator for 0
-  size_t j = 0; // iterator for 1
-
-  size_t nEdges = 0;
-  unordered_map<size_t, unordered_map<size_t, size_t>> edgesMap;
-  // Iterate over both point sets synchronously using comparison function
-  while(i < nPoints0 && j < nPoints1) {
-    size_t pointIndex0 = sortedIndicies0[i];
-    size_t pointIndex1 = sortedIndicies1[j];
-
-    // Determine point configuration
-    int c = compare(pointIndex0, pointIndex1);
-
-    if(c == 0) { // Points have same coordinates -> track
-      labelType label0 = pointLabels0[pointIndex0];
-      labelType label1 = pointLabels1[pointIndex1];
-
-      size_t &nodeIndex0 = labelIndexMap0[label0];
-      size_t &nodeIndex1 = labelIndexMap1[label1];
-
-      // Find edge and increase overlap counter
-      auto edges0 = edgesMap.find(nodeIndex0); // Edges from label0 to nodes1
-
-      // If map does not exist then create it
-      if(edges0 == edgesMap.end()) {
-        edgesMap[nodeIndex0] = unordered_map<size_t, size_t>();
-        edges0 = edgesMap.find(nodeIndex0);
-      }
-
-      // Find edge label0 -> label1
-      auto edge = edges0->second.find(nodeIndex1);
-
-      // If edge does not exist then create it
-      if(edge == edges0->second.end()) {
-        edges0->second[nodeIndex1] = 0;
-        edge = edges0->second.find(nodeIndex1);
-        nEdges++;
-      }
-
-      // Increase overlap
-      edge->second++;
-
-      i++;
-      j++;
-    } else if(c > 0) { // p0 in front of p1 -> let p1 catch up
-      j++;
-    } else { // p1 in front of p0 -> let p0 catch up
-      i++;
-    }
-  }
-
-  // -------------------------------------------------------------------------
-  // Pack Output
-  // -------------------------------------------------------------------------
-  {
-    edges.resize(nEdges * 4);
-    size_t q = 0;
-    for(auto &it0 : edgesMap) {
-      for(auto &it1 : it0.second) {
-        edges[q++] = it0.first;
-        edges[q++] = it1.first;
-        edges[q++] = it1.second;
-        edges[q++] = -1;
-      }
-    }
-  }
-
-  // Print Status
-  {
-    stringstream msg;
-    msg << "done (#" << nEdges << " in " << t.getElapsedTime() << " s)."
-        << endl;
-    dMsg(cout, msg.str(), timeMsg);
-  }
-
-  return 0;
+  SortedPoints sortedPoints0;
+  SortedPoints sortedPoints1;
+  this->sortPoints<labelType>(
+    pointCoordinates0, pointLabels0, nPoints0, sortedPoints0);
+  this->sortPoints<labelType>(
+    pointCoordinates1, pointLabels1, nPoints1, sortedPoints1);
+
+  return this->computeOverlap(sortedPoints0, sortedPoints1, edges);
 }
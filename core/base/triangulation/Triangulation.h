@@ -1801,6 +1801,9 @@ namespace ttk {
     /// \return Returns 0 upon success, negative values otherwise.
     /// \sa isEdgeOnBoundary()
     inline int preconditionBoundaryEdges() {
+      const auto span = preconditionSpan(
+        "preconditionBoundaryEdges",
+        &AbstractTriangulation::hasPreconditionedBoundaryEdges_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1822,6 +1825,9 @@ namespace ttk {
     /// \return Returns 0 upon success, negative values otherwise.
     /// \sa isTriangleOnBoundary()
     inline int preconditionBoundaryTriangles() {
+      const auto span = preconditionSpan(
+        "preconditionBoundaryTriangles",
+        &AbstractTriangulation::hasPreconditionedBoundaryTriangles_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1844,6 +1850,9 @@ namespace ttk {
     /// \return Returns 0 upon success, negative values otherwise.
     /// \sa isVertexOnBoundary()
     inline int preconditionBoundaryVertices() {
+      const auto span = preconditionSpan(
+        "preconditionBoundaryVertices",
+        &AbstractTriangulation::hasPreconditionedBoundaryVertices_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1867,6 +1876,9 @@ namespace ttk {
     /// \sa getCellEdge()
     /// \sa getCellEdgeNumber()
     inline int preconditionCellEdges() {
+      const auto span = preconditionSpan(
+        "preconditionCellEdges",
+        &AbstractTriangulation::hasPreconditionedCellEdges_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1894,6 +1906,9 @@ namespace ttk {
     /// \sa getCellNeighborNumber()
     inline int preconditionCellNeighbors() {
 
+      const auto span = preconditionSpan(
+        "preconditionCellNeighbors",
+        &AbstractTriangulation::hasPreconditionedCellNeighbors_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1920,6 +1935,9 @@ namespace ttk {
     /// \sa getCellTriangleNumber()
     inline int preconditionCellTriangles() {
 
+      const auto span = preconditionSpan(
+        "preconditionCellTriangles",
+        &AbstractTriangulation::hasPreconditionedCellTriangles_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1946,6 +1964,9 @@ namespace ttk {
     /// \sa getNumberOfEdges()
     inline int preconditionEdges() {
 
+      const auto span = preconditionSpan(
+        "preconditionEdges",
+        &AbstractTriangulation::hasPreconditionedEdges_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1973,6 +1994,9 @@ namespace ttk {
     /// \sa getEdgeLinkNumber()
     inline int preconditionEdgeLinks() {
 
+      const auto span = preconditionSpan(
+        "preconditionEdgeLinks",
+        &AbstractTriangulation::hasPreconditionedEdgeLinks_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1999,6 +2023,9 @@ namespace ttk {
     /// \sa getEdgeStarNumber()
     inline int preconditionEdgeStars() {
 
+      const auto span = preconditionSpan(
+        "preconditionEdgeStars",
+        &AbstractTriangulation::hasPreconditionedEdgeStars_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2025,6 +2052,9 @@ namespace ttk {
     /// \sa getEdgeTriangleNumber()
     inline int preconditionEdgeTriangles() {
 
+      const auto span = preconditionSpan(
+        "preconditionEdgeTriangles",
+        &AbstractTriangulation::hasPreconditionedEdgeTriangles_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2052,6 +2082,9 @@ namespace ttk {
     /// \sa getTriangleVertex()
     inline int preconditionTriangles() {
 
+      const auto span = preconditionSpan(
+        "preconditionTriangles",
+        &AbstractTriangulation::hasPreconditionedTriangles_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2078,6 +2111,9 @@ namespace ttk {
     /// \sa getTriangleEdgeNumber()
     inline int preconditionTriangleEdges() {
 
+      const auto span = preconditionSpan(
+        "preconditionTriangleEdges",
+        &AbstractTriangulation::hasPreconditionedTriangleEdges_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2104,6 +2140,9 @@ namespace ttk {
     /// \sa getTriangleLinkNumber()
     inline int preconditionTriangleLinks() {
 
+      const auto span = preconditionSpan(
+        "preconditionTriangleLinks",
+        &AbstractTriangulation::hasPreconditionedTriangleLinks_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2130,6 +2169,9 @@ namespace ttk {
     /// \sa getTriangleStarNumber()
     inline int preconditionTriangleStars() {
 
+      const auto span = preconditionSpan(
+        "preconditionTriangleStars",
+        &AbstractTriangulation::hasPreconditionedTriangleStars_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2157,6 +2199,9 @@ namespace ttk {
     /// \sa getVertexEdgeNumber()
     inline int preconditionVertexEdges() {
 
+      const auto span = preconditionSpan(
+        "preconditionVertexEdges",
+        &AbstractTriangulation::hasPreconditionedVertexEdges_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2184,6 +2229,9 @@ namespace ttk {
     /// \sa getVertexLinkNumber()
     inline int preconditionVertexLinks() {
 
+      const auto span = preconditionSpan(
+        "preconditionVertexLinks",
+        &AbstractTriangulation::hasPreconditionedVertexLinks_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2211,6 +2259,9 @@ namespace ttk {
     /// \sa getVertexNeighborNumber()
     inline int preconditionVertexNeighbors() {
 
+      const auto span = preconditionSpan(
+        "preconditionVertexNeighbors",
+        &AbstractTriangulation::hasPreconditionedVertexNeighbors_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2237,6 +2288,9 @@ namespace ttk {
     /// \sa getVertexStarNumber()
     inline int preconditionVertexStars() {
 
+      const auto span = preconditionSpan(
+        "preconditionVertexStars",
+        &AbstractTriangulation::hasPreconditionedVertexStars_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2264,6 +2318,9 @@ namespace ttk {
     /// \sa getVertexTriangleNumber()
     inline int preconditionVertexTriangles() {
 
+      const auto span = preconditionSpan(
+        "preconditionVertexTriangles",
+        &AbstractTriangulation::hasPreconditionedVertexTriangles_);
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2408,6 +2465,16 @@ namespace ttk {
       }
     }
 
+    /// Set the size (in bytes) of the position tables above which the
+    /// (non-periodic) implicit triangulation computes the positions of its
+    /// simplices on the fly instead of storing them (0 to always compute them
+    /// on the fly).
+    /// \return Returns 0 upon success, negative values otherwise.
+    /// \sa ImplicitTriangulation::setCompactPositionsThreshold()
+    inline int setImplicitCompactPositionsThreshold(const size_t &threshold) {
+      return implicitTriangulation_.setCompactPositionsThreshold(threshold);
+    }
+
     /// Set the input 3D points of the triangulation.
     /// \param pointNumber Number of input vertices.
     /// \param pointSet Pointer to the 3D points. This pointer should point to
@@ -2453,6 +2520,16 @@ namespace ttk {
     }
 
   protected:
+    /// Span of the trace of a pre-processing step, which records nothing
+    /// if the relation is already pre-processed.
+    inline debug::TraceSpan
+      preconditionSpan(const char *name,
+                       bool AbstractTriangulation::*preconditioned) const {
+      if(abstractTriangulation_ && abstractTriangulation_->*preconditioned)
+        return debug::TraceSpan{};
+      return debug::TraceSpan("Triangulation", name);
+    }
+
     inline bool isEmptyCheck() const {
       if(!abstractTriangulation_) {
         printErr("Trying to access an empty data-structure!");
@@ -1,11 +1,14 @@
 #include <ttkAlgorithm.h>
+#include <ttkMacros.h>
 #include <ttkUtils.h>
 
 // #include <vtkDataObject.h> // For output port info
 // #include <vtkObjectFactory.h> // for new macro
 
+#include <OrderDisambiguation.h>
 #include <Triangulation.h>
 #include <vtkCommand.h>
+#include <vtkDataArray.h>
 #include <vtkImageData.h>
 #include <vtkInformation.h>
 #include <vtkInformationIntegerKey.h>
@@ -75,6 +78,44 @@ struct ttkOnDeleteCommand : public vtkCommand {
   }
 };
 
+typedef decltype(ttkAlgorithm::ArrayToOrderMap) ArrayToOrderMapType;
+ArrayToOrderMapType ttkAlgorithm::ArrayToOrderMap;
+size_t ttkAlgorithm::ArrayToOrderMapClock{0};
+
+struct ttkOnArrayDeleteCommand : public vtkCommand {
+  bool deleteEventFired{false};
+  vtkObject *owner_;
+  ArrayToOrderMapType *arrayToOrderMap_;
+
+  static ttkOnArrayDeleteCommand *New() {
+    return new ttkOnArrayDeleteCommand;
+  }
+  vtkTypeMacro(ttkOnArrayDeleteCommand, vtkCommand);
+
+  void Init(vtkObject *owner, ArrayToOrderMapType *arrayToOrderMap) {
+    this->owner_ = owner;
+    this->owner_->AddObserver(vtkCommand::DeleteEvent, this, 1);
+    this->arrayToOrderMap_ = arrayToOrderMap;
+  }
+  ~ttkOnArrayDeleteCommand() {
+    if(!this->deleteEventFired)
+      this->owner_->RemoveObserver(this);
+  }
+
+  void Execute(vtkObject *, unsigned long eventId, void *callData) override {
+    this->deleteEventFired = true;
+
+    // the array can be the scalars or the offsets of several orders
+    auto it = this->arrayToOrderMap_->begin();
+    while(it != this->arrayToOrderMap_->end()) {
+      if(it->first.first == this->owner_ || it->first.second == this->owner_)
+        it = this->arrayToOrderMap_->erase(it);
+      else
+        ++it;
+    }
+  }
+};
+
 // Pass input type information key
 #include <vtkInformationKey.h>
 vtkInformationKeyMacro(ttkAlgorithm, SAME_DATA_TYPE_AS_INPUT_PORT, Integer);
@@ -462,3 +503,83 @@ int ttkAlgorithm::ProcessRequest(vtkInformation *request,
 
   return 0;
 }
+
+const ttk::SimplexId *ttkAlgorithm::GetOrderArray(vtkDataArray *scalars,
+                                                  vtkDataArray *offsets,
+                                                  const int threadNumber) {
+  if(scalars == nullptr)
+    return nullptr;
+
+  if(scalars->GetNumberOfComponents() != 1
+     || (offsets != nullptr
+         && offsets->GetNumberOfTuples() != scalars->GetNumberOfTuples()))
+    return nullptr;
+
+  const vtkMTimeType scalarsMTime = scalars->GetMTime();
+  const vtkMTimeType offsetsMTime
+    = offsets != nullptr ? offsets->GetMTime() : vtkMTimeType{};
+  const ArrayToOrderMapType::key_type key{scalars, offsets};
+
+  // check if the order already exists and is still valid
+  auto it = ttkAlgorithm::ArrayToOrderMap.find(key);
+  if(it != ttkAlgorithm::ArrayToOrderMap.end()) {
+    std::get<5>(it->second) = ++ttkAlgorithm::ArrayToOrderMapClock;
+    if(std::get<3>(it->second) == scalarsMTime
+       && std::get<4>(it->second) == offsetsMTime
+       && (vtkIdType)std::get<0>(it->second).size()
+            == scalars->GetNumberOfTuples())
+      return std::get<0>(it->second).data();
+  } else {
+    // bound the registry: evict the least recently used order
+    if(ttkAlgorithm::ArrayToOrderMap.size() >= ttkAlgorithm::MaxOrderArrays) {
+      auto lru = ttkAlgorithm::ArrayToOrderMap.begin();
+      for(auto jt = lru; jt != ttkAlgorithm::ArrayToOrderMap.end(); ++jt)
+        if(std::get<5>(jt->second) < std::get<5>(lru->second))
+          lru = jt;
+      ttkAlgorithm::ArrayToOrderMap.erase(lru);
+    }
+
+    it = ttkAlgorithm::ArrayToOrderMap
+           .emplace(key, ArrayToOrderMapType::mapped_type{})
+           .first;
+    std::get<5>(it->second) = ++ttkAlgorithm::ArrayToOrderMapClock;
+
+    // Delete callbacks
+    auto scalarsCommand = vtkSmartPointer<ttkOnArrayDeleteCommand>::New();
+    scalarsCommand->Init(scalars, &ttkAlgorithm::ArrayToOrderMap);
+    std::get<1>(it->second) = scalarsCommand;
+    if(offsets != nullptr) {
+      auto offsetsCommand = vtkSmartPointer<ttkOnArrayDeleteCommand>::New();
+      offsetsCommand->Init(offsets, &ttkAlgorithm::ArrayToOrderMap);
+      std::get<2>(it->second) = offsetsCommand;
+    }
+  }
+
+  // (re-)compute the order in place
+  std::get<3>(it->second) = scalarsMTime;
+  std::get<4>(it->second) = offsetsMTime;
+  auto &order = std::get<0>(it->second);
+  order.resize(scalars->GetNumberOfTuples());
+
+  const size_t nVerts = order.size();
+  if(offsets == nullptr) {
+    switch(scalars->GetDataType()) {
+      vtkTemplateMacro(ttk::preconditionOrderArray<VTK_TT>(
+        nVerts, (VTK_TT *)ttkUtils::GetVoidPointer(scalars),
+        (ttk::SimplexId *)nullptr, order.data(), threadNumber));
+    }
+  } else {
+    switch(
+      vtkTemplate2PackMacro(offsets->GetDataType(), scalars->GetDataType())) {
+      ttkTemplate2IdMacro((ttk::preconditionOrderArray<VTK_T2, VTK_T1>(
+        nVerts, (VTK_T2 *)ttkUtils::GetVoidPointer(scalars),
+        (VTK_T1 *)ttkUtils::GetVoidPointer(offsets), order.data(),
+        threadNumber)));
+      default:
+        ttkAlgorithm::ArrayToOrderMap.erase(it);
+        return nullptr;
+    }
+  }
+
+  return order.data();
+}
@@ -6,8 +6,9 @@
 /// \brief Baseclass of all VTK filters that wrap ttk modules.
 ///
 /// This is an abstract vtkAlgorithm that provides standardized input/output
-/// managment for VTK wrappers of ttk filters. The class also provides a static
-/// method to retrieve a ttk::Triangulation of a vtkDataSet.
+/// managment for VTK wrappers of ttk filters. The class also provides static
+/// methods to retrieve a ttk::Triangulation of a vtkDataSet and the global
+/// vertex order of a scalar field.
 
 #pragma once
 
@@ -16,11 +17,14 @@
 
 // std includes
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 // VTK Includes
 #include <vtkAlgorithm.h>
 class vtkCellArray;
 class vtkCommand;
+class vtkDataArray;
 class vtkDataSet;
 class vtkInformation;
 class vtkInformationIntegerKey;
@@ -54,6 +58,36 @@ private:
                                        vtkMTimeType>>
     DataSetToTriangulationMap;
 
+  /**
+   * A static registry that maps (scalar array, offset array) pairs to their
+   * global vertex order (see ttk::preconditionOrderArray), so that the
+   * vertices of a scalar field are sorted only once for all the filters of a
+   * pipeline. The same scalar array can hence be cached with different offset
+   * arrays. Each entry also stores the event listeners that automatically
+   * delete the order if one of its arrays is deleted, the modification times
+   * of both arrays (the order is recomputed in place when they change) and
+   * the time of its last use: the registry holds at most MaxOrderArrays
+   * orders and evicts the least recently used one.
+   */
+  struct ArrayPairHash {
+    size_t operator()(const std::pair<void *, void *> &p) const {
+      const size_t h0 = std::hash<void *>()(p.first);
+      return h0 ^ (std::hash<void *>()(p.second) + 0x9e3779b9 + (h0 << 6)
+                   + (h0 >> 2));
+    }
+  };
+  static std::unordered_map<std::pair<void *, void *>,
+                            std::tuple<std::vector<ttk::SimplexId>,
+                                       vtkSmartPointer<vtkCommand>,
+                                       vtkSmartPointer<vtkCommand>,
+                                       vtkMTimeType,
+                                       vtkMTimeType,
+                                       size_t>,
+                            ArrayPairHash>
+    ArrayToOrderMap;
+  static size_t ArrayToOrderMapClock;
+  static constexpr size_t MaxOrderArrays{8};
+
   int ThreadNumber{1};
   bool UseAllCores{true};
 
@@ -140,6 +174,26 @@ public:
    */
   ttk::Triangulation *GetTriangulation(vtkDataSet *object);
 
+  /**
+   * This method retrieves the global vertex order of a scalar array, i.e. the
+   * rank of each vertex when sorted by increasing scalar values, ties being
+   * broken by the offset array (or by the vertex identifiers if no offset
+   * array is given).
+   *
+   * The order is computed with a parallel sort on the first request and is
+   * cached until the scalar (or offset) array is modified or deleted, so
+   * that every filter processing the same field can reuse it instead of
+   * sorting the vertices again. The returned pointer is owned by the
+   * registry and remains valid until then, or until the order is evicted by
+   * MaxOrderArrays requests for other arrays.
+   *
+   * This method is static so that wrappers that do not (yet) derive from
+   * ttkAlgorithm can also use it.
+   */
+  static const ttk::SimplexId *GetOrderArray(vtkDataArray *scalars,
+                                             vtkDataArray *offsets = nullptr,
+                                             const int threadNumber = 1);
+
   /**
    * This key can be used during the FillOutputPortInfomration() call to
    * specify that an output port should produce the same data type as a
@@ -11,9 +11,15 @@
 #include <vtkMath.h>
 #include <vtkMultiBlockDataSet.h>
 #include <vtkPointData.h>
+#include <vtkIdList.h>
+#include <vtkImageData.h>
 #include <vtkPointSet.h>
+#include <vtkPolyData.h>
 #include <vtkSignedCharArray.h>
 #include <vtkSmartPointer.h>
+#include <vtkTriangleFilter.h>
+
+#include <tuple>
 
 // Render Dependencies
 #include <vtkActor.h>
@@ -131,11 +137,334 @@ void addGobalArray(std::vector<vtkSmartPointer<vtkAbstractArray>> &globalArrays,
   globalArrays.push_back(array);
 };
 
+int ttkCinemaImaging::renderImagesVTK(vtkMultiBlockDataSet *outputImages,
+                                      vtkPolyData *inputAsPD,
+                                      double resolution[2],
+                                      const std::vector<double> &camPositions,
+                                      const std::vector<double> &camFocuses,
+                                      const std::vector<double> &camUps,
+                                      double camHeight,
+                                      double camNearFar[2],
+                                      size_t &nValuePasses) {
+  ttk::Timer timer;
+  double t0 = 0;
+
+  // ---------------------------------------------------------------------------
+  // Camera
+  // ---------------------------------------------------------------------------
+  auto camera = vtkSmartPointer<vtkCamera>::New();
+  camera->SetClippingRange(camNearFar);
+  if(this->GetCamProjectionMode() == 0) {
+    camera->SetParallelProjection(true);
+    camera->SetParallelScale(
+      camHeight * 0.5); // *0.5 to convert CamHeight to weird VTK convention
+  } else {
+    camera->SetParallelProjection(false);
+    camera->SetViewAngle(this->CamAngle);
+  }
+
+  // ---------------------------------------------------------------------------
+  // Initialize Depth Renderer and Components
+  // ---------------------------------------------------------------------------
+  this->printMsg(
+    "Initializing Rendering Pipeline", 0, ttk::debug::LineMode::REPLACE);
+
+  // Depth Pass Elements
+  auto rendererDepth = vtkSmartPointer<vtkRenderer>::New();
+  setupRenderer(rendererDepth, inputAsPD, camera);
+  auto windowDepth = vtkSmartPointer<vtkRenderWindow>::New();
+  setupWindow(windowDepth, rendererDepth, resolution);
+  auto windowDepthToImageFilter
+    = vtkSmartPointer<vtkWindowToImageFilter>::New();
+  windowDepthToImageFilter->SetInput(windowDepth);
+  windowDepthToImageFilter->SetInputBufferTypeToZBuffer();
+
+  // Value passes Elements
+  nValuePasses = 0;
+
+#if VTK_MAJOR_VERSION >= 7
+  auto rendererScalars = vtkSmartPointer<vtkRenderer>::New();
+  setupRenderer(rendererScalars, inputAsPD, camera);
+  auto windowScalars = vtkSmartPointer<vtkRenderWindow>::New();
+  setupWindow(windowScalars, rendererScalars, resolution);
+
+  auto valuePassCollection = vtkSmartPointer<vtkRenderPassCollection>::New();
+  std::vector<std::string> valuePassNames;
+  size_t firstValuePassIndex = 0;
+  if(this->GetGenerateScalarImages()) {
+    auto preventVTKBug = [](vtkDataSet *object) {
+      auto pd = object->GetPointData();
+
+      if(pd->GetNumberOfArrays() < 1) {
+        size_t nP = object->GetNumberOfPoints();
+
+        auto fakeArray = vtkSmartPointer<vtkSignedCharArray>::New();
+        fakeArray->SetName("Fake");
+        fakeArray->SetNumberOfComponents(1);
+        fakeArray->SetNumberOfTuples(nP);
+        auto fakeArrayData = (signed char *)ttkUtils::GetVoidPointer(fakeArray);
+        for(size_t i = 0; i < nP; i++)
+          fakeArrayData[i] = 0;
+        pd->AddArray(fakeArray);
+        return 1;
+      }
+      return 0;
+    };
+
+    if(preventVTKBug(inputAsPD)) {
+      firstValuePassIndex = 1;
+    };
+
+    addValuePass(inputAsPD, 0, valuePassCollection, valuePassNames);
+    addValuePass(inputAsPD, 1, valuePassCollection, valuePassNames);
+    nValuePasses = valuePassNames.size();
+
+    auto sequence = vtkSmartPointer<vtkSequencePass>::New();
+    sequence->SetPasses(valuePassCollection);
+
+    auto cameraPass = vtkSmartPointer<vtkCameraPass>::New();
+    cameraPass->SetDelegatePass(sequence);
+
+    auto glRenderer = vtkOpenGLRenderer::SafeDownCast(rendererScalars);
+    glRenderer->SetPass(cameraPass);
+
+    // First pass to setup everything
+    windowScalars->Render();
+  }
+#else
+  if(this->GetGenerateScalarImages()) {
+    this->printErr("Rendering scalar images requires VTK  7.0 or higher");
+    return 0;
+  }
+#endif
+
+  this->printMsg(
+    "Initializing Rendering Pipeline", 1, timer.getElapsedTime() - t0);
+
+  // ---------------------------------------------------------------------------
+  // Render Images for all Camera Locations
+  // ---------------------------------------------------------------------------
+  {
+    size_t n = camPositions.size() / 3;
+    t0 = timer.getElapsedTime();
+    this->printMsg("Rendering " + std::to_string(n) + " images with "
+                     + std::to_string(nValuePasses + 1) + " fields",
+                   0, ttk::debug::LineMode::REPLACE);
+
+    for(size_t i = 0; i < n; i++) {
+      camera->SetPosition(&camPositions[3 * i]);
+      camera->SetViewUp(&camUps[3 * i]);
+      camera->SetFocalPoint(&camFocuses[3 * i]);
+
+      // Initialize Output Image
+      auto outputImage = vtkSmartPointer<vtkImageData>::New();
+      auto outputImagePD = outputImage->GetPointData();
+
+      // Initialize as depth image
+      {
+        windowDepthToImageFilter->Modified();
+        windowDepthToImageFilter->Update();
+        outputImage->DeepCopy(windowDepthToImageFilter->GetOutput());
+        outputImagePD->GetAbstractArray(0)->SetName("Depth");
+      }
+
+// Render Scalar Images
+#if VTK_MAJOR_VERSION >= 7
+      if(nValuePasses > firstValuePassIndex) {
+        windowScalars->Render();
+
+        for(size_t j = firstValuePassIndex; j < nValuePasses; j++) {
+          auto valuePass = vtkValuePass::SafeDownCast(
+            valuePassCollection->GetItemAsObject(j));
+          auto newValueArray = vtkSmartPointer<vtkFloatArray>::New();
+          newValueArray->DeepCopy(
+            valuePass->GetFloatImageDataArray(rendererScalars));
+          newValueArray->SetName(valuePassNames[j].data());
+          outputImagePD->AddArray(newValueArray);
+        }
+      }
+#endif
+
+      // Add Image to MultiBlock
+      outputImages->SetBlock(i, outputImage);
+    }
+
+    this->printMsg("Rendering " + std::to_string(n) + " images with "
+                     + std::to_string(nValuePasses + 1) + " fields",
+                   1, timer.getElapsedTime() - t0);
+  }
+
+  return 1;
+}
+
+int ttkCinemaImaging::renderImagesCPU(vtkMultiBlockDataSet *outputImages,
+                                      vtkPolyData *inputAsPD,
+                                      double resolution[2],
+                                      const std::vector<double> &camPositions,
+                                      const std::vector<double> &camDirections,
+                                      const std::vector<double> &camUps,
+                                      double camHeight,
+                                      double camNearFar[2],
+                                      size_t &nValuePasses) {
+  ttk::Timer timer;
+  double t0 = 0;
+
+  // ---------------------------------------------------------------------------
+  // Triangulate Input and Build Bounding Volume Hierarchy
+  // ---------------------------------------------------------------------------
+  this->printMsg(
+    "Building bounding volume hierarchy", 0, ttk::debug::LineMode::REPLACE);
+
+  // only the polygons are rendered (their cell data is kept per triangle)
+  auto triangleFilter = vtkSmartPointer<vtkTriangleFilter>::New();
+  triangleFilter->SetInputData(inputAsPD);
+  triangleFilter->PassVertsOff();
+  triangleFilter->PassLinesOff();
+  triangleFilter->Update();
+  auto mesh = triangleFilter->GetOutput();
+
+  const size_t nPoints = mesh->GetNumberOfPoints();
+  const size_t nTriangles = mesh->GetNumberOfCells();
+
+  std::vector<double> coords(3 * nPoints);
+  for(size_t i = 0; i < nPoints; i++)
+    mesh->GetPoint(i, &coords[3 * i]);
+
+  std::vector<int> connectivity(3 * nTriangles);
+  {
+    auto cellPoints = vtkSmartPointer<vtkIdList>::New();
+    for(size_t i = 0; i < nTriangles; i++) {
+      mesh->GetCellPoints(i, cellPoints);
+      for(int k = 0; k < 3; k++)
+        connectivity[3 * i + k] = cellPoints->GetId(k);
+    }
+  }
+
+  ttk::BoundingVolumeHierarchy bvh;
+  bvh.build(coords.data(), connectivity.data(), nTriangles);
+
+  this->printMsg("Building bounding volume hierarchy (#triangles: "
+                   + std::to_string(nTriangles) + ")",
+                 1, timer.getElapsedTime() - t0);
+
+  // ---------------------------------------------------------------------------
+  // Fields to Resample (same order and names as the VTK value passes)
+  // ---------------------------------------------------------------------------
+  // (array, is cell data, component, name)
+  std::vector<std::tuple<vtkDataArray *, bool, int, std::string>> fields;
+  if(this->GetGenerateScalarImages()) {
+    for(int fieldType = 0; fieldType < 2; fieldType++) {
+      vtkFieldData *fd = fieldType == 0 ? (vtkFieldData *)mesh->GetPointData()
+                                        : (vtkFieldData *)mesh->GetCellData();
+      for(int i = 0, j = fd->GetNumberOfArrays(); i < j; i++) {
+        auto field = vtkDataArray::SafeDownCast(fd->GetAbstractArray(i));
+        if(!field)
+          continue;
+        std::string name(field->GetName());
+        const int nComponents = field->GetNumberOfComponents();
+        for(int c = 0; c < nComponents; c++)
+          fields.emplace_back(field, fieldType == 1, c,
+                              nComponents == 1
+                                ? name
+                                : name + "_" + std::to_string(c));
+      }
+    }
+  }
+  nValuePasses = fields.size();
+
+  // ---------------------------------------------------------------------------
+  // Render Images for all Camera Locations
+  // ---------------------------------------------------------------------------
+  const size_t n = camPositions.size() / 3;
+  const int res[2] = {(int)resolution[0], (int)resolution[1]};
+  const size_t nPixels = (size_t)res[0] * res[1];
+
+  t0 = timer.getElapsedTime();
+  this->printMsg("Rendering " + std::to_string(n) + " images with "
+                   + std::to_string(nValuePasses + 1) + " fields",
+                 0, ttk::debug::LineMode::REPLACE);
+
+  // cameras are rendered in batches to bound the memory footprint of the
+  // per-pixel hit information
+  const size_t batchSize = std::max(
+    std::min(n, (size_t)(1 << 22) / std::max(nPixels, (size_t)1)),
+    std::min(n, (size_t)std::max(this->threadNumber_, 1)));
+
+  std::vector<int> triangleIds;
+  std::vector<float> barycentrics;
+
+  for(size_t first = 0; first < n; first += batchSize) {
+    const size_t nBatch = std::min(batchSize, n - first);
+
+    std::vector<float> depthBuffer(nBatch * nPixels);
+    triangleIds.resize(nBatch * nPixels);
+    barycentrics.resize(2 * nBatch * nPixels);
+
+    int status = this->renderImages(
+      depthBuffer.data(), triangleIds.data(), barycentrics.data(), bvh, res,
+      nBatch, &camPositions[3 * first], &camDirections[3 * first],
+      &camUps[3 * first], this->GetCamProjectionMode(), camHeight,
+      this->GetCamAngle(), camNearFar);
+    if(status != 0) {
+      this->printErr("Ray casting failed (error code "
+                     + std::to_string(status) + ")");
+      return 0;
+    }
+
+    for(size_t b = 0; b < nBatch; b++) {
+      auto outputImage = vtkSmartPointer<vtkImageData>::New();
+      outputImage->SetDimensions(res[0], res[1], 1);
+      auto outputImagePD = outputImage->GetPointData();
+
+      auto depthArray = vtkSmartPointer<vtkFloatArray>::New();
+      depthArray->SetName("Depth");
+      depthArray->SetNumberOfTuples(nPixels);
+      std::copy(depthBuffer.begin() + b * nPixels,
+                depthBuffer.begin() + (b + 1) * nPixels,
+                (float *)ttkUtils::GetVoidPointer(depthArray));
+      outputImagePD->AddArray(depthArray);
+
+      const int *imageTriangleIds = &triangleIds[b * nPixels];
+      const float *imageBarycentrics = &barycentrics[2 * b * nPixels];
+
+      for(const auto &field : fields) {
+        auto array = std::get<0>(field);
+        auto valueArray = vtkSmartPointer<vtkFloatArray>::New();
+        valueArray->SetName(std::get<3>(field).data());
+        valueArray->SetNumberOfTuples(nPixels);
+        auto values = (float *)ttkUtils::GetVoidPointer(valueArray);
+
+        switch(array->GetDataType()) {
+          vtkTemplateMacro(
+            std::get<1>(field)
+              ? this->lookupCellData<VTK_TT>(
+                values, (VTK_TT *)ttkUtils::GetVoidPointer(array),
+                array->GetNumberOfComponents(), std::get<2>(field),
+                imageTriangleIds, nPixels)
+              : this->interpolatePointData<VTK_TT>(
+                values, (VTK_TT *)ttkUtils::GetVoidPointer(array),
+                array->GetNumberOfComponents(), std::get<2>(field),
+                connectivity.data(), imageTriangleIds, imageBarycentrics,
+                nPixels));
+        }
+        outputImagePD->AddArray(valueArray);
+      }
+
+      outputImages->SetBlock(first + b, outputImage);
+    }
+  }
+
+  this->printMsg("Rendering " + std::to_string(n) + " images with "
+                   + std::to_string(nValuePasses + 1) + " fields",
+                 1, timer.getElapsedTime() - t0);
+
+  return 1;
+}
+
 int ttkCinemaImaging::RequestData(vtkInformation *request,
                                   vtkInformationVector **inputVector,
                                   vtkInformationVector *outputVector) {
   ttk::Timer timer;
-  double t0 = 0;
 
   // ---------------------------------------------------------------------------
   // Get Input / Output
@@ -232,100 +561,6 @@ int ttkCinemaImaging::RequestData(vtkInformation *request,
     }
   }
 
-  // ---------------------------------------------------------------------------
-  // Camera
-  // ---------------------------------------------------------------------------
-  auto camera = vtkSmartPointer<vtkCamera>::New();
-  camera->SetClippingRange(camNearFar);
-  camera->SetFocalPoint(camFocus);
-  if(this->GetCamProjectionMode() == 0) {
-    camera->SetParallelProjection(true);
-    camera->SetParallelScale(
-      camHeight * 0.5); // *0.5 to convert CamHeight to weird VTK convention
-  } else {
-    camera->SetParallelProjection(false);
-    camera->SetViewAngle(this->CamAngle);
-  }
-
-  // ---------------------------------------------------------------------------
-  // Initialize Depth Renderer and Components
-  // ---------------------------------------------------------------------------
-  t0 = timer.getElapsedTime();
-  this->printMsg(
-    "Initializing Rendering Pipeline", 0, ttk::debug::LineMode::REPLACE);
-
-  // Depth Pass Elements
-  auto rendererDepth = vtkSmartPointer<vtkRenderer>::New();
-  setupRenderer(rendererDepth, inputAsPD, camera);
-  auto windowDepth = vtkSmartPointer<vtkRenderWindow>::New();
-  setupWindow(windowDepth, rendererDepth, resolution);
-  auto windowDepthToImageFilter
-    = vtkSmartPointer<vtkWindowToImageFilter>::New();
-  windowDepthToImageFilter->SetInput(windowDepth);
-  windowDepthToImageFilter->SetInputBufferTypeToZBuffer();
-
-  // Value passes Elements
-  size_t nValuePasses = 0;
-
-#if VTK_MAJOR_VERSION >= 7
-  auto rendererScalars = vtkSmartPointer<vtkRenderer>::New();
-  setupRenderer(rendererScalars, inputAsPD, camera);
-  auto windowScalars = vtkSmartPointer<vtkRenderWindow>::New();
-  setupWindow(windowScalars, rendererScalars, resolution);
-
-  auto valuePassCollection = vtkSmartPointer<vtkRenderPassCollection>::New();
-  std::vector<std::string> valuePassNames;
-  size_t firstValuePassIndex = 0;
-  if(this->GetGenerateScalarImages()) {
-    auto preventVTKBug = [](vtkDataSet *object) {
-      auto pd = object->GetPointData();
-
-      if(pd->GetNumberOfArrays() < 1) {
-        size_t nP = object->GetNumberOfPoints();
-
-        auto fakeArray = vtkSmartPointer<vtkSignedCharArray>::New();
-        fakeArray->SetName("Fake");
-        fakeArray->SetNumberOfComponents(1);
-        fakeArray->SetNumberOfTuples(nP);
-        auto fakeArrayData = (signed char *)ttkUtils::GetVoidPointer(fakeArray);
-        for(size_t i = 0; i < nP; i++)
-          fakeArrayData[i] = 0;
-        pd->AddArray(fakeArray);
-        return 1;
-      }
-      return 0;
-    };
-
-    if(preventVTKBug(inputAsPD)) {
-      firstValuePassIndex = 1;
-    };
-
-    addValuePass(inputAsPD, 0, valuePassCollection, valuePassNames);
-    addValuePass(inputAsPD, 1, valuePassCollection, valuePassNames);
-    nValuePasses = valuePassNames.size();
-
-    auto sequence = vtkSmartPointer<vtkSequencePass>::New();
-    sequence->SetPasses(valuePassCollection);
-
-    auto cameraPass = vtkSmartPointer<vtkCameraPass>::New();
-    cameraPass->SetDelegatePass(sequence);
-
-    auto glRenderer = vtkOpenGLRenderer::SafeDownCast(rendererScalars);
-    glRenderer->SetPass(cameraPass);
-
-    // First pass to setup everything
-    windowScalars->Render();
-  }
-#else
-  if(this->GetGenerateScalarImages()) {
-    this->printErr("Rendering scalar images requires VTK  7.0 or higher");
-    return 0;
-  }
-#endif
-
-  this->printMsg(
-    "Initializing Rendering Pipeline", 1, timer.getElapsedTime() - t0);
-
   // ---------------------------------------------------------------------------
   // Prepare Field Data for Depth Values
   // ---------------------------------------------------------------------------
@@ -388,37 +623,23 @@ int ttkCinemaImaging::RequestData(vtkInformation *request,
       this->printMsg("Sampling grid has field(s): " + gridFieldNames);
   }
 
-  // -------------------------------------------------------------------------
-  // Render Images for all Camera Locations
-  // -------------------------------------------------------------------------
+  // ---------------------------------------------------------------------------
+  // Camera Parameters of all Locations
+  // ---------------------------------------------------------------------------
+  size_t n = inputGrid->GetNumberOfPoints();
+  std::vector<double> camPositions(3 * n);
+  std::vector<double> camFocuses(3 * n);
+  std::vector<double> camDirections(3 * n);
+  std::vector<double> camUps(3 * n);
   {
-    size_t n = inputGrid->GetNumberOfPoints();
-    t0 = timer.getElapsedTime();
-    this->printMsg("Rendering " + std::to_string(n) + " images with "
-                     + std::to_string(nValuePasses + 1) + " fields",
-                   0, ttk::debug::LineMode::REPLACE);
-
-    double camPosition[3] = {0, 0, 0};
     auto readCameraData = [](double target[3], double *src, int index) {
       target[0] = src[index];
       target[1] = src[index + 1];
       target[2] = src[index + 2];
     };
 
-    auto addCamFieldData
-      = [](vtkFieldData *fd, std::string name, double *data) {
-          auto array = vtkSmartPointer<vtkDoubleArray>::New();
-          array->SetName(name.data());
-          array->SetNumberOfComponents(3);
-          array->SetNumberOfTuples(1);
-          array->SetValue(0, data[0]);
-          array->SetValue(1, data[1]);
-          array->SetValue(2, data[2]);
-          fd->AddArray(array);
-        };
-
     for(size_t i = 0; i < n; i++) {
-      // Set Camera Position
+      double *camPosition = &camPositions[3 * i];
       inputGrid->GetPoint(i, camPosition);
 
       // Cam Up Fix
@@ -426,104 +647,98 @@ int ttkCinemaImaging::RequestData(vtkInformation *request,
         camPosition[0] = 0.00000000001;
         camPosition[2] = 0.00000000001;
       }
-      camera->SetPosition(camPosition);
 
       if(camUpData != nullptr) {
         readCameraData(camUp, camUpData, i * 3);
         vtkMath::Normalize(camUp);
       }
-      camera->SetViewUp(camUp);
 
       if(camFocusData != nullptr) {
         readCameraData(camFocus, camFocusData, i * 3);
-        camera->SetFocalPoint(camFocus);
       }
       if(camDirData != nullptr) {
         readCameraData(camDir, camDirData, i * 3);
         camFocus[0] = camPosition[0] + camDir[0];
         camFocus[1] = camPosition[1] + camDir[1];
         camFocus[2] = camPosition[2] + camDir[2];
-        camera->SetFocalPoint(camFocus);
       } else {
         camDir[0] = camFocus[0] - camPosition[0];
         camDir[1] = camFocus[1] - camPosition[1];
         camDir[2] = camFocus[2] - camPosition[2];
-        vtkMath::Normalize(camDir);
       }
+      // the CPU ray caster expects unit directions
+      vtkMath::Normalize(camDir);
 
-      // Initialize Output Image
-      auto outputImage = vtkSmartPointer<vtkImageData>::New();
-      auto outputImagePD = outputImage->GetPointData();
-
-      // Initialize as depth image
-      {
-        windowDepthToImageFilter->Modified();
-        windowDepthToImageFilter->Update();
-        outputImage->DeepCopy(windowDepthToImageFilter->GetOutput());
-        outputImagePD->GetAbstractArray(0)->SetName("Depth");
-      }
-
-// Render Scalar Images
-#if VTK_MAJOR_VERSION >= 7
-      if(nValuePasses > firstValuePassIndex) {
-        windowScalars->Render();
-
-        for(size_t j = firstValuePassIndex; j < nValuePasses; j++) {
-          auto valuePass = vtkValuePass::SafeDownCast(
-            valuePassCollection->GetItemAsObject(j));
-          auto newValueArray = vtkSmartPointer<vtkFloatArray>::New();
-          newValueArray->DeepCopy(
-            valuePass->GetFloatImageDataArray(rendererScalars));
-          newValueArray->SetName(valuePassNames[j].data());
-          outputImagePD->AddArray(newValueArray);
-        }
-      }
-#endif
-
-      // Add Field Data
-      {
-        auto outputImageFD = outputImage->GetFieldData();
-
-        // Global Arrays
-        for(size_t j = 0; j < nGlobalArrays; j++) {
-          outputImageFD->AddArray(globalArrays[j]);
-        }
+      std::copy(camFocus, camFocus + 3, &camFocuses[3 * i]);
+      std::copy(camDir, camDir + 3, &camDirections[3 * i]);
+      std::copy(camUp, camUp + 3, &camUps[3 * i]);
+    }
+  }
 
-        // Specific Arrays
-        addCamFieldData(outputImageFD, "CamPosition", camPosition);
-        addCamFieldData(outputImageFD, "CamDirection", camDir);
-        addCamFieldData(outputImageFD, "CamUp", camera->GetViewUp());
-
-        for(size_t j = 0; j < nInputGridPD; j++) {
-          auto array = inputGridPD->GetAbstractArray(j);
-          auto newArray
-            = vtkSmartPointer<vtkAbstractArray>::Take(array->NewInstance());
-          std::string name(array->GetName());
-          if(outputImageFD->HasArray(name.data()))
-            name += "FromGrid";
-          newArray->SetName(name.data());
-          newArray->SetNumberOfComponents(array->GetNumberOfComponents());
-          newArray->SetNumberOfTuples(1);
-          newArray->SetTuple(0, i, array);
-
-          outputImageFD->AddArray(newArray);
-        }
-      }
+  auto addCamFieldData = [](vtkFieldData *fd, std::string name, double *data) {
+    auto array = vtkSmartPointer<vtkDoubleArray>::New();
+    array->SetName(name.data());
+    array->SetNumberOfComponents(3);
+    array->SetNumberOfTuples(1);
+    array->SetValue(0, data[0]);
+    array->SetValue(1, data[1]);
+    array->SetValue(2, data[2]);
+    fd->AddArray(array);
+  };
+
+  auto addFieldData = [&](vtkImageData *outputImage, size_t i) {
+    auto outputImageFD = outputImage->GetFieldData();
+
+    // Global Arrays
+    for(size_t j = 0; j < nGlobalArrays; j++) {
+      outputImageFD->AddArray(globalArrays[j]);
+    }
 
-      // Add Image to MultiBlock
-      outputImages->SetBlock(i, outputImage);
+    // Specific Arrays
+    addCamFieldData(outputImageFD, "CamPosition", &camPositions[3 * i]);
+    addCamFieldData(outputImageFD, "CamDirection", &camDirections[3 * i]);
+    addCamFieldData(outputImageFD, "CamUp", &camUps[3 * i]);
+
+    for(size_t j = 0; j < nInputGridPD; j++) {
+      auto array = inputGridPD->GetAbstractArray(j);
+      auto newArray
+        = vtkSmartPointer<vtkAbstractArray>::Take(array->NewInstance());
+      std::string name(array->GetName());
+      if(outputImageFD->HasArray(name.data()))
+        name += "FromGrid";
+      newArray->SetName(name.data());
+      newArray->SetNumberOfComponents(array->GetNumberOfComponents());
+      newArray->SetNumberOfTuples(1);
+      newArray->SetTuple(0, i, array);
+
+      outputImageFD->AddArray(newArray);
     }
+  };
 
-    this->printMsg("Rendering " + std::to_string(n) + " images with "
-                     + std::to_string(nValuePasses + 1) + " fields",
-                   1, timer.getElapsedTime() - t0);
+  // ---------------------------------------------------------------------------
+  // Render Images for all Camera Locations
+  // ---------------------------------------------------------------------------
+  size_t nValuePasses = 0;
+  int status = this->Backend == 1
+                 ? this->renderImagesCPU(outputImages, inputAsPD, resolution,
+                                         camPositions, camDirections, camUps,
+                                         camHeight, camNearFar, nValuePasses)
+                 : this->renderImagesVTK(outputImages, inputAsPD, resolution,
+                                         camPositions, camFocuses, camUps,
+                                         camHeight, camNearFar, nValuePasses);
+  if(!status)
+    return 0;
+
+  for(size_t i = 0; i < n; i++) {
+    auto outputImage = vtkImageData::SafeDownCast(outputImages->GetBlock(i));
+    addFieldData(outputImage, i);
   }
 
   // print stats
   this->printMsg(ttk::debug::Separator::L2);
   this->printMsg(
     "Complete (#images: "
-      + std::to_string(inputGrid->GetNumberOfPoints() * (nValuePasses + 1))
+      + std::to_string(n * (nValuePasses + 1))
       + ")",
     1, timer.getElapsedTime());
   this->printMsg(ttk::debug::Separator::L1);
@@ -11,6 +11,12 @@
 /// have vtkDoubleArrays to override the default rendering parameters, i.e, the
 /// resolution, focus, clipping planes, and viewport height.
 ///
+/// The images are either rendered with VTK (OpenGL offscreen rendering and
+/// value passes) or, with the CPU backend, ray-cast on the CPU through a
+/// bounding volume hierarchy of the input triangles (see ttk::CinemaImaging),
+/// which does not require any graphics driver. Both backends output the same
+/// depth and field images.
+///
 /// VTK wrapping code for the @CinemaImaging package.
 ///
 /// \param Input vtkDataObject that will be depicted (vtkDataObject)
@@ -24,9 +30,16 @@
 #include <ttkCinemaImagingModule.h>
 
 // TTK includes
+#include <CinemaImaging.h>
 #include <ttkAlgorithm.h>
 
-class TTKCINEMAIMAGING_EXPORT ttkCinemaImaging : public ttkAlgorithm {
+#include <vector>
+
+class vtkMultiBlockDataSet;
+class vtkPolyData;
+
+class TTKCINEMAIMAGING_EXPORT ttkCinemaImaging : public ttkAlgorithm,
+                                                 protected ttk::CinemaImaging {
 
 public:
   static ttkCinemaImaging *New();
@@ -37,6 +50,8 @@ public:
   vtkGetVector2Macro(Resolution, int);
   vtkSetMacro(GenerateScalarImages, bool);
   vtkGetMacro(GenerateScalarImages, bool);
+  vtkSetMacro(Backend, int);
+  vtkGetMacro(Backend, int);
 
   // Camera
   vtkSetMacro(CamProjectionMode, int);
@@ -73,9 +88,33 @@ protected:
                   vtkInformationVector **inputVector,
                   vtkInformationVector *outputVector) override;
 
+  /// Renders the images with VTK (OpenGL offscreen rendering).
+  int renderImagesVTK(vtkMultiBlockDataSet *outputImages,
+                      vtkPolyData *inputAsPD,
+                      double resolution[2],
+                      const std::vector<double> &camPositions,
+                      const std::vector<double> &camFocuses,
+                      const std::vector<double> &camUps,
+                      double camHeight,
+                      double camNearFar[2],
+                      size_t &nValuePasses);
+
+  /// Renders the images by ray casting on the CPU.
+  int renderImagesCPU(vtkMultiBlockDataSet *outputImages,
+                      vtkPolyData *inputAsPD,
+                      double resolution[2],
+                      const std::vector<double> &camPositions,
+                      const std::vector<double> &camDirections,
+                      const std::vector<double> &camUps,
+                      double camHeight,
+                      double camNearFar[2],
+                      size_t &nValuePasses);
+
 private:
   int Resolution[2]{256, 256};
   bool GenerateScalarImages{true};
+  // 0: VTK (OpenGL), 1: CPU ray casting
+  int Backend{0};
 
   int CamProjectionMode{0};
   bool CamFocusAuto{true};
@@ -2,17 +2,22 @@
 
 #include <vtkInformation.h>
 
-#include <vtkDelimitedTextReader.h>
+#include <vtkDataArray.h>
+#include <vtkDoubleArray.h>
 #include <vtkFieldData.h>
 #include <vtkInformationVector.h>
+#include <vtkIntArray.h>
 #include <vtkSmartPointer.h>
+#include <vtkStringArray.h>
 #include <vtkTable.h>
-#include <vtkVersionMacros.h>
 
 #include <ttkUtils.h>
 
+#include <algorithm>
+#include <limits>
 #include <numeric>
 #include <regex>
+#include <sstream>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/replace.hpp>
@@ -52,7 +57,7 @@ int ttkCinemaQuery::RequestData(vtkInformation *request,
   auto outTable = vtkTable::GetData(outputVector);
 
   // ===========================================================================
-  // Convert Input Tables to SQL Tables
+  // Get Input Tables
   auto nTables = inputVector[0]->GetNumberOfInformationObjects();
   std::vector<vtkTable *> inTables(nTables);
   for(int i = 0; i < nTables; ++i) {
@@ -61,19 +66,30 @@ int ttkCinemaQuery::RequestData(vtkInformation *request,
 
   auto firstTable = inTables[0];
 
-  std::vector<std::string> sqlTableDefinitions;
-  std::vector<std::string> sqlInsertStatements;
-  {
+  // ===========================================================================
+  // Convert Input Tables to SQL Tables (unless cached)
+  std::string cacheKey = std::to_string(this->ExcludeColumnsWithRegexp) + "|"
+                         + this->RegexpString;
+  for(const auto inTable : inTables) {
+    std::stringstream ss;
+    ss << "|" << inTable << ":" << (inTable ? inTable->GetMTime() : 0);
+    cacheKey += ss.str();
+  }
+
+  if(!this->UseCache || !this->hasDatabase() || cacheKey != this->CacheKey) {
     ttk::Timer conversionTimer;
     this->printMsg("Converting input VTK tables to SQL tables", 0,
                    ttk::debug::LineMode::REPLACE);
 
+    this->CacheKey = "";
+    if(!this->openDatabase())
+      return 0;
+
     for(int i = 0; i < nTables; i++) {
       auto inTable = inTables[i];
 
       size_t nc = inTable->GetNumberOfColumns();
       size_t nr = inTable->GetNumberOfRows();
-      std::vector<bool> isNumeric(nc);
 
       // select all input columns whose name is NOT matching the regexp
       std::vector<size_t> includeColumns{};
@@ -90,54 +106,51 @@ int ttkCinemaQuery::RequestData(vtkInformation *request,
       }
 
       // -----------------------------------------------------------------------
-      // Table Definition
-      std::string sqlTableDefinition
-        = "CREATE TABLE InputTable" + std::to_string(i) + " (";
-      bool firstCol{true};
-      for(const auto j : includeColumns) {
+      // Typed columns (REAL for numeric arrays, TEXT otherwise)
+      std::vector<ttk::CinemaQuery::Column> columns(includeColumns.size());
+      for(size_t k = 0; k < includeColumns.size(); k++) {
+        const auto j = includeColumns[k];
         auto c = inTable->GetColumn(j);
-        isNumeric[j] = c->IsNumeric();
-        sqlTableDefinition += (firstCol ? "" : ",") + std::string(c->GetName())
-                              + " " + (isNumeric[j] ? "REAL" : "TEXT");
-        if(firstCol) {
-          firstCol = false;
+        auto dataArray = vtkDataArray::SafeDownCast(c);
+        auto &column = columns[k];
+        column.name = c->GetName();
+        column.isNumeric = c->IsNumeric() && dataArray != nullptr;
+        if(column.isNumeric) {
+          column.numericValues.resize(nr);
+          for(size_t q = 0; q < nr; q++)
+            column.numericValues[q] = dataArray->GetTuple1(q);
+        } else {
+          column.textValues.resize(nr);
+          for(size_t q = 0; q < nr; q++)
+            column.textValues[q] = inTable->GetValue(q, j).ToString();
         }
       }
-      sqlTableDefinition += ")";
-      sqlTableDefinitions.emplace_back(sqlTableDefinition);
 
-      // -----------------------------------------------------------------------
-      // Insert Statements
-      size_t q = 0;
-      while(q < nr) {
-        std::string sqlInsertStatement
-          = "INSERT INTO InputTable" + std::to_string(i) + " VALUES ";
-        for(size_t j = 0; j < 500 && q < nr; j++) {
-          if(j > 0)
-            sqlInsertStatement += ",";
-
-          sqlInsertStatement += "(";
-          firstCol = true;
-          for(const auto k : includeColumns) {
-            sqlInsertStatement += (firstCol ? "" : ",");
-            if(firstCol) {
-              firstCol = false;
-            }
-            if(isNumeric[k])
-              sqlInsertStatement += inTable->GetValue(q, k).ToString();
-            else
-              sqlInsertStatement
-                += "'" + inTable->GetValue(q, k).ToString() + "'";
-          }
-          sqlInsertStatement += ")";
-          q++;
-        }
-        sqlInsertStatements.emplace_back(sqlInsertStatement);
+      if(!this->loadTable("InputTable" + std::to_string(i), columns)) {
+        this->closeDatabase();
+        return 0;
       }
     }
 
+    this->CacheKey = cacheKey;
+
     this->printMsg("Converting input VTK tables to SQL tables", 1,
                    conversionTimer.getElapsedTime());
+  } else {
+    this->printMsg("Using cached SQL tables");
+  }
+
+  // user-requested indices (comma separated column names)
+  {
+    std::vector<std::string> indexedColumns;
+    if(!this->IndexedColumns.empty())
+      boost::split(indexedColumns, this->IndexedColumns, boost::is_any_of(","));
+    for(auto &name : indexedColumns)
+      boost::trim(name);
+    indexedColumns.erase(
+      std::remove(indexedColumns.begin(), indexedColumns.end(), ""),
+      indexedColumns.end());
+    this->updateIndices(indexedColumns);
   }
 
   // ===========================================================================
@@ -149,47 +162,74 @@ int ttkCinemaQuery::RequestData(vtkInformation *request,
                                    firstTable->GetFieldData(), finalQueryString,
                                    errorMsg)) {
       this->printErr(errorMsg);
+      if(!this->UseCache) {
+        this->closeDatabase();
+        this->CacheKey = "";
+      }
       return 0;
     }
   }
 
   // ===========================================================================
   // Compute Query Result
-  std::stringstream csvResult;
-  int csvNColumns = 0;
-  int csvNRows = 0;
+  std::vector<ttk::CinemaQuery::Column> result;
+  int nRows = 0;
 
-  int status
-    = this->execute(sqlTableDefinitions, sqlInsertStatements, finalQueryString,
-                    csvResult, csvNColumns, csvNRows);
+  int status = this->query(finalQueryString, result, nRows);
+
+  if(!this->UseCache) {
+    this->closeDatabase();
+    this->CacheKey = "";
+  }
 
   // ===========================================================================
   // Process Result
   {
-#if VTK_MAJOR_VERSION < 7
-    this->printErr("This filter requires at least VTK 7.0");
-    return 0;
-#else
-    if(csvNRows < 1 || status != 1) {
-      csvResult << "NULL";
-      for(int i = 0; i < csvNColumns; i++)
-        csvResult << ",NULL";
-    }
-
     ttk::Timer conversionTimer;
 
     this->printMsg(
       "Converting SQL result to VTK table", 0, ttk::debug::LineMode::REPLACE);
 
-    auto reader = vtkSmartPointer<vtkDelimitedTextReader>::New();
-    reader->SetReadFromInputString(true);
-    reader->SetInputString(csvResult.str().data());
-    reader->DetectNumericColumnsOn();
-    reader->SetHaveHeaders(true);
-    reader->SetFieldDelimiterCharacters(",");
-    reader->Update();
+    if(status != 1)
+      result.clear();
+
+    auto table = vtkSmartPointer<vtkTable>::New();
+    for(const auto &column : result) {
+      vtkSmartPointer<vtkAbstractArray> array;
+      if(nRows < 1) {
+        // empty result: one row of NULL values
+        auto stringArray = vtkSmartPointer<vtkStringArray>::New();
+        stringArray->InsertNextValue("NULL");
+        array = stringArray;
+      } else if(column.isInteger
+                && std::all_of(column.numericValues.begin(),
+                               column.numericValues.end(), [](double v) {
+                                 return v >= std::numeric_limits<int>::min()
+                                        && v <= std::numeric_limits<int>::max();
+                               })) {
+        auto intArray = vtkSmartPointer<vtkIntArray>::New();
+        intArray->SetNumberOfTuples(nRows);
+        for(int r = 0; r < nRows; r++)
+          intArray->SetValue(r, (int)column.numericValues[r]);
+        array = intArray;
+      } else if(column.isNumeric) {
+        auto doubleArray = vtkSmartPointer<vtkDoubleArray>::New();
+        doubleArray->SetNumberOfTuples(nRows);
+        for(int r = 0; r < nRows; r++)
+          doubleArray->SetValue(r, column.numericValues[r]);
+        array = doubleArray;
+      } else {
+        auto stringArray = vtkSmartPointer<vtkStringArray>::New();
+        stringArray->SetNumberOfValues(nRows);
+        for(int r = 0; r < nRows; r++)
+          stringArray->SetValue(r, column.textValues[r]);
+        array = stringArray;
+      }
+      array->SetName(column.name.data());
+      table->AddColumn(array);
+    }
 
-    outTable->ShallowCopy(reader->GetOutput());
+    outTable->ShallowCopy(table);
 
     auto outFD = outTable->GetFieldData();
     for(const auto inTable : inTables) {
@@ -208,12 +248,11 @@ int ttkCinemaQuery::RequestData(vtkInformation *request,
 
     this->printMsg("Converting SQL result to VTK table", 1,
                    conversionTimer.getElapsedTime());
-#endif
   }
 
   // print stats
   this->printMsg(ttk::debug::Separator::L2);
-  this->printMsg("Complete (#rows: " + std::to_string(csvNRows) + ")", 1,
+  this->printMsg("Complete (#rows: " + std::to_string(nRows) + ")", 1,
                  timer.getElapsedTime());
   this->printMsg(ttk::debug::Separator::L1);
 
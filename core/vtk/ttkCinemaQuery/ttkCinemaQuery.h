@@ -9,6 +9,10 @@
 /// This filter creates a temporary SQLite3 database from the input table,
 /// performs a SQL query, and then returns the result as a vtkTable.
 ///
+/// With UseCache, the database (and the indices on the IndexedColumns) is
+/// kept alive across executions and only rebuilt when the input tables are
+/// modified, so that changing the SQL statement only runs the query.
+///
 /// VTK wrapping code for the @CinemaQuery package.
 ///
 /// \param Input Input table (vtkTable)
@@ -42,6 +46,12 @@ public:
   vtkSetMacro(RegexpString, std::string);
   vtkGetMacro(RegexpString, std::string);
 
+  vtkSetMacro(UseCache, bool);
+  vtkGetMacro(UseCache, bool);
+
+  vtkSetMacro(IndexedColumns, std::string);
+  vtkGetMacro(IndexedColumns, std::string);
+
 protected:
   ttkCinemaQuery();
   ~ttkCinemaQuery() override;
@@ -57,4 +67,9 @@ private:
   std::string SQLStatement{"SELECT * FROM InputTable0"};
   bool ExcludeColumnsWithRegexp{false};
   std::string RegexpString{".*"};
+  bool UseCache{true};
+  std::string IndexedColumns{""};
+
+  // input tables (and their modification times) of the cached database
+  std::string CacheKey{""};
 };
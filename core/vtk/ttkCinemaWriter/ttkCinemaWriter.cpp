@@ -20,10 +20,9 @@
 
 // product writers
 #include <vtkPNGWriter.h>
+#include <vtkVersion.h>
 #include <vtkXMLDataObjectWriter.h>
 
-// file lock
-#include <boost/interprocess/sync/file_lock.hpp>
 #include <sys/stat.h>
 
 vtkStandardNewMacro(ttkCinemaWriter);
@@ -36,6 +35,9 @@ ttkCinemaWriter::ttkCinemaWriter() {
 }
 
 ttkCinemaWriter::~ttkCinemaWriter() {
+  // the queued products refer to this filter
+  this->flushProducts();
+  this->stopWorkers();
 }
 
 int ttkCinemaWriter::FillInputPortInformation(int port, vtkInformation *info) {
@@ -83,9 +85,155 @@ int ttkCinemaWriter::DeleteDatabase() {
   if(this->validateDatabasePath() == 0)
     return 0;
 
+  this->flushProducts();
+
   return vtkDirectory::DeleteDirectory(this->DatabasePath.data());
 }
 
+int ttkCinemaWriter::Flush() {
+  ttk::Timer t;
+  this->printMsg("Writing queued data products", 0,
+                 ttk::debug::LineMode::REPLACE);
+
+  if(!this->flushProducts()) {
+    this->printErr("Unable to write some of the queued data products.");
+    return 0;
+  }
+
+  this->printMsg("Writing queued data products", 1, t.getElapsedTime());
+  return 1;
+}
+
+ttkCinemaWriter::WriteParameters
+  ttkCinemaWriter::GetWriteParameters() const {
+  return {this->Mode,
+          this->Compressor,
+          this->CompressionLevel,
+          this->ScalarField,
+          this->Tolerance,
+          this->MaximumError,
+          this->ZFPBitBudget,
+          this->CompressionType,
+          this->SQMethodPV,
+          this->ZFPOnly,
+          this->Subdivide,
+          this->UseTopologicalSimplification,
+          this->debugLevel_};
+}
+
+int ttkCinemaWriter::WriteDataProduct(vtkDataObject *input,
+                                      const std::string &path,
+                                      const WriteParameters &parameters) {
+  // may run on a writer thread: only uses the given parameters
+  ttk::Debug debug;
+  debug.setDebugMsgPrefix("CinemaWriter");
+  debug.setDebugLevel(parameters.DebugLevel);
+
+  // Write input to disk
+  ttk::Timer t;
+  debug.printMsg("Writing data product to disk", 0,
+                 ttk::debug::LineMode::REPLACE, ttk::debug::Priority::DETAIL);
+
+  if(parameters.Mode == 0) {
+    auto xmlWriter = vtkSmartPointer<vtkXMLWriter>::Take(
+      vtkXMLDataObjectWriter::NewWriter(input->GetDataObjectType()));
+    xmlWriter->SetDataModeToAppended();
+#if VTK_MAJOR_VERSION > 8 || (VTK_MAJOR_VERSION == 8 && VTK_MINOR_VERSION >= 1)
+    xmlWriter->SetCompressorType(
+      parameters.Compressor == 0   ? vtkXMLWriter::ZLIB
+      : parameters.Compressor == 1 ? vtkXMLWriter::LZ4
+                                   : vtkXMLWriter::NONE);
+    xmlWriter->SetCompressionLevel(parameters.CompressionLevel);
+#else
+    if(parameters.Compressor == 2) {
+      xmlWriter->SetCompressorTypeToNone();
+    } else {
+      if(parameters.Compressor == 1)
+        debug.printWrn("LZ4 compression requires VTK 8.1, using ZLib.");
+      xmlWriter->SetCompressorTypeToZLib();
+      vtkZLibDataCompressor::SafeDownCast(xmlWriter->GetCompressor())
+        ->SetCompressionLevel(parameters.CompressionLevel);
+    }
+#endif
+    xmlWriter->SetFileName(path.data());
+    xmlWriter->SetInputData(input);
+    xmlWriter->Write();
+  } else if(parameters.Mode == 1) {
+    auto inputAsID = vtkImageData::SafeDownCast(input);
+    if(!inputAsID) {
+      debug.printErr("PNG format requires input of type 'vtkImageData'.");
+      return 0;
+    }
+
+    // search color array
+    {
+      bool found = false;
+      auto inputPD = inputAsID->GetPointData();
+      for(int i = 0; i < inputPD->GetNumberOfArrays(); i++) {
+        auto array = inputPD->GetAbstractArray(i);
+        if(array->IsA("vtkUnsignedCharArray")) {
+          inputPD->SetActiveScalars(inputPD->GetArrayName(i));
+          found = true;
+          break;
+        }
+      }
+
+      if(!found) {
+        debug.printErr("Input image does not have any color array.");
+        return 0;
+      }
+    }
+
+    auto imageWriter = vtkSmartPointer<vtkPNGWriter>::New();
+    imageWriter->SetCompressionLevel(parameters.CompressionLevel);
+    imageWriter->SetFileName(path.data());
+    imageWriter->SetInputData(inputAsID);
+    imageWriter->Write();
+  } else {
+    // Topological Compression
+    if(!input->IsA("vtkImageData")) {
+      debug.printErr(
+        "Cannot use Topological Compression without a vtkImageData");
+      return 0;
+    }
+    vtkNew<ttkTopologicalCompressionWriter> topologicalCompressionWriter{};
+    topologicalCompressionWriter->SetScalarField(parameters.ScalarField);
+    topologicalCompressionWriter->SetTolerance(parameters.Tolerance);
+    topologicalCompressionWriter->SetMaximumError(parameters.MaximumError);
+    topologicalCompressionWriter->SetZFPBitBudget(parameters.ZFPBitBudget);
+    topologicalCompressionWriter->SetCompressionType(
+      parameters.CompressionType);
+    topologicalCompressionWriter->SetSQMethodPV(parameters.SQMethodPV);
+    topologicalCompressionWriter->SetZFPOnly(parameters.ZFPOnly);
+    topologicalCompressionWriter->SetSubdivide(parameters.Subdivide);
+    topologicalCompressionWriter->SetUseTopologicalSimplification(
+      parameters.UseTopologicalSimplification);
+
+    if(parameters.ScalarField.empty()) {
+      debug.printErr("Need a scalar field for Topological Compression");
+      return 0;
+    }
+    const auto inputData = vtkImageData::SafeDownCast(input);
+    const auto sf
+      = inputData->GetPointData()->GetArray(parameters.ScalarField.data());
+
+    // Check that input scalar field is indeed scalar
+    if(sf->GetNumberOfComponents() != 1) {
+      debug.printErr("Input scalar field should have only 1 component");
+      return 0;
+    }
+    topologicalCompressionWriter->SetDebugLevel(parameters.DebugLevel);
+    topologicalCompressionWriter->SetFileName(path.data());
+    topologicalCompressionWriter->SetInputData(inputData);
+    topologicalCompressionWriter->WriteData();
+  }
+
+  debug.printMsg("Writing data product to disk", 1, t.getElapsedTime(),
+                 ttk::debug::LineMode::NEW, ttk::debug::Priority::DETAIL);
+
+  return 1;
+}
+
 // =============================================================================
 // Process Request
 // =============================================================================
@@ -100,12 +248,8 @@ int ttkCinemaWriter::ProcessDataProduct(vtkDataObject *input) {
   // -------------------------------------------------------------------------
   // Get Correct Data Product Extension
   // -------------------------------------------------------------------------
-  auto xmlWriter
-    = vtkXMLDataObjectWriter::NewWriter(input->GetDataObjectType());
-  xmlWriter->SetDataModeToAppended();
-  xmlWriter->SetCompressorTypeToZLib();
-  vtkZLibDataCompressor::SafeDownCast(xmlWriter->GetCompressor())
-    ->SetCompressionLevel(this->CompressionLevel);
+  auto xmlWriter = vtkSmartPointer<vtkXMLWriter>::Take(
+    vtkXMLDataObjectWriter::NewWriter(input->GetDataObjectType()));
 
   std::string productExtension = this->Mode == 0
                                    ? xmlWriter->GetDefaultFileExtension()
@@ -193,10 +337,36 @@ int ttkCinemaWriter::ProcessDataProduct(vtkDataObject *input) {
     this->printMsg(rows, ttk::debug::Priority::VERBOSE);
   }
 
+  // ===========================================================================
+  // Asynchronous writing: queue a copy of the product
+  // ===========================================================================
+  if(this->AsynchronousWriting) {
+    auto product = vtkSmartPointer<vtkDataObject>::Take(input->NewInstance());
+    product->DeepCopy(input);
+
+    ttk::CinemaWriter::IndexRow row;
+    row.fields = fields;
+    row.values = values;
+    row.productPath = rDataProductPath;
+
+    // the job runs on a writer thread: it only uses copies
+    const std::string path = this->DatabasePath + "/" + rDataProductPath;
+    const WriteParameters parameters = this->GetWriteParameters();
+    this->enqueueProduct(
+      this->DatabasePath, row, [product, path, parameters]() {
+        return ttkCinemaWriter::WriteDataProduct(product, path, parameters);
+      });
+
+    this->printMsg("Queued " + productId + "." + productExtension);
+    this->printMsg(ttk::debug::Separator::L2, ttk::debug::Priority::DETAIL);
+    return 1;
+  }
+
   // ===========================================================================
   // Update database
   // ===========================================================================
-  {
+  // (the index is locked against concurrent writers)
+  int status = this->withIndexLock(this->DatabasePath, [&]() {
     std::string csvPath = this->DatabasePath + "/data.csv";
     struct stat info;
 
@@ -233,19 +403,6 @@ int ttkCinemaWriter::ProcessDataProduct(vtkDataObject *input) {
                      ttk::debug::LineMode::NEW, ttk::debug::Priority::DETAIL);
     }
 
-    // -------------------------------------------------------------------------
-    // Update data.csv file
-    // -----------------------------------------------------------------
-
-    // Initilize file lock for remaining operations
-    boost::interprocess::file_lock flock(csvPath.data());
-    try {
-      // flock.lock();
-    } catch(boost::interprocess::interprocess_exception &e) {
-      this->printErr("Unable to initialize write lock.");
-      return 0;
-    }
-
     // read data.csv file
     auto csvTable = vtkSmartPointer<vtkTable>::New();
     {
@@ -387,95 +544,20 @@ int ttkCinemaWriter::ProcessDataProduct(vtkDataObject *input) {
       this->printMsg("Updating data.csv file", 1, t.getElapsedTime(),
                      ttk::debug::LineMode::NEW, ttk::debug::Priority::DETAIL);
     }
-  }
+
+    return 1;
+  });
+  if(!status)
+    return 0;
 
   // =========================================================================
   // Store Data products
   // =========================================================================
-  {
-    // Write input to disk
-    ttk::Timer t;
-    this->printMsg("Writing data product to disk", 0,
-                   ttk::debug::LineMode::REPLACE, ttk::debug::Priority::DETAIL);
-
-    if(this->Mode == 0) {
-      xmlWriter->SetFileName(
-        (this->DatabasePath + "/" + rDataProductPath).data());
-      xmlWriter->SetInputData(input);
-      xmlWriter->Write();
-    } else if(this->Mode == 1) {
-      auto inputAsID = vtkImageData::SafeDownCast(input);
-      if(!inputAsID) {
-        this->printErr("PNG format requires input of type 'vtkImageData'.");
-        return 0;
-      }
-
-      // search color array
-      {
-        bool found = false;
-        auto inputPD = inputAsID->GetPointData();
-        for(int i = 0; i < inputPD->GetNumberOfArrays(); i++) {
-          auto array = inputPD->GetAbstractArray(i);
-          if(array->IsA("vtkUnsignedCharArray")) {
-            inputPD->SetActiveScalars(inputPD->GetArrayName(i));
-            found = true;
-            break;
-          }
-        }
-
-        if(!found) {
-          this->printErr("Input image does not have any color array.");
-          return 0;
-        }
-      }
-
-      auto imageWriter = vtkSmartPointer<vtkPNGWriter>::New();
-      imageWriter->SetCompressionLevel(this->CompressionLevel);
-      imageWriter->SetFileName(
-        (this->DatabasePath + "/" + rDataProductPath).data());
-      imageWriter->SetInputData(inputAsID);
-      imageWriter->Write();
-    } else {
-      // Topological Compression
-      if(!input->IsA("vtkImageData")) {
-        vtkErrorMacro(
-          "Cannot use Topological Compression without a vtkImageData");
-        return 0;
-      }
-      vtkNew<ttkTopologicalCompressionWriter> topologicalCompressionWriter{};
-      topologicalCompressionWriter->SetScalarField(this->ScalarField);
-      topologicalCompressionWriter->SetTolerance(this->Tolerance);
-      topologicalCompressionWriter->SetMaximumError(this->MaximumError);
-      topologicalCompressionWriter->SetZFPBitBudget(this->ZFPBitBudget);
-      topologicalCompressionWriter->SetCompressionType(this->CompressionType);
-      topologicalCompressionWriter->SetSQMethodPV(this->SQMethodPV);
-      topologicalCompressionWriter->SetZFPOnly(this->ZFPOnly);
-      topologicalCompressionWriter->SetSubdivide(this->Subdivide);
-      topologicalCompressionWriter->SetUseTopologicalSimplification(
-        this->UseTopologicalSimplification);
-
-      if(ScalarField.empty()) {
-        vtkErrorMacro("Need a scalar field for Topological Compression");
-        return 0;
-      }
-      const auto inputData = vtkImageData::SafeDownCast(input);
-      const auto sf = inputData->GetPointData()->GetArray(ScalarField.data());
-
-      // Check that input scalar field is indeed scalar
-      if(sf->GetNumberOfComponents() != 1) {
-        vtkErrorMacro("Input scalar field should have only 1 component");
-        return 0;
-      }
-      topologicalCompressionWriter->SetDebugLevel(this->debugLevel_);
-      topologicalCompressionWriter->SetFileName(
-        (this->DatabasePath + "/" + rDataProductPath).data());
-      topologicalCompressionWriter->SetInputData(inputData);
-      topologicalCompressionWriter->WriteData();
-    }
+  if(!this->WriteDataProduct(input,
+                             this->DatabasePath + "/" + rDataProductPath,
+                             this->GetWriteParameters()))
+    return 0;
 
-    this->printMsg("Writing data product to disk", 1, t.getElapsedTime(),
-                   ttk::debug::LineMode::NEW, ttk::debug::Priority::DETAIL);
-  }
   this->printMsg("Wrote " + productId + "." + productExtension);
   this->printMsg(ttk::debug::Separator::L2, ttk::debug::Priority::DETAIL);
   return 1;
@@ -490,13 +572,29 @@ int ttkCinemaWriter::RequestData(vtkInformation *request,
   {
     std::string modeS
       = this->Mode == 0 ? "VTK" : this->Mode == 1 ? "PNG" : "TTK";
+    std::string compressorS
+      = this->Compressor == 0 ? "ZLib" : this->Compressor == 1 ? "LZ4" : "None";
     this->printMsg({{"Database", this->DatabasePath},
+                    {"Compressor", compressorS},
                     {"C. Level", std::to_string(this->CompressionLevel)},
                     {"Format", modeS},
-                    {"Iterate", this->IterateMultiBlock ? "Yes" : "No"}});
+                    {"Iterate", this->IterateMultiBlock ? "Yes" : "No"},
+                    {"Async", this->AsynchronousWriting ? "Yes" : "No"}});
     this->printMsg(ttk::debug::Separator::L1);
   }
 
+  // -------------------------------------------------------------------------
+  // Flush the queued products written with other parameters
+  // -------------------------------------------------------------------------
+  if(!this->AsynchronousWriting || this->GetMTime() != this->QueueMTime) {
+    if(!this->flushProducts()) {
+      this->printErr("Unable to write some of the queued data products.");
+      return 0;
+    }
+    this->QueueMTime = this->GetMTime();
+  }
+  this->setIndexBatchSize(this->IndexBatchSize);
+
   // -------------------------------------------------------------------------
   // Copy Input to Output
   // -------------------------------------------------------------------------
@@ -535,7 +633,9 @@ int ttkCinemaWriter::RequestData(vtkInformation *request,
 
   // Output Performance
   {
-    std::string resultString = "Complete (#products: ";
+    std::string resultString
+      = this->AsynchronousWriting ? "Complete (#queued products: "
+                                  : "Complete (#products: ";
     resultString += !this->IterateMultiBlock || !inputAsMB
                       ? "1"
                       : std::to_string(inputAsMB->GetNumberOfBlocks());
@@ -8,6 +8,12 @@
 /// This filter stores the input as a VTK dataset to disk and updates the
 /// data.csv file of a Cinema Spec D database.
 ///
+/// With AsynchronousWriting, the products are copied and queued to a pool of
+/// background writer threads (see ttk::CinemaWriter), and their rows are
+/// appended to the data.csv file by batches of IndexBatchSize rows, instead
+/// of rewriting the whole file for every product. The queue is flushed when
+/// the parameters of the filter change, by Flush() and on destruction.
+///
 /// \param Input vtkDataSet to be stored (vtkDataSet)
 
 #pragma once
@@ -20,9 +26,11 @@
 #include <ttkCinemaWriterModule.h>
 
 // TTK Writer
+#include <CinemaWriter.h>
 #include <ttkTopologicalCompressionWriter.h>
 
-class TTKCINEMAWRITER_EXPORT ttkCinemaWriter : public ttkAlgorithm {
+class TTKCINEMAWRITER_EXPORT ttkCinemaWriter : public ttkAlgorithm,
+                                                protected ttk::CinemaWriter {
 
 public:
   static ttkCinemaWriter *New();
@@ -37,14 +45,26 @@ public:
   vtkSetMacro(CompressionLevel, int);
   vtkGetMacro(CompressionLevel, int);
 
+  vtkSetMacro(Compressor, int);
+  vtkGetMacro(Compressor, int);
+
   vtkSetMacro(IterateMultiBlock, bool);
   vtkGetMacro(IterateMultiBlock, bool);
 
   vtkSetMacro(ForwardInput, bool);
   vtkGetMacro(ForwardInput, bool);
 
+  vtkSetMacro(AsynchronousWriting, bool);
+  vtkGetMacro(AsynchronousWriting, bool);
+
+  vtkSetMacro(IndexBatchSize, int);
+  vtkGetMacro(IndexBatchSize, int);
+
   int DeleteDatabase();
 
+  /// Waits until all the queued data products are written and indexed.
+  int Flush();
+
   vtkGetMacro(ScalarField, std::string);
   vtkSetMacro(ScalarField, std::string);
   vtkGetMacro(Tolerance, double);
@@ -67,8 +87,32 @@ protected:
   ttkCinemaWriter();
   ~ttkCinemaWriter();
 
+  /// Parameters of the writing of a data product. The queued products
+  /// hold a copy, so that the writer threads never read the properties
+  /// of the filter.
+  struct WriteParameters {
+    int Mode;
+    int Compressor;
+    int CompressionLevel;
+    std::string ScalarField;
+    double Tolerance;
+    double MaximumError;
+    double ZFPBitBudget;
+    int CompressionType;
+    int SQMethodPV;
+    bool ZFPOnly;
+    bool Subdivide;
+    bool UseTopologicalSimplification;
+    int DebugLevel;
+  };
+
+  WriteParameters GetWriteParameters() const;
+
   int validateDatabasePath();
   int ProcessDataProduct(vtkDataObject *input);
+  static int WriteDataProduct(vtkDataObject *input,
+                              const std::string &path,
+                              const WriteParameters &parameters);
 
   int FillInputPortInformation(int port, vtkInformation *info) override;
   int FillOutputPortInformation(int port, vtkInformation *info) override;
@@ -80,6 +124,12 @@ protected:
 private:
   std::string DatabasePath{""};
   int CompressionLevel{5};
+  // 0: ZLib, 1: LZ4, 2: none
+  int Compressor{0};
+  bool AsynchronousWriting{false};
+  int IndexBatchSize{64};
+  // modification time of the parameters of the queued products
+  vtkMTimeType QueueMTime{0};
   bool IterateMultiBlock{true};
   bool ForwardInput{true};
   int Mode{0};
@@ -23,7 +23,20 @@ vtkStandardNewMacro(ttkDimensionReduction)
     }
   }
 
-  if(dimensionReduction_.isPythonFound()) {
+  // without scikit-learn, fall back to the native engine if it supports
+  // the method
+  int backend = Backend;
+  dimensionReduction_.setInputMethod(Method);
+  if(backend == ttk::DimensionReduction::SCIKIT_LEARN
+     and !dimensionReduction_.isPythonFound()
+     and dimensionReduction_.isNativeMethod()) {
+    backend = ttk::DimensionReduction::NATIVE;
+    vtkWarningMacro("[ttkDimensionReduction] Warning: scikit-learn support "
+                    "disabled, using the native engine.");
+  }
+
+  if(backend == ttk::DimensionReduction::NATIVE
+     or dimensionReduction_.isPythonFound()) {
     const SimplexId numberOfRows = input->GetNumberOfRows();
     const SimplexId numberOfColumns = ScalarFields.size();
 
@@ -53,7 +66,7 @@ vtkStandardNewMacro(ttkDimensionReduction)
     dimensionReduction_.setInputFunctionName(FunctionName);
     dimensionReduction_.setInputMatrixDimensions(numberOfRows, numberOfColumns);
     dimensionReduction_.setInputMatrix(inputData.data());
-    dimensionReduction_.setInputMethod(Method);
+    dimensionReduction_.setInputBackend(backend);
     dimensionReduction_.setInputNumberOfComponents(NumberOfComponents);
     dimensionReduction_.setInputNumberOfNeighbors(NumberOfNeighbors);
     dimensionReduction_.setInputIsDeterministic(IsDeterministic);
@@ -93,8 +106,9 @@ vtkStandardNewMacro(ttkDimensionReduction)
     }
   } else {
     output->ShallowCopy(input);
-    vtkWarningMacro("[ttkDimensionReduction] Warning: Python/Numpy not found, "
-                    "features are disabled.");
+    vtkWarningMacro("[ttkDimensionReduction] Warning: scikit-learn support "
+                    "disabled (Python/Numpy not found), only MDS, t-SNE and "
+                    "PCA are available (native engine).");
   }
 
   {
@@ -112,6 +112,9 @@ public:
   vtkSetMacro(Method, int);
   vtkGetMacro(Method, int);
 
+  vtkSetMacro(Backend, int);
+  vtkGetMacro(Backend, int);
+
   vtkSetMacro(KeepAllDataArrays, bool);
   vtkGetMacro(KeepAllDataArrays, bool);
 
@@ -271,6 +274,7 @@ protected:
     NumberOfComponents = 2;
     NumberOfNeighbors = 5;
     Method = 2;
+    Backend = ttk::DimensionReduction::DEFAULT_BACKEND;
 
     se_Affinity = "nearest_neighbors";
     se_Gamma = 1;
@@ -336,6 +340,7 @@ private:
   int NumberOfComponents;
   int NumberOfNeighbors;
   int Method;
+  int Backend;
   int IsDeterministic;
   bool KeepAllDataArrays;
 
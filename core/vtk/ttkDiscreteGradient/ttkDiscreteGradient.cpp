@@ -1,3 +1,4 @@
+#include <ttkAlgorithm.h>
 #include <ttkDiscreteGradient.h>
 
 using namespace std;
@@ -362,6 +363,11 @@ int ttkDiscreteGradient::doIt(vector<vtkDataSet *> &inputs,
   discreteGradient_.setIterationThreshold(IterationThreshold);
   discreteGradient_.setInputScalarField(inputScalars_->GetVoidPointer(0));
   discreteGradient_.setInputOffsets(inputOffsets_->GetVoidPointer(0));
+  // global vertex order, shared with the other filters of the pipeline
+  // (default identity offsets are equivalent to no offsets)
+  discreteGradient_.setInputVertexOrder(ttkAlgorithm::GetOrderArray(
+    inputScalars_, inputOffsets_ == offsets_ ? nullptr : inputOffsets_,
+    threadNumber_));
 
   switch(inputScalars_->GetDataType()) {
     vtkTemplateMacro(ret = dispatch<VTK_TT>(outputCriticalPoints));
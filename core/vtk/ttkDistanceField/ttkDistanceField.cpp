@@ -11,6 +11,9 @@ vtkStandardNewMacro(ttkDistanceField)
   OutputScalarFieldName = "OutputDistanceField";
   ForceInputVertexScalarField = false;
   InputVertexScalarFieldName = ttk::VertexScalarFieldName;
+  PropagationMethod = static_cast<int>(
+    ttk::DistanceField::PropagationMethod::MULTI_SOURCE);
+  Delta = 0;
   UseAllCores = true;
   SetNumberOfInputPorts(2);
 
@@ -145,6 +148,8 @@ int ttkDistanceField::doIt(vector<vtkDataSet *> &inputs,
 
   distanceField_.setVertexNumber(numberOfPointsInDomain);
   distanceField_.setSourceNumber(numberOfPointsInSources);
+  distanceField_.setPropagationMethod(PropagationMethod);
+  distanceField_.setDelta(Delta);
 
   distanceField_.setVertexIdentifierScalarFieldPointer(
     identifiers_->GetVoidPointer(0));
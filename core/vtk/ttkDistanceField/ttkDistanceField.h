@@ -87,6 +87,12 @@ public:
   vtkSetMacro(InputVertexScalarFieldName, std::string);
   vtkGetMacro(InputVertexScalarFieldName, std::string);
 
+  vtkSetMacro(PropagationMethod, int);
+  vtkGetMacro(PropagationMethod, int);
+
+  vtkSetMacro(Delta, double);
+  vtkGetMacro(Delta, double);
+
   int getTriangulation(vtkDataSet *input);
   int getIdentifiers(vtkDataSet *input);
 
@@ -104,6 +110,8 @@ private:
   std::string OutputScalarFieldName;
   bool ForceInputVertexScalarField;
   std::string InputVertexScalarFieldName;
+  int PropagationMethod;
+  double Delta;
 
   ttk::DistanceField distanceField_;
   ttk::Triangulation *triangulation_;
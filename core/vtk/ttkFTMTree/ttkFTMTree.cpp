@@ -1,3 +1,4 @@
+#include <ttkAlgorithm.h>
 #include <ttkFTMTree.h>
 #include <ttkUtils.h>
 
@@ -373,6 +374,14 @@ int ttkFTMTree::doIt(vector<vtkDataSet *> &inputs,
     ftmTree_[cc].tree.setVertexScalars(
       ttkUtils::GetVoidPointer(inputScalars_[cc]));
     ftmTree_[cc].tree.setVertexSoSoffsets(offsets_[cc].data());
+    // global vertex order, shared with the other filters of the pipeline
+    // (the arrays of split connected components are temporary copies that
+    // would only pollute the registry, they are sorted by the tree itself)
+    if(nbCC_ == 1)
+      ftmTree_[cc].tree.setVertexOrder(ttkAlgorithm::GetOrderArray(
+        inputScalars_[cc], inputOffsets_[cc], threadNumber_));
+    else
+      ftmTree_[cc].tree.setVertexOrder(nullptr);
     ftmTree_[cc].tree.setTreeType(GetTreeType());
     ftmTree_[cc].tree.setSegmentation(GetWithSegmentation());
     ftmTree_[cc].tree.setNormalizeIds(GetWithNormalize());
@@ -430,6 +439,7 @@ int ttkFTMTree::doIt(vector<vtkDataSet *> &inputs,
 
 int ttkFTMTree::getOffsets() {
   offsets_.resize(nbCC_);
+  inputOffsets_.assign(nbCC_, nullptr);
   for(int cc = 0; cc < nbCC_; cc++) {
     vtkDataArray *inputOffsets;
     if(OffsetFieldId != -1) {
@@ -447,6 +457,7 @@ int ttkFTMTree::getOffsets() {
     if(ForceInputOffsetScalarField and InputOffsetScalarFieldName.length()) {
       inputOffsets = connected_components_[cc]->GetPointData()->GetArray(
         InputOffsetScalarFieldName.data());
+      inputOffsets_[cc] = inputOffsets;
       offsets_[cc].resize(numberOfVertices);
       for(SimplexId i = 0; i < numberOfVertices; i++) {
         offsets_[cc][i] = inputOffsets->GetTuple1(i);
@@ -455,6 +466,7 @@ int ttkFTMTree::getOffsets() {
                 ttk::OffsetScalarFieldName)) {
       inputOffsets = connected_components_[cc]->GetPointData()->GetArray(
         ttk::OffsetScalarFieldName);
+      inputOffsets_[cc] = inputOffsets;
       offsets_[cc].resize(numberOfVertices);
       for(SimplexId i = 0; i < numberOfVertices; i++) {
         offsets_[cc][i] = inputOffsets->GetTuple1(i);
@@ -723,7 +735,8 @@ ttkFTMTree::ttkFTMTree()
   : ScalarField{}, ForceInputOffsetScalarField{false},
     InputOffsetScalarFieldName{ttk::OffsetScalarFieldName}, ScalarFieldId{},
     OffsetFieldId{-1}, PeriodicBoundaryConditions{false}, params_{},
-    triangulation_{}, inputScalars_{}, offsets_{}, hasUpdatedMesh_{} {
+    triangulation_{}, inputScalars_{}, offsets_{}, inputOffsets_{},
+    hasUpdatedMesh_{} {
   SetSuperArcSamplingLevel(0);
   SetWithNormalize(true);
   SetWithAdvStats(true);
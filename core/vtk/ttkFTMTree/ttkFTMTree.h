@@ -181,6 +181,8 @@ private:
   std::vector<ttk::ftm::LocalFTM> ftmTree_;
   std::vector<vtkDataArray *> inputScalars_;
   std::vector<std::vector<ttk::SimplexId>> offsets_;
+  // user-provided offset arrays (nullptr for the default identity offsets)
+  std::vector<vtkDataArray *> inputOffsets_;
 
   bool hasUpdatedMesh_;
 };
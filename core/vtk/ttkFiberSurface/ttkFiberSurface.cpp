@@ -14,6 +14,7 @@ vtkStandardNewMacro(ttkFiberSurface)
   CaseIds = true;
   PointMerge = false;
   RangeOctree = true;
+  BrickIndex = false;
   PointMergeDistanceThreshold = 0.000001;
   SetNumberOfInputPorts(2);
 }
@@ -23,11 +24,16 @@ ttkFiberSurface::~ttkFiberSurface() {
 
 template <typename VTK_T1, typename VTK_T2>
 int ttkFiberSurface::dispatch() {
-#ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
   if(RangeOctree) {
-    fiberSurface_.buildOctree<VTK_T1, VTK_T2>();
-  }
+    // range octree, or min-max brick index on regular grids if requested
+    if(!BrickIndex)
+      fiberSurface_.flushBrickIndex();
+    if((!BrickIndex) || (fiberSurface_.buildBrickIndex<VTK_T1, VTK_T2>() < 0)) {
+#ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
+      fiberSurface_.buildOctree<VTK_T1, VTK_T2>();
 #endif // TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
+    }
+  }
   fiberSurface_.computeSurface<VTK_T1, VTK_T2>();
   return 0;
 }
@@ -131,20 +137,21 @@ int ttkFiberSurface::doIt(vector<vtkDataSet *> &inputs,
   fiberSurface_.setPointMerging(PointMerge);
   fiberSurface_.setPointMergingThreshold(PointMergeDistanceThreshold);
 
-#ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
   if((!RangeOctree) || (dataUfield->GetMTime() > GetMTime())
      || (dataVfield->GetMTime() > GetMTime())) {
 
     {
       stringstream msg;
-      msg << "[ttkFiberSurface] Resetting octree..." << endl;
+      msg << "[ttkFiberSurface] Resetting range index..." << endl;
       dMsg(cout, msg.str(), infoMsg);
     }
 
+    fiberSurface_.flushBrickIndex();
+#ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
     fiberSurface_.flushOctree();
+#endif
     Modified();
   }
-#endif
 
   inputPolygon_.clear();
 
@@ -120,6 +120,9 @@ public:
   vtkGetMacro(RangeOctree, bool);
   vtkSetMacro(RangeOctree, bool);
 
+  vtkGetMacro(BrickIndex, bool);
+  vtkSetMacro(BrickIndex, bool);
+
   vtkGetMacro(PointMergeDistanceThreshold, double);
   vtkSetMacro(PointMergeDistanceThreshold, double);
 
@@ -155,7 +158,7 @@ protected:
 
 private:
   bool RangeCoordinates, EdgeParameterization, EdgeIds, TetIds, CaseIds,
-    RangeOctree, PointMerge;
+    RangeOctree, BrickIndex, PointMerge;
 
   double PointMergeDistanceThreshold;
 
@@ -79,7 +79,7 @@ int ttkLDistanceMatrix::RequestData(vtkInformation * /*request*/,
   // Get output
   auto DistTable = vtkTable::GetData(outputVector);
 
-  std::vector<std::vector<double>> distMatrix{};
+  std::vector<double> distMatrix{};
 
   std::vector<void *> inputPtrs(nInputs);
   for(size_t i = 0; i < nInputs; ++i) {
@@ -92,8 +92,14 @@ int ttkLDistanceMatrix::RequestData(vtkInformation * /*request*/,
   const auto dataType = firstField->GetDataType();
   const size_t nPoints = firstField->GetNumberOfTuples();
 
+  int status = 0;
   switch(dataType) {
-    vtkTemplateMacro(distMatrix = this->execute<VTK_TT>(inputPtrs, nPoints));
+    vtkTemplateMacro(status = this->computeDistanceMatrix<VTK_TT>(
+                       distMatrix, inputPtrs, nPoints));
+  }
+  if(status != 0) {
+    this->printErr("Distance matrix computation failed");
+    return 0;
   }
 
   // zero-padd column name to keep Row Data columns ordered
@@ -108,13 +114,13 @@ int ttkLDistanceMatrix::RequestData(vtkInformation * /*request*/,
   // copy distance matrix to output
   for(size_t i = 0; i < nInputs; ++i) {
     std::string name{"Dataset"};
-    zeroPad(name, distMatrix.size(), i);
+    zeroPad(name, nInputs, i);
 
     vtkNew<vtkDoubleArray> col{};
     col->SetNumberOfTuples(nInputs);
     col->SetName(name.c_str());
     for(size_t j = 0; j < nInputs; ++j) {
-      col->SetTuple1(j, distMatrix[i][j]);
+      col->SetTuple1(j, distMatrix[i * nInputs + j]);
     }
     DistTable->AddColumn(col);
   }
@@ -1,3 +1,4 @@
+#include <ttkAlgorithm.h>
 #include <ttkMorseSmaleComplex.h>
 #include <vtkNew.h>
 
@@ -899,6 +900,11 @@ int ttkMorseSmaleComplex::doIt(vector<vtkDataSet *> &inputs,
 
   morseSmaleComplex_.setInputScalarField(inputScalars->GetVoidPointer(0));
   morseSmaleComplex_.setInputOffsets(inputOffsets->GetVoidPointer(0));
+  // global vertex order, shared with the other filters of the pipeline
+  // (default identity offsets are equivalent to no offsets)
+  morseSmaleComplex_.setInputVertexOrder(ttkAlgorithm::GetOrderArray(
+    inputScalars, inputOffsets == defaultOffsets_ ? nullptr : inputOffsets,
+    threadNumber_));
 
   void *ascendingManifoldPtr = nullptr;
   void *descendingManifoldPtr = nullptr;
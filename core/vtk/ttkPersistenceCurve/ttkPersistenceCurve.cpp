@@ -1,3 +1,4 @@
+#include <ttkAlgorithm.h>
 #include <ttkPersistenceCurve.h>
 
 using namespace std;
@@ -311,6 +312,11 @@ int ttkPersistenceCurve::doIt(vtkDataSet *input,
   persistenceCurve_.setWrapper(this);
   persistenceCurve_.setInputScalars(inputScalars_->GetVoidPointer(0));
   persistenceCurve_.setInputOffsets(inputOffsets_->GetVoidPointer(0));
+  // global vertex order, shared with the other filters of the pipeline
+  // (default identity offsets are equivalent to no offsets)
+  persistenceCurve_.setInputVertexOrder(ttkAlgorithm::GetOrderArray(
+    inputScalars_, inputOffsets_ == offsets_ ? nullptr : inputOffsets_,
+    threadNumber_));
   persistenceCurve_.setComputeSaddleConnectors(ComputeSaddleConnectors);
   switch(inputScalars_->GetDataType()) {
     vtkTemplateMacro(ret = dispatch<VTK_TT>());
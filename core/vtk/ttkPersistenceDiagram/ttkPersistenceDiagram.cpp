@@ -1,3 +1,4 @@
+#include <ttkAlgorithm.h>
 #include <ttkPersistenceDiagram.h>
 
 using namespace std;
@@ -19,6 +20,8 @@ vtkStandardNewMacro(ttkPersistenceDiagram)
   InputOffsetScalarFieldName = ttk::OffsetScalarFieldName;
   ForceInputOffsetScalarField = false;
   ComputeSaddleConnectors = false;
+  FusedPipeline = false;
+  PairsOnly = true;
   UseAllCores = true;
   ShowInsideDomain = false;
   computeDiagram_ = true;
@@ -298,7 +301,14 @@ int ttkPersistenceDiagram::doIt(vector<vtkDataSet *> &inputs,
   persistenceDiagram_.setDMTPairs(&dmt_pairs);
   persistenceDiagram_.setInputScalars(inputScalars_->GetVoidPointer(0));
   persistenceDiagram_.setInputOffsets(inputOffsets_->GetVoidPointer(0));
+  // global vertex order, shared with the other filters of the pipeline
+  // (default identity offsets are equivalent to no offsets)
+  persistenceDiagram_.setInputVertexOrder(ttkAlgorithm::GetOrderArray(
+    inputScalars_, inputOffsets_ == offsets_ ? nullptr : inputOffsets_,
+    threadNumber_));
   persistenceDiagram_.setComputeSaddleConnectors(ComputeSaddleConnectors);
+  persistenceDiagram_.setFusedPipeline(FusedPipeline);
+  persistenceDiagram_.setPairsOnly(PairsOnly);
   switch(inputScalars_->GetDataType()) {
     vtkTemplateMacro(ret = dispatch<VTK_TT>());
   }
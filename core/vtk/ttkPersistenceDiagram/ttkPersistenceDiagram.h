@@ -129,6 +129,20 @@ public:
   }
   vtkGetMacro(ComputeSaddleConnectors, int);
 
+  void SetFusedPipeline(int data) {
+    FusedPipeline = data;
+    Modified();
+    computeDiagram_ = true;
+  }
+  vtkGetMacro(FusedPipeline, int);
+
+  void SetPairsOnly(int data) {
+    PairsOnly = data;
+    Modified();
+    computeDiagram_ = true;
+  }
+  vtkGetMacro(PairsOnly, int);
+
   void SetInputOffsetScalarFieldName(std::string data) {
     InputOffsetScalarFieldName = data;
     Modified();
@@ -223,6 +237,8 @@ private:
   std::string InputOffsetScalarFieldName;
   bool ForceInputOffsetScalarField;
   bool ComputeSaddleConnectors;
+  bool FusedPipeline;
+  bool PairsOnly;
   int ShowInsideDomain;
   bool PeriodicBoundaryConditions;
 
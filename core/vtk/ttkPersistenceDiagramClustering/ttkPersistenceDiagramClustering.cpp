@@ -80,6 +80,8 @@ int ttkPersistenceDiagramClustering::doIt(
       persistenceDiagramsClustering.setLambda(Lambda);
       persistenceDiagramsClustering.setNumberOfClusters(NumberOfClusters);
       persistenceDiagramsClustering.setUseAccelerated(UseAccelerated);
+      persistenceDiagramsClustering.setUseParallelAuctionRounds(
+        UseParallelAuctionRounds);
       persistenceDiagramsClustering.setUseKmeansppInit(UseKmeansppInit);
       persistenceDiagramsClustering.setDistanceWritingOptions(
         DistanceWritingOptions);
@@ -185,6 +185,13 @@ public:
   }
   vtkGetMacro(UseAccelerated, bool);
 
+  void SetUseParallelAuctionRounds(bool data) {
+    UseParallelAuctionRounds = data;
+    Modified();
+    needUpdate_ = true;
+  }
+  vtkGetMacro(UseParallelAuctionRounds, bool);
+
   void SetUseKmeansppInit(bool data) {
     UseKmeansppInit = data;
     Modified();
@@ -327,6 +334,7 @@ private:
 
   int NumberOfClusters{1};
   bool UseAccelerated{false};
+  bool UseParallelAuctionRounds{false};
   bool UseKmeansppInit{false};
 
   std::string ScalarField{};
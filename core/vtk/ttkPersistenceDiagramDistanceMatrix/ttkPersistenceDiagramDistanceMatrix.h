@@ -66,6 +66,9 @@ public:
   vtkSetMacro(Lambda, double);
   vtkGetMacro(Lambda, double);
 
+  vtkSetMacro(UseParallelAuctionRounds, bool);
+  vtkGetMacro(UseParallelAuctionRounds, bool);
+
   void SetPairType(const int data) {
     switch(data) {
       case(0):
@@ -8,6 +8,9 @@ ttkTopologicalCompressionReader::ttkTopologicalCompressionReader() {
 
   FileName = nullptr;
   ZFPOnly = false;
+  UseRegionOfInterest = false;
+  for(int i = 0; i < 6; ++i)
+    RegionOfInterest[i] = 0;
   fp = nullptr;
 
   DataScalarType = VTK_DOUBLE;
@@ -62,14 +65,15 @@ int ttkTopologicalCompressionReader::RequestInformation(
 
   //  ReadMetaData(fp);
 
+  int outputExtent[6];
+  double outputOrigin[3];
+  const int numberOfVertices = GetOutputGeometry(outputExtent, outputOrigin);
+
   vtkInformation *outInfo = outputVector->GetInformationObject(0);
   outInfo->Set(vtkDataObject::SPACING(), DataSpacing, 3);
-  outInfo->Set(vtkDataObject::ORIGIN(), DataOrigin, 3);
-  outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), DataExtent, 6);
-
-  int numberOfVertices = 1;
-  for(int i = 0; i < 3; ++i)
-    numberOfVertices *= (1 + DataExtent[2 * i + 1] - DataExtent[2 * i]);
+  outInfo->Set(vtkDataObject::ORIGIN(), outputOrigin, 3);
+  outInfo->Set(
+    vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), outputExtent, 6);
   outInfo->Set(vtkDataObject::FIELD_NUMBER_OF_TUPLES(), numberOfVertices);
 
   vtkDataObject::SetPointDataActiveScalarInfo(outInfo, DataScalarType, 1);
@@ -103,22 +107,32 @@ int ttkTopologicalCompressionReader::RequestData(
     DataExtent[i] = topologicalCompression.getDataExtent()[i];
     DataExtent[3 + i] = topologicalCompression.getDataExtent()[3 + i];
   }
-  int nx = 1 + DataExtent[1] - DataExtent[0];
-  int ny = 1 + DataExtent[3] - DataExtent[2];
-  int nz = 1 + DataExtent[5] - DataExtent[4];
-  int vertexNumber = nx * ny * nz;
   ZFPOnly = topologicalCompression.getZFPOnly();
 
+  // whole grid (needed by the topological simplification)
   BuildMesh();
 
   triangulation.setInputData(mesh);
   topologicalCompression.setupTriangulation(triangulation.getTriangulation());
 
+  int outputExtent[6];
+  double outputOrigin[3];
+  const int vertexNumber = GetOutputGeometry(outputExtent, outputOrigin);
+
   const auto status = topologicalCompression.ReadFromFile<double>(fp);
   if(status != 0) {
     vtkWarningMacro("Failure when reading compressed TTK file");
   }
 
+  if(UseRegionOfInterest) {
+    mesh = vtkSmartPointer<vtkImageData>::New();
+    mesh->SetDimensions(1 + outputExtent[1], 1 + outputExtent[3],
+                        1 + outputExtent[5]);
+    mesh->SetSpacing(DataSpacing[0], DataSpacing[1], DataSpacing[2]);
+    mesh->SetOrigin(outputOrigin[0], outputOrigin[1], outputOrigin[2]);
+    mesh->AllocateScalars(DataScalarType, 2);
+  }
+
   mesh->GetPointData()->RemoveArray(0);
   mesh->GetPointData()->SetNumberOfTuples(vertexNumber);
 
@@ -132,7 +146,9 @@ int ttkTopologicalCompressionReader::RequestData(
   }
   std::vector<double> decompressdeData
     = topologicalCompression.getDecompressedData();
-  for(int i = 0; i < vertexNumber; ++i)
+  const int decompressedNumber
+    = std::min(vertexNumber, (int)decompressdeData.size());
+  for(int i = 0; i < decompressedNumber; ++i)
     decompressed->SetTuple1(i, decompressdeData[i]);
   // decompressed->SetVoidArray(, vertexNumber, 0);
   mesh->GetPointData()->AddArray(decompressed);
@@ -143,7 +159,8 @@ int ttkTopologicalCompressionReader::RequestData(
     vertexOffset->SetName(ttk::OffsetScalarFieldName);
     std::vector<int> voidOffsets
       = topologicalCompression.getDecompressedOffsets();
-    for(size_t i = 0; i < voidOffsets.size(); ++i)
+    for(size_t i = 0; i < std::min((size_t)vertexNumber, voidOffsets.size());
+        ++i)
       vertexOffset->SetTuple1(i, voidOffsets[i]);
     //    vertexOffset->SetVoidArray(
     //      topologicalCompression.getDecompressedOffsets(), vertexNumber, 0);
@@ -187,3 +204,26 @@ void ttkTopologicalCompressionReader::BuildMesh() {
   for(int i = 0; i < 3; ++i)
     numberOfVertices *= (1 + DataExtent[2 * i + 1] - DataExtent[2 * i]);
 }
+
+int ttkTopologicalCompressionReader::GetOutputGeometry(int *extent,
+                                                       double *origin) {
+  topologicalCompression.setRegionOfInterest(
+    UseRegionOfInterest ? RegionOfInterest : nullptr);
+
+  int roi[6];
+  if(topologicalCompression.getLocalRegionOfInterest(roi) < 0) {
+    // empty region of interest
+    for(int i = 0; i < 6; ++i)
+      roi[i] = 0;
+  }
+
+  int numberOfVertices = 1;
+  for(int i = 0; i < 3; ++i) {
+    extent[2 * i] = 0;
+    extent[2 * i + 1] = roi[2 * i + 1] - roi[2 * i];
+    origin[i] = DataOrigin[i] + roi[2 * i] * DataSpacing[i];
+    numberOfVertices *= 1 + extent[2 * i + 1];
+  }
+
+  return numberOfVertices;
+}
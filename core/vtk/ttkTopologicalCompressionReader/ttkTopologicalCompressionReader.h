@@ -59,6 +59,12 @@ public:
   vtkSetMacro(DataScalarType, int);
   vtkGetMacro(DataScalarType, int);
 
+  vtkSetMacro(UseRegionOfInterest, bool);
+  vtkGetMacro(UseRegionOfInterest, bool);
+
+  vtkSetVector6Macro(RegionOfInterest, int);
+  vtkGetVector6Macro(RegionOfInterest, int);
+
   void SetDebugLevel(const int val) {
     this->topologicalCompression.setDebugLevel(val);
   }
@@ -77,6 +83,9 @@ protected:
 
   // TTK management.
   void BuildMesh();
+  // Extent, origin and vertex number of the output (region of interest if
+  // used).
+  int GetOutputGeometry(int *extent, double *origin);
 
 private:
   // General properties.
@@ -90,6 +99,9 @@ private:
   double DataOrigin[3];
   bool ZFPOnly;
   int SQMethod;
+  // Vertex extent to decompress (decodes only the bricks it intersects).
+  bool UseRegionOfInterest;
+  int RegionOfInterest[6];
 
   // TTK object dependencies.
   ttkTriangulation triangulation;
@@ -8,6 +8,7 @@ ttkTopologicalCompressionWriter::ttkTopologicalCompressionWriter() {
   FileName = nullptr;
   ZFPBitBudget = 0;
   ZFPOnly = false;
+  BrickSize = 0;
   Tolerance = 1;
   SQMethod = "";
   Subdivide = false;
@@ -154,6 +155,7 @@ void ttkTopologicalCompressionWriter::WriteData() {
   std::string inputScalarFieldName = inputScalarField->GetName();
 
   topologicalCompression.setFileName(FileName);
+  topologicalCompression.setBrickSize(BrickSize);
   topologicalCompression.WriteToFile<double>(
     fp, CompressionType, ZFPOnly, SQMethod.c_str(), dt, vti->GetExtent(),
     vti->GetSpacing(), vti->GetOrigin(), vp, Tolerance, ZFPBitBudget,
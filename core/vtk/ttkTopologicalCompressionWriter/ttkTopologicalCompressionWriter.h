@@ -87,6 +87,9 @@ public:
   vtkGetMacro(ZFPOnly, bool);
   vtkSetMacro(ZFPOnly, bool);
 
+  vtkGetMacro(BrickSize, int);
+  vtkSetMacro(BrickSize, int);
+
   vtkGetMacro(CompressionType, int);
   vtkSetMacro(CompressionType, int);
 
@@ -145,6 +148,7 @@ private:
   char *FileName;
   double ZFPBitBudget;
   bool ZFPOnly;
+  int BrickSize;
   int CompressionType;
 
   // Compression results.
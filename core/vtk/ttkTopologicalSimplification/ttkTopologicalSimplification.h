@@ -110,6 +110,9 @@ public:
   vtkSetMacro(AddPerturbation, bool);
   vtkGetMacro(AddPerturbation, bool);
 
+  vtkSetMacro(UseLegacySweeps, bool);
+  vtkGetMacro(UseLegacySweeps, bool);
+
   vtkSetMacro(InputOffsetScalarFieldName, std::string);
   vtkGetMacro(InputOffsetScalarFieldName, std::string);
 
@@ -154,6 +157,7 @@ private:
   bool PeriodicBoundaryConditions;
   bool ConsiderIdentifierAsBlackList;
   bool AddPerturbation;
+  bool UseLegacySweeps;
   bool hasUpdatedMesh_;
 
   ttk::TopologicalSimplification topologicalSimplification_;
@@ -552,10 +552,8 @@ int ttkTrackingFromOverlap::computeTrackingGraphs(vtkMultiBlockDataSet *data) {
     return 1;
 
   // Reusable variables
-  vtkPointSet *pointSet0 = nullptr;
-  vtkPointSet *pointSet1 = nullptr;
-  vtkAbstractArray *labels0 = nullptr;
-  vtkAbstractArray *labels1 = nullptr;
+  vtkPointSet *pointSet = nullptr;
+  vtkAbstractArray *labels = nullptr;
 
   dMsg(cout,
        "[ttkTrackingFromOverlap] "
@@ -580,23 +578,28 @@ int ttkTrackingFromOverlap::computeTrackingGraphs(vtkMultiBlockDataSet *data) {
     size_t timeOffset = timeEdgesTMap.size();
     timeEdgesTMap.resize(timeOffset + nT - 1);
 
-    for(size_t t = 1; t < nT; t++) {
-      getData(data, t - 1, l, this->GetLabelFieldName(), pointSet0, labels0);
-      getData(data, t, l, this->GetLabelFieldName(), pointSet1, labels1);
-
-      size_t nPoints0 = pointSet0->GetNumberOfPoints();
-      size_t nPoints1 = pointSet1->GetNumberOfPoints();
-      if(nPoints0 < 1 || nPoints1 < 1)
-        continue;
+    // The sorted points of a timestep are used for both adjacent timesteps
+    SortedPoints sortedPoints0;
+    SortedPoints sortedPoints1;
+    for(size_t t = 0; t < nT; t++) {
+      getData(data, t, l, this->GetLabelFieldName(), pointSet, labels);
 
-      switch(this->LabelDataType) {
-        vtkTemplateMacro(this->trackingFromOverlap.computeOverlap<VTK_TT>(
-          (float *)pointSet0->GetPoints()->GetVoidPointer(0),
-          (float *)pointSet1->GetPoints()->GetVoidPointer(0),
-          (VTK_TT *)labels0->GetVoidPointer(0),
-          (VTK_TT *)labels1->GetVoidPointer(0), nPoints0, nPoints1,
-          timeEdgesTMap[timeOffset + t - 1]));
+      size_t nPoints = pointSet->GetNumberOfPoints();
+      if(nPoints > 0) {
+        switch(this->LabelDataType) {
+          vtkTemplateMacro(this->trackingFromOverlap.sortPoints<VTK_TT>(
+            (float *)pointSet->GetPoints()->GetVoidPointer(0),
+            (VTK_TT *)labels->GetVoidPointer(0), nPoints, sortedPoints1));
+        }
+      } else {
+        sortedPoints1 = SortedPoints();
       }
+
+      if(t > 0 && sortedPoints0.size() > 0 && sortedPoints1.size() > 0)
+        this->trackingFromOverlap.computeOverlap(
+          sortedPoints0, sortedPoints1, timeEdgesTMap[timeOffset + t - 1]);
+
+      swap(sortedPoints0, sortedPoints1);
     }
   }
 
@@ -627,10 +630,8 @@ int ttkTrackingFromOverlap::computeNestingTrees(vtkMultiBlockDataSet *data) {
     return 1;
 
   // Reusable variables
-  vtkPointSet *pointSet0 = nullptr;
-  vtkPointSet *pointSet1 = nullptr;
-  vtkAbstractArray *labels0 = nullptr;
-  vtkAbstractArray *labels1 = nullptr;
+  vtkPointSet *pointSet = nullptr;
+  vtkAbstractArray *labels = nullptr;
 
   dMsg(cout,
        "[ttkTrackingFromOverlap] "
@@ -654,23 +655,28 @@ int ttkTrackingFromOverlap::computeNestingTrees(vtkMultiBlockDataSet *data) {
     vector<Edges> &levelEdgesNMap = this->timeLevelEdgesNMap[timeOffset + t];
     levelEdgesNMap.resize(nL - 1);
 
-    for(size_t l = 1; l < nL; l++) {
-      getData(data, t, l - 1, this->GetLabelFieldName(), pointSet0, labels0);
-      getData(data, t, l, this->GetLabelFieldName(), pointSet1, labels1);
-
-      size_t nPoints0 = pointSet0->GetNumberOfPoints();
-      size_t nPoints1 = pointSet1->GetNumberOfPoints();
-      if(nPoints0 < 1 || nPoints1 < 1)
-        continue;
+    // The sorted points of a level are used for both adjacent levels
+    SortedPoints sortedPoints0;
+    SortedPoints sortedPoints1;
+    for(size_t l = 0; l < nL; l++) {
+      getData(data, t, l, this->GetLabelFieldName(), pointSet, labels);
 
-      switch(this->LabelDataType) {
-        vtkTemplateMacro(this->trackingFromOverlap.computeOverlap<VTK_TT>(
-          (float *)pointSet0->GetPoints()->GetVoidPointer(0),
-          (float *)pointSet1->GetPoints()->GetVoidPointer(0),
-          (VTK_TT *)labels0->GetVoidPointer(0),
-          (VTK_TT *)labels1->GetVoidPointer(0), nPoints0, nPoints1,
-          levelEdgesNMap[l - 1]));
+      size_t nPoints = pointSet->GetNumberOfPoints();
+      if(nPoints > 0) {
+        switch(this->LabelDataType) {
+          vtkTemplateMacro(this->trackingFromOverlap.sortPoints<VTK_TT>(
+            (float *)pointSet->GetPoints()->GetVoidPointer(0),
+            (VTK_TT *)labels->GetVoidPointer(0), nPoints, sortedPoints1));
+        }
+      } else {
+        sortedPoints1 = SortedPoints();
       }
+
+      if(l > 0 && sortedPoints0.size() > 0 && sortedPoints1.size() > 0)
+        this->trackingFromOverlap.computeOverlap(
+          sortedPoints0, sortedPoints1, levelEdgesNMap[l - 1]);
+
+      swap(sortedPoints0, sortedPoints1);
     }
   }
 